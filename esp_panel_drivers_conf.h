@@ -31,6 +31,7 @@
     #define ESP_PANEL_DRIVERS_BUS_USE_RGB               (0)
     #define ESP_PANEL_DRIVERS_BUS_USE_I2C               (0)
     #define ESP_PANEL_DRIVERS_BUS_USE_MIPI_DSI          (0)
+    #define ESP_PANEL_DRIVERS_BUS_USE_I80               (0)
 #endif // ESP_PANEL_DRIVERS_BUS_USE_ALL
 
 /**
@@ -107,6 +108,15 @@
  */
 #define ESP_PANEL_DRIVERS_LCD_COMPILE_UNUSED_DRIVERS    (1)
 
+/**
+ * @brief Performance counters of the LCD
+ *
+ * Enable to count the bitmap transfers, measure their latency, the refresh rate and the time blocked waiting for the
+ * transfers, which are read by `LCD::getStats()`. When set to `0`, the counters are not compiled at all.
+ * Set to `1` to enable, `0` to disable.
+ */
+#define ESP_PANEL_DRIVERS_LCD_ENABLE_STATS              (0)
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////// Touch Configurations /////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -262,7 +272,7 @@
  * 3. Patch version mismatch: No impact on functionality
  */
 #define ESP_PANEL_DRIVERS_CONF_FILE_VERSION_MAJOR 1
-#define ESP_PANEL_DRIVERS_CONF_FILE_VERSION_MINOR 1
+#define ESP_PANEL_DRIVERS_CONF_FILE_VERSION_MINOR 3
 #define ESP_PANEL_DRIVERS_CONF_FILE_VERSION_PATCH 0
 
 // *INDENT-ON*
@@ -75,6 +75,7 @@
  * - `ESP_PANEL_BUS_TYPE_QSPI`
  * - `ESP_PANEL_BUS_TYPE_RGB` (ESP32-S3 only)
  * - `ESP_PANEL_BUS_TYPE_MIPI_DSI` (ESP32-P4 only)
+ * - `ESP_PANEL_BUS_TYPE_I80` (ESP32, ESP32-S2, ESP32-S3 and ESP32-P4)
  */
 #define ESP_PANEL_BOARD_LCD_BUS_TYPE        (ESP_PANEL_BUS_TYPE_SPI)
 
@@ -247,6 +248,40 @@
     /* For DSI power PHY */
     #define ESP_PANEL_BOARD_LCD_MIPI_PHY_LDO_ID             (3)     // -1 if not used.
 
+#elif ESP_PANEL_BOARD_LCD_BUS_TYPE == ESP_PANEL_BUS_TYPE_I80
+
+    /**
+     * @brief I80 (Intel 8080 parallel) bus
+     */
+    /* For host */
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DC           (4)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_WR           (5)
+    #define ESP_PANEL_BOARD_LCD_I80_DATA_WIDTH      (8)     // 8 or 16
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA0        (6)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA1        (7)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA2        (8)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA3        (9)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA4        (10)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA5        (11)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA6        (12)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA7        (13)
+#if ESP_PANEL_BOARD_LCD_I80_DATA_WIDTH > 8
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA8        (14)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA9        (15)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA10       (16)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA11       (17)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA12       (18)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA13       (21)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA14       (38)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA15       (39)
+#endif // ESP_PANEL_BOARD_LCD_I80_DATA_WIDTH
+    /* For panel */
+    #define ESP_PANEL_BOARD_LCD_I80_IO_CS           (3)     // -1 if not used
+    #define ESP_PANEL_BOARD_LCD_I80_CLK_HZ          (20 * 1000 * 1000)
+                                                            // WR clock, should check the write cycle of the LCD IC
+    #define ESP_PANEL_BOARD_LCD_I80_CMD_BITS        (8)     // Typically set to 8
+    #define ESP_PANEL_BOARD_LCD_I80_PARAM_BITS      (8)     // Typically set to 8
+
 #else
 
     #error "The function is not ready and will be implemented in the future."
@@ -327,6 +362,15 @@
 #define ESP_PANEL_BOARD_LCD_RST_IO              (-1)    // Reset pin, -1 if not used
 #define ESP_PANEL_BOARD_LCD_RST_LEVEL           (0)     // Reset active level, 0: low, 1: high
 
+/**
+ * @brief LCD tearing effect (TE) pin configuration, only valid for SPI, QSPI and I80 bus
+ *
+ * Uncomment the macros below to schedule the drawings against the TE pulses of the panel. The TE output should be
+ * enabled by the initialization commands (`TEON`, 0x35)
+ */
+// #define ESP_PANEL_BOARD_LCD_TE_IO               (-1)    // TE pin, -1 if not used
+// #define ESP_PANEL_BOARD_LCD_TE_LEVEL            (1)     // TE pulse level, 0: low, 1: high
+
 #endif // ESP_PANEL_BOARD_USE_LCD
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -752,7 +796,7 @@
  * 3. Patch version mismatch: No impact on functionality
  */
 #define ESP_PANEL_BOARD_CUSTOM_FILE_VERSION_MAJOR 1
-#define ESP_PANEL_BOARD_CUSTOM_FILE_VERSION_MINOR 2
+#define ESP_PANEL_BOARD_CUSTOM_FILE_VERSION_MINOR 4
 #define ESP_PANEL_BOARD_CUSTOM_FILE_VERSION_PATCH 0
 
 #endif // ESP_PANEL_BOARD_DEFAULT_USE_CUSTOM
@@ -165,6 +165,32 @@ const BoardConfig ESP_PANEL_BOARD_DEFAULT_CONFIG = {
                 .chan_id = ESP_PANEL_BOARD_LCD_MIPI_PHY_LDO_ID
             },
         },
+    #elif (ESP_PANEL_BOARD_LCD_BUS_TYPE == ESP_PANEL_BUS_TYPE_I80) && ESP_PANEL_DRIVERS_BUS_ENABLE_I80
+        .bus_config = BusI80::Config{
+            // Host
+            .host = BusI80::HostPartialConfig{
+                .dc_gpio_num = ESP_PANEL_BOARD_LCD_I80_IO_DC,
+                .wr_gpio_num = ESP_PANEL_BOARD_LCD_I80_IO_WR,
+                .data_gpio_nums = {
+                    ESP_PANEL_BOARD_LCD_I80_IO_DATA0, ESP_PANEL_BOARD_LCD_I80_IO_DATA1, ESP_PANEL_BOARD_LCD_I80_IO_DATA2,
+                    ESP_PANEL_BOARD_LCD_I80_IO_DATA3, ESP_PANEL_BOARD_LCD_I80_IO_DATA4, ESP_PANEL_BOARD_LCD_I80_IO_DATA5,
+                    ESP_PANEL_BOARD_LCD_I80_IO_DATA6, ESP_PANEL_BOARD_LCD_I80_IO_DATA7,
+            #if ESP_PANEL_BOARD_LCD_I80_DATA_WIDTH > 8
+                    ESP_PANEL_BOARD_LCD_I80_IO_DATA8, ESP_PANEL_BOARD_LCD_I80_IO_DATA9, ESP_PANEL_BOARD_LCD_I80_IO_DATA10,
+                    ESP_PANEL_BOARD_LCD_I80_IO_DATA11, ESP_PANEL_BOARD_LCD_I80_IO_DATA12, ESP_PANEL_BOARD_LCD_I80_IO_DATA13,
+                    ESP_PANEL_BOARD_LCD_I80_IO_DATA14, ESP_PANEL_BOARD_LCD_I80_IO_DATA15,
+            #endif // ESP_PANEL_BOARD_LCD_I80_DATA_WIDTH
+                },
+                .data_width = ESP_PANEL_BOARD_LCD_I80_DATA_WIDTH,
+            },
+            // Control Panel
+            .control_panel = BusI80::ControlPanelPartialConfig{
+                .cs_gpio_num = ESP_PANEL_BOARD_LCD_I80_IO_CS,
+                .pclk_hz = ESP_PANEL_BOARD_LCD_I80_CLK_HZ,
+                .lcd_cmd_bits = ESP_PANEL_BOARD_LCD_I80_CMD_BITS,
+                .lcd_param_bits = ESP_PANEL_BOARD_LCD_I80_PARAM_BITS,
+            },
+        },
     #endif // ESP_PANEL_BOARD_LCD_BUS_TYPE
         .device_name = TO_STR(ESP_PANEL_BOARD_LCD_CONTROLLER),
         .device_config = {
@@ -190,6 +216,15 @@ const BoardConfig ESP_PANEL_BOARD_DEFAULT_CONFIG = {
                 .flags_enable_io_multiplex = ESP_PANEL_BOARD_LCD_FLAGS_ENABLE_IO_MULTIPLEX,
     #endif // ESP_PANEL_BOARD_LCD_FLAGS_ENABLE_IO_MULTIPLEX
             },
+    #ifdef ESP_PANEL_BOARD_LCD_TE_IO
+            // Tearing effect
+            .tearing_effect = LCD::TearingEffectConfig{
+                .gpio_num = ESP_PANEL_BOARD_LCD_TE_IO,
+        #ifdef ESP_PANEL_BOARD_LCD_TE_LEVEL
+                .active_level = ESP_PANEL_BOARD_LCD_TE_LEVEL,
+        #endif // ESP_PANEL_BOARD_LCD_TE_LEVEL
+            },
+    #endif // ESP_PANEL_BOARD_LCD_TE_IO
         },
         .pre_process = {
             .invert_color = ESP_PANEL_BOARD_LCD_COLOR_INEVRT_BIT,
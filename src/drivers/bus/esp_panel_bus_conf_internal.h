@@ -28,6 +28,7 @@
         #define ESP_PANEL_DRIVERS_BUS_USE_RGB      (1)
         #define ESP_PANEL_DRIVERS_BUS_USE_I2C      (1)
         #define ESP_PANEL_DRIVERS_BUS_USE_MIPI_DSI (1)
+        #define ESP_PANEL_DRIVERS_BUS_USE_I80      (1)
     #else
         #ifndef ESP_PANEL_DRIVERS_BUS_USE_SPI
             #ifdef CONFIG_ESP_PANEL_DRIVERS_BUS_USE_SPI
@@ -78,6 +79,19 @@
             #undef ESP_PANEL_DRIVERS_BUS_USE_MIPI_DSI
             #define ESP_PANEL_DRIVERS_BUS_USE_MIPI_DSI (0)
         #endif
+
+        #if SOC_LCD_I80_SUPPORTED
+            #ifndef ESP_PANEL_DRIVERS_BUS_USE_I80
+                #ifdef CONFIG_ESP_PANEL_DRIVERS_BUS_USE_I80
+                    #define ESP_PANEL_DRIVERS_BUS_USE_I80 CONFIG_ESP_PANEL_DRIVERS_BUS_USE_I80
+                #else
+                    #define ESP_PANEL_DRIVERS_BUS_USE_I80 (0)
+                #endif
+            #endif
+        #else
+            #undef ESP_PANEL_DRIVERS_BUS_USE_I80
+            #define ESP_PANEL_DRIVERS_BUS_USE_I80 (0)
+        #endif
     #endif // ESP_PANEL_DRIVERS_BUS_USE_ALL
 
     #ifndef ESP_PANEL_DRIVERS_BUS_COMPILE_UNUSED_DRIVERS
@@ -146,4 +160,19 @@
     #define ESP_PANEL_DRIVERS_BUS_USE_MIPI_DSI  (0)
 #endif
 
+#if SOC_LCD_I80_SUPPORTED
+    #ifndef ESP_PANEL_DRIVERS_BUS_ENABLE_I80
+        #if ESP_PANEL_DRIVERS_BUS_COMPILE_UNUSED_DRIVERS || ESP_PANEL_DRIVERS_BUS_USE_I80
+            #define ESP_PANEL_DRIVERS_BUS_ENABLE_I80  (1)
+        #else
+            #define ESP_PANEL_DRIVERS_BUS_ENABLE_I80  (0)
+        #endif
+    #endif
+#else
+    #undef ESP_PANEL_DRIVERS_BUS_ENABLE_I80
+    #define ESP_PANEL_DRIVERS_BUS_ENABLE_I80  (0)
+    #undef ESP_PANEL_DRIVERS_BUS_USE_I80
+    #define ESP_PANEL_DRIVERS_BUS_USE_I80  (0)
+#endif
+
 // *INDENT-ON*
@@ -52,6 +52,9 @@ const utils::unordered_map<int, utils::string> BusFactory::_type_name_map = {
 #if ESP_PANEL_DRIVERS_BUS_ENABLE_MIPI_DSI
     TYPE_NAME_MAP_ITEM(DSI),
 #endif
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_I80
+    TYPE_NAME_MAP_ITEM(I80),
+#endif
 };
 
 const utils::unordered_map<int, BusFactory::FunctionDeviceConstructor> BusFactory::_type_constructor_map = {
@@ -70,6 +73,9 @@ const utils::unordered_map<int, BusFactory::FunctionDeviceConstructor> BusFactor
 #if ESP_PANEL_DRIVERS_BUS_USE_MIPI_DSI
     TYPE_CREATOR_MAP_ITEM(DSI),
 #endif
+#if ESP_PANEL_DRIVERS_BUS_USE_I80
+    TYPE_CREATOR_MAP_ITEM(I80),
+#endif
 };
 
 std::shared_ptr<Bus> BusFactory::create(const Config &config)
@@ -123,6 +129,11 @@ int BusFactory::getConfigType(const Config &config)
         return BusDSI::BASIC_ATTRIBUTES_DEFAULT.type;
     }
 #endif // ESP_PANEL_DRIVERS_BUS_ENABLE_MIPI_DSI
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_I80
+    if (std::holds_alternative<BusI80::Config>(config)) {
+        return BusI80::BASIC_ATTRIBUTES_DEFAULT.type;
+    }
+#endif // ESP_PANEL_DRIVERS_BUS_ENABLE_I80
 
     return -1;
 }
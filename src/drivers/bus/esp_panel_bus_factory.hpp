@@ -15,6 +15,7 @@
 #include "esp_panel_bus.hpp"
 #include "esp_panel_bus_dsi.hpp"
 #include "esp_panel_bus_i2c.hpp"
+#include "esp_panel_bus_i80.hpp"
 #include "esp_panel_bus_qspi.hpp"
 #include "esp_panel_bus_rgb.hpp"
 #include "esp_panel_bus_spi.hpp"
@@ -31,7 +32,7 @@ public:
     /**
      * @brief The bus configuration variant type
      *
-     * Contains configurations for different types of buses (I2C, SPI, QSPI, RGB, DSI)
+     * Contains configurations for different types of buses (I2C, SPI, QSPI, RGB, DSI, I80)
      */
     using Config = std::variant <
                    BusI2C::Config, BusSPI::Config, BusQSPI::Config
@@ -40,6 +41,9 @@ public:
 #endif
 #if ESP_PANEL_DRIVERS_BUS_ENABLE_MIPI_DSI
                    , BusDSI::Config
+#endif
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_I80
+                   , BusI80::Config
 #endif
                    >;
 
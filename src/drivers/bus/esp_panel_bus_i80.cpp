@@ -0,0 +1,381 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "esp_panel_bus_conf_internal.h"
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_I80
+
+#include "utils/esp_panel_utils_log.h"
+#include "drivers/host/esp_panel_host_i80.hpp"
+#include "esp_panel_bus_i80.hpp"
+
+namespace esp_panel::drivers {
+
+void BusI80::Config::convertPartialToFull()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    if (std::holds_alternative<HostPartialConfig>(host)) {
+#if ESP_UTILS_CONF_LOG_LEVEL == ESP_UTILS_LOG_LEVEL_DEBUG
+        printHostConfig();
+#endif // ESP_UTILS_LOG_LEVEL_DEBUG
+        auto &config = std::get<HostPartialConfig>(host);
+        HostFullConfig full_config = {
+            .dc_gpio_num = config.dc_gpio_num,
+            .wr_gpio_num = config.wr_gpio_num,
+            .clk_src = LCD_CLK_SRC_DEFAULT,
+            .data_gpio_nums = {},
+            .bus_width = static_cast<size_t>(config.data_width),
+            .max_transfer_bytes = static_cast<size_t>(config.max_transfer_bytes),
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+            .dma_burst_size = 64,
+#else
+            .psram_trans_align = 64,
+            .sram_trans_align = 4,
+#endif // ESP_IDF_VERSION
+        };
+        // Only the first `data_width` pins are used, mark the others as unused
+        constexpr int data_gpio_num = sizeof(full_config.data_gpio_nums) / sizeof(full_config.data_gpio_nums[0]);
+        for (int i = 0; i < data_gpio_num; i++) {
+            full_config.data_gpio_nums[i] = ((i < config.data_width) && (i < I80_DATA_WIDTH_MAX)) ?
+                                            config.data_gpio_nums[i] : -1;
+        }
+        host = full_config;
+    }
+
+    if (std::holds_alternative<ControlPanelPartialConfig>(control_panel)) {
+#if ESP_UTILS_CONF_LOG_LEVEL == ESP_UTILS_LOG_LEVEL_DEBUG
+        printControlPanelConfig();
+#endif // ESP_UTILS_LOG_LEVEL_DEBUG
+        auto &config = std::get<ControlPanelPartialConfig>(control_panel);
+        control_panel = ControlPanelFullConfig{
+            .cs_gpio_num = config.cs_gpio_num,
+            .pclk_hz = static_cast<uint32_t>(config.pclk_hz),
+            .trans_queue_depth = 10,
+            .on_color_trans_done = nullptr,
+            .user_ctx = nullptr,
+            .lcd_cmd_bits = config.lcd_cmd_bits,
+            .lcd_param_bits = config.lcd_param_bits,
+            .dc_levels = {
+                .dc_idle_level = 0,
+                .dc_cmd_level = 0,
+                .dc_dummy_level = 0,
+                .dc_data_level = 1,
+            },
+            .flags = {
+                .cs_active_high = 0,
+                .reverse_color_bits = 0,
+                .swap_color_bytes = 0,
+                .pclk_active_neg = 0,
+                .pclk_idle_low = 0,
+            },
+        };
+    }
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+}
+
+void BusI80::Config::printHostConfig() const
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    if (std::holds_alternative<HostFullConfig>(host)) {
+        auto &config = std::get<HostFullConfig>(host);
+        ESP_UTILS_LOGI(
+            "\n\t{Host config}[full]"
+            "\n\t\t-> [host_id]: %d"
+            "\n\t\t-> [dc_gpio_num]: %d"
+            "\n\t\t-> [wr_gpio_num]: %d"
+            "\n\t\t-> [clk_src]: %d"
+            "\n\t\t-> [bus_width]: %d"
+            "\n\t\t-> [max_transfer_bytes]: %d"
+            , static_cast<int>(host_id)
+            , static_cast<int>(config.dc_gpio_num)
+            , static_cast<int>(config.wr_gpio_num)
+            , static_cast<int>(config.clk_src)
+            , static_cast<int>(config.bus_width)
+            , static_cast<int>(config.max_transfer_bytes)
+        );
+        for (int i = 0; (i < static_cast<int>(config.bus_width)) && (i < I80_DATA_WIDTH_MAX); i++) {
+            ESP_UTILS_LOGI("\t\t-> [data_gpio_nums][%d]: %d", i, static_cast<int>(config.data_gpio_nums[i]));
+        }
+    } else {
+        auto &config = std::get<HostPartialConfig>(host);
+        ESP_UTILS_LOGI(
+            "\n\t{Host config}[partial]"
+            "\n\t\t-> [host_id]: %d"
+            "\n\t\t-> [dc_gpio_num]: %d"
+            "\n\t\t-> [wr_gpio_num]: %d"
+            "\n\t\t-> [data_width]: %d"
+            "\n\t\t-> [max_transfer_bytes]: %d"
+            , static_cast<int>(host_id)
+            , static_cast<int>(config.dc_gpio_num)
+            , static_cast<int>(config.wr_gpio_num)
+            , static_cast<int>(config.data_width)
+            , static_cast<int>(config.max_transfer_bytes)
+        );
+        for (int i = 0; (i < config.data_width) && (i < I80_DATA_WIDTH_MAX); i++) {
+            ESP_UTILS_LOGI("\t\t-> [data_gpio_nums][%d]: %d", i, static_cast<int>(config.data_gpio_nums[i]));
+        }
+    }
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+}
+
+void BusI80::Config::printControlPanelConfig() const
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    if (std::holds_alternative<ControlPanelFullConfig>(control_panel)) {
+        auto &config = std::get<ControlPanelFullConfig>(control_panel);
+        // Here to split the log to avoid the log buffer overflow
+        ESP_UTILS_LOGI(
+            "\n\t{Control panel config}[full]"
+            "\n\t\t-> [cs_gpio_num]: %d"
+            "\n\t\t-> [pclk_hz]: %d"
+            "\n\t\t-> [trans_queue_depth]: %d"
+            "\n\t\t-> [lcd_cmd_bits]: %d"
+            "\n\t\t-> [lcd_param_bits]: %d"
+            , static_cast<int>(config.cs_gpio_num)
+            , static_cast<int>(config.pclk_hz)
+            , static_cast<int>(config.trans_queue_depth)
+            , static_cast<int>(config.lcd_cmd_bits)
+            , static_cast<int>(config.lcd_param_bits)
+        );
+        ESP_UTILS_LOGI(
+            "\n\t\t-> {dc_levels}"
+            "\n\t\t\t-> [dc_idle_level]: %d"
+            "\n\t\t\t-> [dc_cmd_level]: %d"
+            "\n\t\t\t-> [dc_dummy_level]: %d"
+            "\n\t\t\t-> [dc_data_level]: %d"
+            "\n\t\t-> {flags}"
+            "\n\t\t\t-> [cs_active_high]: %d"
+            "\n\t\t\t-> [reverse_color_bits]: %d"
+            "\n\t\t\t-> [swap_color_bytes]: %d"
+            "\n\t\t\t-> [pclk_active_neg]: %d"
+            "\n\t\t\t-> [pclk_idle_low]: %d"
+            , static_cast<int>(config.dc_levels.dc_idle_level)
+            , static_cast<int>(config.dc_levels.dc_cmd_level)
+            , static_cast<int>(config.dc_levels.dc_dummy_level)
+            , static_cast<int>(config.dc_levels.dc_data_level)
+            , static_cast<int>(config.flags.cs_active_high)
+            , static_cast<int>(config.flags.reverse_color_bits)
+            , static_cast<int>(config.flags.swap_color_bytes)
+            , static_cast<int>(config.flags.pclk_active_neg)
+            , static_cast<int>(config.flags.pclk_idle_low)
+        );
+    } else {
+        auto &config = std::get<ControlPanelPartialConfig>(control_panel);
+        ESP_UTILS_LOGI(
+            "\n\t{Control panel config}[partial]"
+            "\n\t\t-> [cs_gpio_num]: %d"
+            "\n\t\t-> [pclk_hz]: %d"
+            "\n\t\t-> [lcd_cmd_bits]: %d"
+            "\n\t\t-> [lcd_param_bits]: %d"
+            , static_cast<int>(config.cs_gpio_num)
+            , static_cast<int>(config.pclk_hz)
+            , static_cast<int>(config.lcd_cmd_bits)
+            , static_cast<int>(config.lcd_param_bits)
+        );
+    }
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+}
+
+BusI80::~BusI80()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_EXIT(del(), "Delete failed");
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+}
+
+bool BusI80::configI80_FreqHz(uint32_t hz)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+
+    ESP_UTILS_LOGD("Param: hz(%d)", (int)hz);
+    getControlPanelFullConfig().pclk_hz = hz;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool BusI80::configI80_CommandBits(uint32_t num)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+
+    ESP_UTILS_LOGD("Param: num(%d)", (int)num);
+    getControlPanelFullConfig().lcd_cmd_bits = num;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool BusI80::configI80_ParamBits(uint32_t num)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+
+    ESP_UTILS_LOGD("Param: num(%d)", (int)num);
+    getControlPanelFullConfig().lcd_param_bits = num;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool BusI80::configI80_TransQueueDepth(uint8_t depth)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+
+    ESP_UTILS_LOGD("Param: depth(%d)", (int)depth);
+    getControlPanelFullConfig().trans_queue_depth = depth;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool BusI80::configI80_MaxTransferBytes(uint32_t bytes)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+
+    ESP_UTILS_LOGD("Param: bytes(%d)", (int)bytes);
+    getHostFullConfig().max_transfer_bytes = bytes;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool BusI80::init()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Already initialized");
+
+    // Convert the partial configuration to full configuration
+    _config.convertPartialToFull();
+#if ESP_UTILS_CONF_LOG_LEVEL == ESP_UTILS_LOG_LEVEL_DEBUG
+    _config.printHostConfig();
+    _config.printControlPanelConfig();
+#endif // ESP_UTILS_LOG_LEVEL_DEBUG
+
+    // Get the host instance, it is shared by the buses with the same host ID
+    auto host_id = getConfig().host_id;
+    _host = HostI80::getInstance(host_id, getHostFullConfig());
+    ESP_UTILS_CHECK_NULL_RETURN(_host, false, "Get I80 host(%d) instance failed", host_id);
+    ESP_UTILS_LOGD("Get I80 host(%d) instance", host_id);
+
+    setState(State::INIT);
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool BusI80::begin()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::BEGIN), false, "Already begun");
+
+    // Initialize the bus if not initialized
+    if (!isOverState(State::INIT)) {
+        ESP_UTILS_CHECK_FALSE_RETURN(init(), false, "Init failed");
+    }
+
+    // Startup the host
+    auto host_id = getConfig().host_id;
+    ESP_UTILS_CHECK_FALSE_RETURN(_host->begin(), false, "Begin I80 host(%d) failed", host_id);
+    ESP_UTILS_LOGD("Begin I80 host(%d)", host_id);
+
+    // Create the control panel
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        esp_lcd_new_panel_io_i80(getHostHandle(), &getControlPanelFullConfig(), &control_panel), false,
+        "create control panel failed"
+    );
+    ESP_UTILS_LOGD("Create control panel @%p", control_panel);
+
+    setState(State::BEGIN);
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool BusI80::del()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    // Delete the control panel if valid
+    if (isControlPanelValid()) {
+        ESP_UTILS_CHECK_FALSE_RETURN(delControlPanel(), false, "Delete control panel failed");
+    }
+
+    // Release the host instance if valid, the host is deleted together with the last bus using it
+    if (_host != nullptr) {
+        _host = nullptr;
+        auto host_id = getConfig().host_id;
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            HostI80::tryReleaseInstance(host_id), false, "Release I80 host(%d) failed", host_id
+        );
+    }
+
+    setState(State::DEINIT);
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+int BusI80::getDataWidth() const
+{
+    if (std::holds_alternative<HostFullConfig>(_config.host)) {
+        return static_cast<int>(std::get<HostFullConfig>(_config.host).bus_width);
+    }
+
+    return std::get<HostPartialConfig>(_config.host).data_width;
+}
+
+BusI80::HostHandle BusI80::getHostHandle()
+{
+    return (_host == nullptr) ? nullptr : static_cast<esp_lcd_i80_bus_handle_t>(_host->getHandle());
+}
+
+BusI80::HostFullConfig &BusI80::getHostFullConfig()
+{
+    if (std::holds_alternative<HostPartialConfig>(_config.host)) {
+        _config.convertPartialToFull();
+    }
+
+    return std::get<HostFullConfig>(_config.host);
+}
+
+BusI80::ControlPanelFullConfig &BusI80::getControlPanelFullConfig()
+{
+    if (std::holds_alternative<ControlPanelPartialConfig>(_config.control_panel)) {
+        _config.convertPartialToFull();
+    }
+
+    return std::get<ControlPanelFullConfig>(_config.control_panel);
+}
+
+} // namespace esp_panel::drivers
+
+#endif // ESP_PANEL_DRIVERS_BUS_ENABLE_I80
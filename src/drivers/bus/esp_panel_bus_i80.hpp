@@ -0,0 +1,284 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include "esp_panel_bus_conf_internal.h"
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_I80
+
+#include <array>
+#include <memory>
+#include <variant>
+#include "esp_lcd_panel_io.h"
+#include "utils/esp_panel_utils_cxx.hpp"
+#include "esp_panel_bus.hpp"
+
+namespace esp_panel::drivers {
+
+// Forward declaration
+class HostI80;
+
+/**
+ * @brief The I80 (Intel 8080 parallel) bus class for ESP Panel
+ *
+ * This class is derived from `Bus` class and provides I80 bus implementation for ESP Panel. It is used by the MCU
+ * interface panels with internal GRAM, which are controlled by the same commands as the SPI ones.
+ *
+ * The panels on the same bus share a host (DC, WR and data lines), and are selected by their own CS lines. Just create
+ * a bus instance for each panel with the same host configuration.
+ *
+ * @note  The color data is sent in the memory order without swapping the bytes, so the 16-bit colors are sent LSB
+ *        first on an 8-bit bus, same as the SPI bus.
+ */
+class BusI80: public Bus {
+public:
+    /**
+     * @brief Default values for I80 bus configuration
+     */
+    static constexpr BasicAttributes BASIC_ATTRIBUTES_DEFAULT = {
+        .type = ESP_PANEL_BUS_TYPE_I80,
+        .name = "I80",
+    };
+    static constexpr int HOST_ID_DEFAULT = 0;
+    static constexpr int I80_DATA_WIDTH_MAX = 16;
+    static constexpr int I80_DATA_WIDTH_DEFAULT = 8;
+    static constexpr int I80_PCLK_HZ_DEFAULT = 20 * 1000 * 1000;
+    // Enough for a full frame of 320x480 RGB565, the DMA descriptors are allocated according to it
+    static constexpr int I80_MAX_TRANSFER_BYTES_DEFAULT = 320 * 480 * 2;
+
+    using HostHandle = esp_lcd_i80_bus_handle_t;
+
+    /**
+     * @brief Partial host configuration structure
+     */
+    struct HostPartialConfig {
+        int dc_gpio_num = -1;                                   ///< GPIO number for DC signal
+        int wr_gpio_num = -1;                                   ///< GPIO number for WR signal
+        std::array<int, I80_DATA_WIDTH_MAX> data_gpio_nums = {};  ///< GPIO numbers for data signals
+        int data_width = I80_DATA_WIDTH_DEFAULT;                ///< Data width (8 or 16)
+        int max_transfer_bytes = I80_MAX_TRANSFER_BYTES_DEFAULT;  ///< Maximum bytes of one transfer
+    };
+    using HostFullConfig = esp_lcd_i80_bus_config_t;
+    using HostConfig = std::variant<HostPartialConfig, HostFullConfig>;
+
+    /**
+     * @brief Partial control panel configuration structure
+     */
+    struct ControlPanelPartialConfig {
+        int cs_gpio_num = -1;                   ///< GPIO number for CS signal, set to -1 if not used
+        int pclk_hz = I80_PCLK_HZ_DEFAULT;      ///< Clock frequency of the WR signal in Hz
+        int lcd_cmd_bits = 8;                   ///< Bits for LCD commands
+        int lcd_param_bits = 8;                 ///< Bits for LCD parameters
+    };
+    using ControlPanelFullConfig = esp_lcd_panel_io_i80_config_t;
+    using ControlPanelConfig = std::variant<ControlPanelPartialConfig, ControlPanelFullConfig>;
+
+    /**
+     * @brief The I80 bus configuration structure
+     */
+    struct Config {
+        /**
+         * @brief Convert partial configurations to full configurations
+         */
+        void convertPartialToFull();
+
+        /**
+         * @brief Print host configuration for debugging
+         */
+        void printHostConfig() const;
+
+        /**
+         * @brief Print control panel configuration for debugging
+         */
+        void printControlPanelConfig() const;
+
+        int host_id = HOST_ID_DEFAULT;                                  ///< I80 host ID
+        HostConfig host = HostPartialConfig{};                          ///< Host configuration
+        ControlPanelConfig control_panel = ControlPanelPartialConfig{}; ///< Control panel configuration
+    };
+
+// *INDENT-OFF*
+    /**
+     * @brief Construct a new I80 bus instance with individual parameters
+     *
+     * Uses default values for most configurations. Call `config*()` functions to modify the default settings
+     *
+     * @param[in] cs_io GPIO number for CS signal, set to -1 if not used
+     * @param[in] dc_io GPIO number for DC signal
+     * @param[in] wr_io GPIO number for WR signal
+     * @param[in] data_ios GPIO numbers for data signals, only the first `data_width` ones are used
+     * @param[in] data_width Data width (8 or 16)
+     */
+    BusI80(
+        int cs_io, int dc_io, int wr_io, const std::array<int, I80_DATA_WIDTH_MAX> &data_ios,
+        int data_width = I80_DATA_WIDTH_DEFAULT
+    ):
+        Bus(BASIC_ATTRIBUTES_DEFAULT),
+        _config{
+            // Host
+            .host = HostPartialConfig{
+                .dc_gpio_num = dc_io,
+                .wr_gpio_num = wr_io,
+                .data_gpio_nums = data_ios,
+                .data_width = data_width,
+            },
+            // Control Panel
+            .control_panel = ControlPanelPartialConfig{
+                .cs_gpio_num = cs_io,
+            },
+        }
+    {
+    }
+
+    /**
+     * @brief Construct a new I80 bus instance with full configurations
+     *
+     * @param[in] host_config Full host configuration
+     * @param[in] control_panel_config Full control panel configuration
+     */
+    BusI80(const HostFullConfig &host_config, const ControlPanelFullConfig &control_panel_config):
+        Bus(BASIC_ATTRIBUTES_DEFAULT),
+        _config{
+            // Host
+            .host = host_config,
+            // Control Panel
+            .control_panel = control_panel_config,
+        }
+    {
+    }
+
+    /**
+     * @brief Construct a new I80 bus instance with complete configuration
+     *
+     * @param[in] config Complete I80 bus configuration
+     */
+    BusI80(const Config &config):
+        Bus(BASIC_ATTRIBUTES_DEFAULT),
+        _config(config)
+    {
+    }
+// *INDENT-ON*
+
+    /**
+     * @brief Destroy the I80 bus instance
+     */
+    ~BusI80() override;
+
+    /**
+     * @brief Configure I80 clock frequency
+     *
+     * @param[in] hz Clock frequency of the WR signal in Hz
+     * @return `true` if configuration succeeds, `false` otherwise
+     * @note This function should be called before `init()`
+     */
+    bool configI80_FreqHz(uint32_t hz);
+
+    /**
+     * @brief Configure number of bits for I80 commands
+     *
+     * @param[in] num Number of bits for commands
+     * @return `true` if configuration succeeds, `false` otherwise
+     * @note This function should be called before `init()`
+     */
+    bool configI80_CommandBits(uint32_t num);
+
+    /**
+     * @brief Configure number of bits for I80 parameters
+     *
+     * @param[in] num Number of bits for parameters
+     * @return `true` if configuration succeeds, `false` otherwise
+     * @note This function should be called before `init()`
+     */
+    bool configI80_ParamBits(uint32_t num);
+
+    /**
+     * @brief Configure I80 transaction queue depth
+     *
+     * @param[in] depth Queue depth for I80 transactions
+     * @return `true` if configuration succeeds, `false` otherwise
+     * @note This function should be called before `init()`
+     */
+    bool configI80_TransQueueDepth(uint8_t depth);
+
+    /**
+     * @brief Configure maximum bytes of one I80 transfer
+     *
+     * @param[in] bytes Maximum bytes, normally the size of the largest bitmap to draw
+     * @return `true` if configuration succeeds, `false` otherwise
+     * @note This function should be called before `init()`
+     */
+    bool configI80_MaxTransferBytes(uint32_t bytes);
+
+    /**
+     * @brief Initialize the I80 bus
+     *
+     * @return `true` if initialization succeeds, `false` otherwise
+     */
+    bool init() override;
+
+    /**
+     * @brief Start the I80 bus operation
+     *
+     * @return `true` if startup succeeds, `false` otherwise
+     */
+    bool begin() override;
+
+    /**
+     * @brief Delete the I80 bus instance and release resources
+     *
+     * @return `true` if deletion succeeds, `false` otherwise
+     */
+    bool del() override;
+
+    /**
+     * @brief Get the current bus configuration
+     *
+     * @return Reference to the current bus configuration
+     */
+    const Config &getConfig() const
+    {
+        return _config;
+    }
+
+    /**
+     * @brief Get the data width of the bus
+     *
+     * @return Data width in bits
+     */
+    int getDataWidth() const;
+
+    /**
+     * @brief Get the I80 bus host handle
+     *
+     * @return I80 bus host handle, `nullptr` if not begun
+     */
+    HostHandle getHostHandle();     // Since `HostI80` is just a forward declaration, we cannot use it here
+
+private:
+    /**
+     * @brief Get mutable reference to host full configuration
+     *
+     * Converts partial configuration to full configuration if necessary
+     *
+     * @return Reference to host full configuration
+     */
+    HostFullConfig &getHostFullConfig();
+
+    /**
+     * @brief Get mutable reference to control panel full configuration
+     *
+     * Converts partial configuration to full configuration if necessary
+     *
+     * @return Reference to control panel full configuration
+     */
+    ControlPanelFullConfig &getControlPanelFullConfig();
+
+    Config _config = {};                        ///< I80 bus configuration
+    std::shared_ptr<HostI80> _host = nullptr;   ///< I80 host instance
+};
+
+} // namespace esp_panel::drivers
+
+#endif // ESP_PANEL_DRIVERS_BUS_ENABLE_I80
@@ -525,6 +525,21 @@ bool BusRGB::configRGB_BounceBufferSize(uint32_t size_in_pixel)
     return true;
 }
 
+bool BusRGB::configRGB_NoFrameBuffer(bool en, uint32_t bits_per_pixel)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+
+    ESP_UTILS_LOGD("Param: en(%d), bits_per_pixel(%d)", en, static_cast<int>(bits_per_pixel));
+    getRefreshPanelFullConfig().flags.no_fb = en;
+    _budget.no_fb_bits_per_pixel = en ? bits_per_pixel : 0;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
 bool BusRGB::configRGB_TimingFlags(
     bool hsync_idle_low, bool vsync_idle_low, bool de_idle_high, bool pclk_active_neg, bool pclk_idle_high
 )
@@ -551,6 +566,29 @@ bool BusRGB::configRGB_TimingFlags(
     return true;
 }
 
+bool BusRGB::configRGB_BandwidthBudget(const BusRGB_Budget::Model &model, bool clamp_pclk)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+
+    ESP_UTILS_LOGD(
+        "Param: psram_bytes_per_s(%d), render_bytes_per_s(%d), headroom_percent(%d), stall_us(%d), clamp_pclk(%d)",
+        static_cast<int>(model.psram_bytes_per_s), static_cast<int>(model.render_bytes_per_s), model.headroom_percent,
+        model.stall_us, clamp_pclk
+    );
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (model.psram_bytes_per_s > 0) && (model.headroom_percent >= 0) && (model.headroom_percent < 100) &&
+        (model.stall_us >= 0), false, "Invalid model"
+    );
+    _budget.model = model;
+    _budget.clamp_pclk = clamp_pclk;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
 bool BusRGB::configSpiLine(
     bool cs_use_expander, bool sck_use_expander, bool sda_use_expander, esp_expander::Base *io_expander
 )
@@ -640,6 +678,7 @@ bool BusRGB::init()
 
     // Convert the partial configuration to full configuration
     _config.convertPartialToFull();
+    checkBandwidthBudget();
 #if ESP_UTILS_CONF_LOG_LEVEL == ESP_UTILS_LOG_LEVEL_DEBUG
     _config.printControlPanelConfig();
     _config.printRefreshPanelConfig();
@@ -713,6 +752,67 @@ BusRGB::RefreshPanelFullConfig &BusRGB::getRefreshPanelFullConfig()
     return std::get<RefreshPanelFullConfig>(_config.refresh_panel);
 }
 
+void BusRGB::checkBandwidthBudget()
+{
+    auto &config = getRefreshPanelFullConfig();
+    _budget.report = {};
+    // Without the frame buffers, the bounce buffers are filled from the application buffer, whose format is only
+    // known if it is configured
+    uint32_t bits_per_pixel = static_cast<uint32_t>(config.bits_per_pixel);
+    if (config.flags.no_fb) {
+        if (_budget.no_fb_bits_per_pixel == 0) {
+            ESP_UTILS_LOGI("Skip the bandwidth budget check, the bounce buffers are filled by the application");
+            return;
+        }
+        bits_per_pixel = _budget.no_fb_bits_per_pixel;
+    }
+
+    BusRGB_Budget::Timing timing = {
+        .pclk_hz = config.timings.pclk_hz,
+        .h_res = config.timings.h_res,
+        .v_res = config.timings.v_res,
+        .hsync_pulse_width = config.timings.hsync_pulse_width,
+        .hsync_back_porch = config.timings.hsync_back_porch,
+        .hsync_front_porch = config.timings.hsync_front_porch,
+        .vsync_pulse_width = config.timings.vsync_pulse_width,
+        .vsync_back_porch = config.timings.vsync_back_porch,
+        .vsync_front_porch = config.timings.vsync_front_porch,
+        .bits_per_pixel = bits_per_pixel,
+        .bounce_buffer_size_px = static_cast<uint32_t>(config.bounce_buffer_size_px),
+    };
+    auto &report = _budget.report;
+    if (!BusRGB_Budget::evaluate(timing, _budget.model, report)) {
+        ESP_UTILS_LOGW("Invalid timing, skip the bandwidth budget check");
+        return;
+    }
+    ESP_UTILS_LOGD(
+        "Bandwidth budget: refresh(%d Hz), scanout(%d B/s), required(%d B/s), available(%d B/s), margin(%d%%), "
+        "max pclk(%d Hz), recommended bounce size(%d px)", static_cast<int>(report.refresh_hz + 0.5f),
+        static_cast<int>(report.scanout_bytes_per_s), static_cast<int>(report.required_bytes_per_s),
+        static_cast<int>(report.available_bytes_per_s), report.margin_percent, static_cast<int>(report.max_pclk_hz),
+        static_cast<int>(report.recommended_bounce_size_px)
+    );
+    if (report.isWithinBudget()) {
+        return;
+    }
+
+    ESP_UTILS_LOGW(
+        "PSRAM bandwidth is over budget by %d%% (required %d B/s, available %d B/s), the panel might drift or tear. "
+        "Lower the pclk to %d Hz%s", -report.margin_percent, static_cast<int>(report.required_bytes_per_s),
+        static_cast<int>(report.available_bytes_per_s), static_cast<int>(report.max_pclk_hz),
+        (config.bounce_buffer_size_px == 0) ? " or enable the bounce buffers" : ""
+    );
+    if (_budget.clamp_pclk && (report.max_pclk_hz > 0)) {
+        ESP_UTILS_LOGW(
+            "Clamp pclk from %d Hz to %d Hz", static_cast<int>(config.timings.pclk_hz),
+            static_cast<int>(report.max_pclk_hz)
+        );
+        config.timings.pclk_hz = report.max_pclk_hz;
+        timing.pclk_hz = report.max_pclk_hz;
+        BusRGB_Budget::evaluate(timing, _budget.model, report);
+    }
+}
+
 } // namespace esp_panel::drivers
 
 #endif // ESP_PANEL_DRIVERS_BUS_ENABLE_RGB
@@ -16,6 +16,7 @@
 #include "esp_io_expander.hpp"
 #include "port/esp_lcd_panel_io_additions.h"
 #include "esp_panel_bus.hpp"
+#include "esp_panel_bus_rgb_budget.hpp"
 
 /**
  * @brief Define RGB data width based on SOC capabilities
@@ -472,6 +473,20 @@ public:
      */
     bool configRGB_BounceBufferSize(uint32_t size_in_pixel);
 
+    /**
+     * @brief Configure whether to allocate the frame buffers
+     *
+     * @param[in] en true: no frame buffer is allocated, the bounce buffers should be filled by the `on_bounce_empty`
+     *               callback of the refresh panel, false: allocate the frame buffers (default)
+     * @param[in] bits_per_pixel Bits per pixel of the frame buffer of the application which is read to fill the
+     *                           bounce buffers, only used by the bandwidth budget check. `0` if unknown, then the
+     *                           check is skipped
+     *
+     * @return `true` if configuration succeeds, `false` otherwise
+     * @note The bounce buffers should be enabled by `configRGB_BounceBufferSize()` when there is no frame buffer
+     */
+    bool configRGB_NoFrameBuffer(bool en, uint32_t bits_per_pixel = 0);
+
     /**
      * @brief Configure RGB timing flags
      *
@@ -487,6 +502,19 @@ public:
         bool hsync_idle_low, bool vsync_idle_low, bool de_idle_high, bool pclk_active_neg, bool pclk_idle_high
     );
 
+    /**
+     * @brief Configure the PSRAM bandwidth budget checked in `init()`
+     *
+     * The budget is always evaluated with the default model in `init()`, and a warning is printed if the timing
+     * exceeds it. See `BusRGB_Budget` for the details.
+     *
+     * @param[in] model Throughput model of the PSRAM, including the rendering load
+     * @param[in] clamp_pclk Lower the pixel clock to the highest one within the budget if exceeded
+     *
+     * @return `true` if configuration succeeds, `false` otherwise
+     */
+    bool configRGB_BandwidthBudget(const BusRGB_Budget::Model &model, bool clamp_pclk = false);
+
     /**
      * @brief Initialize the bus
      *
@@ -518,6 +546,16 @@ public:
         return _config;
     }
 
+    /**
+     * @brief Get the PSRAM bandwidth budget evaluated in `init()`
+     *
+     * @return Reference to the budget report, all zero if not initialized or there is no frame buffer
+     */
+    const BusRGB_Budget::Report &getBandwidthBudgetReport() const
+    {
+        return _budget.report;
+    }
+
     /**
      * @brief Alias for backward compatibility
      * @deprecated Use other constructors instead
@@ -695,7 +733,24 @@ private:
      */
     RefreshPanelFullConfig &getRefreshPanelFullConfig();
 
+    /**
+     * @brief Evaluate the PSRAM bandwidth budget of the refresh panel configuration, and clamp the pixel clock if
+     *        configured
+     */
+    void checkBandwidthBudget();
+
+    /**
+     * @brief PSRAM bandwidth budget structure
+     */
+    struct Budget {
+        BusRGB_Budget::Model model = {};        ///< Throughput model
+        bool clamp_pclk = false;                ///< Lower the pixel clock if over budget
+        uint32_t no_fb_bits_per_pixel = 0;      ///< Bits per pixel read with `no_fb`, `0` if unknown
+        BusRGB_Budget::Report report = {};      ///< Result of the last evaluation
+    };
+
     Config _config = {};  ///< RGB bus configuration
+    Budget _budget = {};  ///< PSRAM bandwidth budget
 };
 
 } // namespace esp_panel::drivers
@@ -0,0 +1,71 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include "esp_panel_bus_rgb_budget.hpp"
+
+namespace esp_panel::drivers {
+
+namespace {
+
+inline uint32_t clampToU32(double value)
+{
+    if (value <= 0) {
+        return 0;
+    }
+    return (value >= UINT32_MAX) ? UINT32_MAX : static_cast<uint32_t>(value);
+}
+
+} // namespace
+
+bool BusRGB_Budget::evaluate(const Timing &timing, const Model &model, Report &report)
+{
+    if ((timing.pclk_hz == 0) || (timing.h_res == 0) || (timing.v_res == 0) || (timing.bits_per_pixel == 0) ||
+            (model.psram_bytes_per_s == 0) || (model.headroom_percent < 0) || (model.headroom_percent >= 100) ||
+            (model.stall_us < 0)) {
+        return false;
+    }
+
+    double h_total = static_cast<double>(timing.h_res) + timing.hsync_pulse_width + timing.hsync_back_porch +
+                     timing.hsync_front_porch;
+    double v_total = static_cast<double>(timing.v_res) + timing.vsync_pulse_width + timing.vsync_back_porch +
+                     timing.vsync_front_porch;
+    double active_ratio = (static_cast<double>(timing.h_res) * timing.v_res) / (h_total * v_total);
+    double bytes_per_pixel = timing.bits_per_pixel / 8.0;
+
+    // Without bounce buffers, the DMA reads the frame buffer at the pixel clock rate during the active lines, so the
+    // PSRAM has to keep up with the peak rate. The bounce buffers average the reads over the whole frame.
+    bool has_bounce_buffer = (timing.bounce_buffer_size_px > 0);
+    double bytes_per_pclk = bytes_per_pixel * (has_bounce_buffer ? active_ratio : 1.0);
+    double scanout = timing.pclk_hz * bytes_per_pclk;
+    double required = scanout + model.render_bytes_per_s;
+    double available = static_cast<double>(model.psram_bytes_per_s) * (100 - model.headroom_percent) / 100;
+
+    report = {};
+    report.refresh_hz = static_cast<float>(timing.pclk_hz / (h_total * v_total));
+    report.scanout_bytes_per_s = clampToU32(scanout);
+    report.required_bytes_per_s = clampToU32(required);
+    report.available_bytes_per_s = clampToU32(available);
+    report.margin_percent = static_cast<int>(std::floor((available - required) * 100 / available));
+    report.max_pclk_hz = clampToU32((available - model.render_bytes_per_s) / bytes_per_pclk);
+
+    // A bounce buffer should hold the pixels sent during a stall, in whole lines. The driver also requires the frame
+    // to be a multiple of two bounce buffers
+    double stall_pixels = static_cast<double>(model.stall_us) * timing.pclk_hz / 1000000.0;
+    uint32_t lines = std::max<uint32_t>(1, static_cast<uint32_t>(std::ceil(stall_pixels / timing.h_res)));
+    for (; lines <= timing.v_res / 2; lines++) {
+        if ((timing.v_res % (2 * lines)) == 0) {
+            report.recommended_bounce_size_px = lines * timing.h_res;
+            break;
+        }
+    }
+
+    return true;
+}
+
+} // namespace esp_panel::drivers
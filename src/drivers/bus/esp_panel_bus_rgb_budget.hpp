@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esp_panel::drivers {
+
+/**
+ * @brief PSRAM bandwidth budget of the RGB bus
+ *
+ * The RGB peripheral streams the frame buffer from PSRAM continuously. Without bounce buffers the DMA reads it at the
+ * pixel clock rate during each active line, and with bounce buffers the CPU copies it in chunks which spreads the
+ * reads over the blanking too. Whatever the PSRAM serves for scanout is not available for rendering, so a pixel clock
+ * which looks fine on an idle system can drift or tear once the GUI starts drawing.
+ *
+ * This class estimates the bandwidth required by a timing, compares it with a throughput model and recommends the
+ * pixel clock and the bounce buffer size.
+ */
+class BusRGB_Budget {
+public:
+    static constexpr uint32_t PSRAM_BYTES_PER_S_DEFAULT = 80 * 1000 * 1000;
+    static constexpr int HEADROOM_PERCENT_DEFAULT = 20;
+    static constexpr int STALL_US_DEFAULT = 100;
+
+    /**
+     * @brief Timing of the RGB bus, same as the fields of `BusRGB::RefreshPanelPartialConfig`
+     */
+    struct Timing {
+        uint32_t pclk_hz = 0;                   ///< Pixel clock frequency in Hz
+        uint32_t h_res = 0;                     ///< Horizontal resolution
+        uint32_t v_res = 0;                     ///< Vertical resolution
+        uint32_t hsync_pulse_width = 0;         ///< HSYNC pulse width
+        uint32_t hsync_back_porch = 0;          ///< HSYNC back porch
+        uint32_t hsync_front_porch = 0;         ///< HSYNC front porch
+        uint32_t vsync_pulse_width = 0;         ///< VSYNC pulse width
+        uint32_t vsync_back_porch = 0;          ///< VSYNC back porch
+        uint32_t vsync_front_porch = 0;         ///< VSYNC front porch
+        uint32_t bits_per_pixel = 16;           ///< Bits per pixel of the frame buffer, below 8 if indexed
+        uint32_t bounce_buffer_size_px = 0;     ///< Bounce buffer size in pixels, `0` means disabled
+    };
+
+    /**
+     * @brief Throughput model of the PSRAM
+     */
+    struct Model {
+        uint32_t psram_bytes_per_s = PSRAM_BYTES_PER_S_DEFAULT; ///< Sustained PSRAM throughput in bytes per second.
+                                                                ///< The default is about what an 80 MHz octal PSRAM
+                                                                ///< delivers, use about half of it for a quad one
+        uint32_t render_bytes_per_s = 0;        ///< PSRAM traffic of the CPU and GUI rendering in bytes per second
+                                                ///< (e.g. LVGL reading and writing its draw buffers)
+        int headroom_percent = HEADROOM_PERCENT_DEFAULT; ///< Part of the throughput kept free for bursts
+        int stall_us = STALL_US_DEFAULT;        ///< Longest time the PSRAM might be unavailable (e.g. flash
+                                                ///< operations, cache misses), the bounce buffers should cover it
+    };
+
+    /**
+     * @brief Result of the budget evaluation
+     */
+    struct Report {
+        float refresh_hz = 0;                   ///< Refresh rate of the panel
+        uint32_t scanout_bytes_per_s = 0;       ///< PSRAM throughput required by the scanout
+        uint32_t required_bytes_per_s = 0;      ///< Scanout and render throughput
+        uint32_t available_bytes_per_s = 0;     ///< Throughput of the model minus the headroom
+        int margin_percent = 0;                 ///< Free part of the available throughput, negative if over budget
+        uint32_t max_pclk_hz = 0;               ///< Highest pixel clock within the budget, `0` if none
+        uint32_t recommended_bounce_size_px = 0; ///< Smallest bounce buffer covering `stall_us` at the pixel clock,
+                                                 ///< in whole lines and dividing the frame evenly
+
+        /**
+         * @brief Check if the timing fits the budget
+         *
+         * @return `true` if fits, `false` otherwise
+         */
+        bool isWithinBudget() const
+        {
+            return margin_percent >= 0;
+        }
+    };
+
+    /**
+     * @brief Evaluate the budget of a timing
+     *
+     * @param[in] timing Timing of the RGB bus
+     * @param[in] model Throughput model of the PSRAM
+     * @param[out] report Result
+     * @return `true` if successful, `false` if the parameters are invalid
+     */
+    static bool evaluate(const Timing &timing, const Model &model, Report &report);
+};
+
+} // namespace esp_panel::drivers
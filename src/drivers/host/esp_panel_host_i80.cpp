@@ -0,0 +1,78 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "soc/soc_caps.h"
+#if SOC_LCD_I80_SUPPORTED
+#include <string.h>
+#include "utils/esp_panel_utils_log.h"
+#include "esp_lcd_panel_io.h"
+#include "esp_panel_host_i80.hpp"
+
+namespace esp_panel::drivers {
+
+HostI80::~HostI80()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    if (isOverState(State::BEGIN)) {
+        int id = getID();
+        ESP_UTILS_CHECK_ERROR_EXIT(
+            esp_lcd_del_i80_bus(static_cast<esp_lcd_i80_bus_handle_t>(host_handle)), "Delete I80 host(%d) failed", id
+        );
+        ESP_UTILS_LOGD("Delete I80 host(%d)", id);
+
+        setState(State::DEINIT);
+    }
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+}
+
+bool HostI80::begin()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    if (isOverState(State::BEGIN)) {
+        goto end;
+    }
+
+    {
+        int id = getID();
+        esp_lcd_i80_bus_handle_t host = nullptr;
+        ESP_UTILS_CHECK_ERROR_RETURN(esp_lcd_new_i80_bus(&config, &host), false, "Initialize I80 host(%d) failed", id);
+        host_handle = host;
+        ESP_UTILS_LOGD("Initialize I80 host(%d)", id);
+    }
+
+    setState(State::BEGIN);
+
+end:
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool HostI80::calibrateConfig(const esp_lcd_i80_bus_config_t &config)
+{
+    if (memcmp(&config, &this->config, sizeof(esp_lcd_i80_bus_config_t))) {
+        ESP_UTILS_LOGI(
+            "Original config: dc_gpio_num(%d), wr_gpio_num(%d), bus_width(%d), max_transfer_bytes(%d)",
+            this->config.dc_gpio_num, this->config.wr_gpio_num, static_cast<int>(this->config.bus_width),
+            static_cast<int>(this->config.max_transfer_bytes)
+        );
+        ESP_UTILS_LOGI(
+            "New config: dc_gpio_num(%d), wr_gpio_num(%d), bus_width(%d), max_transfer_bytes(%d)",
+            config.dc_gpio_num, config.wr_gpio_num, static_cast<int>(config.bus_width),
+            static_cast<int>(config.max_transfer_bytes)
+        );
+        ESP_UTILS_CHECK_FALSE_RETURN(false, false, "Config mismatch");
+    }
+
+    return true;
+}
+
+} // namespace esp_panel::drivers
+
+#endif // SOC_LCD_I80_SUPPORTED
@@ -0,0 +1,62 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "soc/soc_caps.h"
+#if SOC_LCD_I80_SUPPORTED
+#include "esp_lcd_panel_io.h"
+#include "esp_panel_host.hpp"
+
+namespace esp_panel::drivers {
+
+/**
+ * @brief I80 (Intel 8080 parallel) bus host class
+ *
+ * The panels on the same bus share the DC, WR and data lines, and are selected by their own CS lines
+ */
+class HostI80 : public Host<HostI80, esp_lcd_i80_bus_config_t, SOC_LCD_I80_BUSES> {
+public:
+    /* Add friend class to allow them to access the private member */
+    template <typename U>
+    friend struct esp_utils::GeneralMemoryAllocator;    // To access `HostI80()`
+    template <class Instance, typename Config, int N>
+    friend class Host;                                  // To access `del()`, `calibrateConfig()`
+
+    /**
+     * @brief Destroy the host
+     */
+    ~HostI80() override;
+
+    /**
+     * @brief Startup the host
+     *
+     * @return `true` if successful, `false` otherwise
+     */
+    bool begin() override;
+
+private:
+    /**
+     * @brief Private constructor to prevent direct instantiation
+     *
+     * @param[in] id Host ID
+     * @param[in] config Host configuration
+     */
+    HostI80(int id, const esp_lcd_i80_bus_config_t &config):
+        Host<HostI80, esp_lcd_i80_bus_config_t, SOC_LCD_I80_BUSES>(id, config) {}
+
+    /**
+     * @brief Calibrate configuration when host already exists
+     *
+     * @param[in] config New configuration
+     * @return `true` if successful, `false` otherwise
+     */
+    bool calibrateConfig(const esp_lcd_i80_bus_config_t &config) override;
+};
+
+} // namespace esp_panel::drivers
+
+#endif // SOC_LCD_I80_SUPPORTED
@@ -9,9 +9,12 @@
 #include <numeric>
 #include "sdkconfig.h"
 #include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "driver/gpio.h"
 #include "esp_lcd_panel_ops.h"
 #include "esp_lcd_panel_io.h"
 #include "esp_memory_utils.h"
+#include "freertos/task.h"
 #include "driver/spi_master.h"
 #include "utils/esp_panel_utils_log.h"
 #include "esp_panel_lcd.hpp"
@@ -353,6 +356,31 @@ bool LCD::configResetActiveLevel(int level)
     return true;
 }
 
+bool LCD::configTearingEffectIO(int gpio_num, int active_level)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::BEGIN), false, "Should be called before `begin()`");
+    ESP_UTILS_CHECK_FALSE_RETURN(isBusValid(), false, "Invalid bus");
+
+    ESP_UTILS_LOGD("Param: gpio_num(%d), active_level(%d)", gpio_num, active_level);
+
+    auto bus_type = getBus()->getBasicAttributes().type;
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (gpio_num < 0) || (bus_type == ESP_PANEL_BUS_TYPE_SPI) || (bus_type == ESP_PANEL_BUS_TYPE_QSPI) ||
+        (bus_type == ESP_PANEL_BUS_TYPE_I80), false, "Only valid for SPI, QSPI and I80 bus"
+    );
+
+    _config.tearing_effect = {
+        .gpio_num = gpio_num,
+        .active_level = active_level,
+    };
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
 bool LCD::configFrameBufferNumber(int num)
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
@@ -392,6 +420,102 @@ bool LCD::configFrameBufferNumber(int num)
     return true;
 }
 
+bool LCD::configIndexedFrameBuffer(LCD_Palette::IndexFormat format)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+    ESP_UTILS_CHECK_FALSE_RETURN(isBusValid(), false, "Invalid bus");
+
+    ESP_UTILS_LOGD("Param: format(%d)", static_cast<int>(format));
+    ESP_UTILS_CHECK_FALSE_RETURN(format <= LCD_Palette::IndexFormat::I8, false, "Invalid format");
+
+    auto bus_type = getBus()->getBasicAttributes().type;
+    switch (bus_type) {
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_RGB
+    case ESP_PANEL_BUS_TYPE_RGB: {
+        // The frame buffers of the driver are replaced by the indexed one, which is expanded in `onBounceEmpty()`. It
+        // is still read from PSRAM at the scanout rate, so the bandwidth budget is checked with its bits per pixel
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            static_cast<BusRGB *>(getBus())->configRGB_NoFrameBuffer(true, LCD_Palette::getBitsPerIndex(format)),
+            false, "Config RGB no frame buffer failed"
+        );
+        break;
+    }
+#endif // ESP_PANEL_DRIVERS_BUS_ENABLE_RGB
+    default:
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            false, false, "Bus(%d[%s]) is invalid for this function", bus_type,
+            BusFactory::getTypeNameString(bus_type).c_str()
+        );
+        break;
+    }
+    // Only allocated for the indexed mode, the other panels don't carry the color tables
+    if (_indexed_frame_buffer.palette == nullptr) {
+        ESP_UTILS_CHECK_EXCEPTION_RETURN(
+            _indexed_frame_buffer.palette = utils::make_shared<LCD_Palette>(), false, "Create palette failed"
+        );
+    }
+    _indexed_frame_buffer.is_enabled = true;
+    _indexed_frame_buffer.format = format;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool LCD::configRefreshRecovery(bool en, int tolerance_percent)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::BEGIN), false, "Should be called before `begin()`");
+    ESP_UTILS_CHECK_FALSE_RETURN(isBusValid(), false, "Invalid bus");
+
+    ESP_UTILS_LOGD("Param: en(%d), tolerance_percent(%d)", en, tolerance_percent);
+    ESP_UTILS_CHECK_FALSE_RETURN(tolerance_percent >= 0, false, "Invalid tolerance");
+
+    auto bus_type = getBus()->getBasicAttributes().type;
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        bus_type == ESP_PANEL_BUS_TYPE_RGB, false, "Bus(%d[%s]) is invalid for this function", bus_type,
+        BusFactory::getTypeNameString(bus_type).c_str()
+    );
+
+    // Only the bounce buffer fills done by `onBounceEmpty()` show the underruns, the frame interrupts don't
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        !en || _indexed_frame_buffer.is_enabled, false,
+        "Only supported with the indexed frame buffer, call `configIndexedFrameBuffer()` first"
+    );
+
+    _refresh_monitor.is_enabled = en;
+    _refresh_monitor.tolerance_percent = tolerance_percent;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool LCD::configStreamBufferSize(size_t size)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::BEGIN), false, "Should be called before `begin()`");
+    ESP_UTILS_CHECK_FALSE_RETURN(isBusValid(), false, "Invalid bus");
+
+    ESP_UTILS_LOGD("Param: size(%d)", static_cast<int>(size));
+
+    auto bus_type = getBus()->getBasicAttributes().type;
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (bus_type != ESP_PANEL_BUS_TYPE_RGB) && (bus_type != ESP_PANEL_BUS_TYPE_MIPI_DSI), false,
+        "This function is not supported"
+    );
+
+    _stream.buffer_size = size;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
 bool LCD::begin()
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
@@ -426,9 +550,49 @@ bool LCD::begin()
         _interruption.draw_bitmap_finish_sem =
             xSemaphoreCreateBinaryStatic(_interruption.on_draw_bitmap_finish_sem_buffer.get());
     }
+    /* For non-RGB bus, create Semaphore to limit the number of in-flight drawings to the bus queue depth */
+    _interruption.draw_bitmap_queue_depth = getBusDrawBitmapQueueDepth();
+    if ((bus_type != ESP_PANEL_BUS_TYPE_RGB) && (_interruption.draw_bitmap_slot_sem == nullptr)) {
+        _interruption.draw_bitmap_slot_sem_buffer = utils::make_shared<StaticSemaphore_t>();
+        ESP_UTILS_CHECK_NULL_RETURN(
+            _interruption.draw_bitmap_slot_sem_buffer, false, "Create draw bitmap slot semaphore failed"
+        );
+        _interruption.draw_bitmap_slot_sem = xSemaphoreCreateCountingStatic(
+            _interruption.draw_bitmap_queue_depth, _interruption.draw_bitmap_queue_depth,
+            _interruption.draw_bitmap_slot_sem_buffer.get()
+        );
+    }
+    ESP_UTILS_LOGD("Draw bitmap queue depth: %d", _interruption.draw_bitmap_queue_depth);
+
+    /* Allocate the internal ping-pong buffers for streaming bitmaps which are not DMA-capable */
+    if ((_stream.buffer_size > 0) && (_stream.buffers[0] == nullptr)) {
+        for (int i = 0; i < STREAM_BUFFER_NUM; i++) {
+            _stream.buffers[i] = std::shared_ptr<uint8_t>(
+                static_cast<uint8_t *>(heap_caps_malloc(_stream.buffer_size, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL)),
+                heap_caps_free
+            );
+            ESP_UTILS_CHECK_NULL_RETURN(
+                _stream.buffers[i], false, "Allocate stream buffer(%d bytes) failed",
+                static_cast<int>(_stream.buffer_size)
+            );
+        }
+        ESP_UTILS_LOGD(
+            "Stream buffers(%d bytes x %d) allocated", static_cast<int>(_stream.buffer_size), STREAM_BUFFER_NUM
+        );
+    }
+
+#if ESP_PANEL_DRIVERS_LCD_ENABLE_STATS
+    // The counters are updated by the interrupts, so the lock should be ready before the callbacks are registered
+    if (!_stats.is_started) {
+        portMUX_INITIALIZE(&_stats.lock);
+        _stats.is_started = true;
+    }
+    resetStats();
+#endif
 
     /*  Register callback for different bus */
     _interruption.data.lcd_ptr = this;
+    portMUX_INITIALIZE(&_interruption.lock);
     switch (bus_type) {
 #if ESP_PANEL_DRIVERS_BUS_ENABLE_RGB
     case ESP_PANEL_BUS_TYPE_RGB: {
@@ -436,6 +600,37 @@ bool LCD::begin()
         ESP_UTILS_CHECK_NULL_RETURN(rgb_config, false, "Invalid RGB config");
 
         esp_lcd_rgb_panel_event_callbacks_t rgb_event_cb = {};
+        if (_indexed_frame_buffer.is_enabled) {
+            ESP_UTILS_CHECK_FALSE_RETURN(
+                rgb_config->bounce_buffer_size_px > 0, false, "Bounce buffer is required for indexed frame buffer"
+            );
+            ESP_UTILS_CHECK_FALSE_RETURN(
+                (rgb_config->bits_per_pixel == 16) || (rgb_config->bits_per_pixel == 24), false,
+                "Color bits(%d) is not supported for indexed frame buffer", static_cast<int>(rgb_config->bits_per_pixel)
+            );
+            auto &indexed = _indexed_frame_buffer;
+            auto pixel_format = (rgb_config->bits_per_pixel == 16) ? LCD_ColorConvert::PixelFormat::RGB565 :
+                                LCD_ColorConvert::PixelFormat::RGB888;
+            ESP_UTILS_CHECK_FALSE_RETURN(
+                indexed.palette->configure(indexed.format, pixel_format), false, "Configure palette failed"
+            );
+            indexed.bytes_per_pixel = rgb_config->bits_per_pixel / 8;
+
+            if (indexed.buffer == nullptr) {
+                size_t size = LCD_Palette::getFrameBufferSize(indexed.format, getFrameWidth(), getFrameHeight());
+                // Prefer PSRAM, which is what the indexed frame buffer saves
+                auto buffer = static_cast<uint8_t *>(heap_caps_calloc(1, size, MALLOC_CAP_SPIRAM));
+                if (buffer == nullptr) {
+                    buffer = static_cast<uint8_t *>(heap_caps_calloc(1, size, MALLOC_CAP_8BIT));
+                }
+                ESP_UTILS_CHECK_NULL_RETURN(
+                    buffer, false, "Allocate indexed frame buffer(%d bytes) failed", static_cast<int>(size)
+                );
+                indexed.buffer = std::shared_ptr<uint8_t>(buffer, heap_caps_free);
+                ESP_UTILS_LOGD("Indexed frame buffer(@%p, %d bytes) allocated", buffer, static_cast<int>(size));
+            }
+            rgb_event_cb.on_bounce_empty = (esp_lcd_rgb_panel_bounce_buf_fill_cb_t)onBounceEmpty;
+        }
 #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 4, 0)
         rgb_event_cb.on_frame_buf_complete = (esp_lcd_rgb_panel_frame_buf_complete_cb_t)onRefreshFinish;
 #else
@@ -451,6 +646,48 @@ bool LCD::begin()
             esp_lcd_rgb_panel_register_event_callbacks(refresh_panel, &rgb_event_cb, &_interruption.data), false,
             "Register RGB event callback failed"
         );
+
+        /* Detect the refresh underruns from the bounce buffer fill timestamps, and restart the transmission on them */
+        auto &refresh_monitor = _refresh_monitor;
+        if (refresh_monitor.is_enabled && (refresh_monitor.timer == nullptr)) {
+            ESP_UTILS_CHECK_FALSE_RETURN(
+                _indexed_frame_buffer.is_enabled, false, "Refresh recovery requires the indexed frame buffer"
+            );
+            ESP_UTILS_CHECK_FALSE_RETURN(
+                !rgb_config->flags.refresh_on_demand, false, "Refresh recovery is not supported in refresh on demand"
+            );
+            auto &timings = rgb_config->timings;
+            ESP_UTILS_CHECK_FALSE_RETURN(timings.pclk_hz > 0, false, "Invalid pixel clock");
+            uint64_t h_total = timings.h_res + timings.hsync_pulse_width + timings.hsync_back_porch +
+                               timings.hsync_front_porch;
+            uint64_t v_total = timings.v_res + timings.vsync_pulse_width + timings.vsync_back_porch +
+                               timings.vsync_front_porch;
+            uint32_t frame_period_us = h_total * v_total * 1000000 / timings.pclk_hz;
+            uint32_t bounce_period_us = static_cast<uint64_t>(rgb_config->bounce_buffer_size_px) * h_total * 1000000 /
+                                        (static_cast<uint64_t>(timings.h_res) * timings.pclk_hz);
+            portMUX_INITIALIZE(&refresh_monitor.lock);
+            refresh_monitor.monitor.configure(frame_period_us, bounce_period_us, refresh_monitor.tolerance_percent);
+
+            esp_timer_create_args_t timer_args = {
+                .callback = onRefreshRecoveryTimer,
+                .arg = this,
+                .dispatch_method = ESP_TIMER_TASK,
+                .name = "lcd_refresh",
+                .skip_unhandled_events = true,
+            };
+            ESP_UTILS_CHECK_ERROR_RETURN(
+                esp_timer_create(&timer_args, &refresh_monitor.timer), false, "Create refresh recovery timer failed"
+            );
+            ESP_UTILS_CHECK_ERROR_RETURN(
+                esp_timer_start_periodic(refresh_monitor.timer, REFRESH_RECOVERY_CHECK_PERIOD_MS * 1000), false,
+                "Start refresh recovery timer failed"
+            );
+            refresh_monitor.is_started = true;
+            ESP_UTILS_LOGD(
+                "Refresh recovery enabled, frame period(%d us), bounce period(%d us)",
+                static_cast<int>(frame_period_us), static_cast<int>(bounce_period_us)
+            );
+        }
         break;
     }
 #endif
@@ -478,6 +715,44 @@ bool LCD::begin()
         break;
     }
 
+    /* Timestamp the TE pulses to schedule the drawings, only for the bus without frame buffers */
+    if ((_config.tearing_effect.gpio_num >= 0) && (_tear_sync == nullptr)) {
+        auto &te_config = _config.tearing_effect;
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            (bus_type == ESP_PANEL_BUS_TYPE_SPI) || (bus_type == ESP_PANEL_BUS_TYPE_QSPI) ||
+            (bus_type == ESP_PANEL_BUS_TYPE_I80), false, "TE pin is only valid for SPI, QSPI and I80 bus"
+        );
+        // Only allocated with the TE pin
+        std::shared_ptr<TearSyncContext> tear_sync = nullptr;
+        ESP_UTILS_CHECK_EXCEPTION_RETURN(
+            tear_sync = utils::make_shared<TearSyncContext>(), false, "Create TE context failed"
+        );
+        portMUX_INITIALIZE(&tear_sync->lock);
+        tear_sync->sync.configure(getFrameHeight());
+        tear_sync->sem = xSemaphoreCreateBinaryStatic(&tear_sync->sem_buffer);
+
+        gpio_config_t io_config = {
+            .pin_bit_mask = BIT64(te_config.gpio_num),
+            .mode = GPIO_MODE_INPUT,
+            .pull_up_en = GPIO_PULLUP_DISABLE,
+            .pull_down_en = GPIO_PULLDOWN_DISABLE,
+            .intr_type = te_config.active_level ? GPIO_INTR_POSEDGE : GPIO_INTR_NEGEDGE,
+        };
+        ESP_UTILS_CHECK_ERROR_RETURN(gpio_config(&io_config), false, "Config TE pin failed");
+        // The ISR service might be installed by others before
+        esp_err_t ret = gpio_install_isr_service(0);
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            (ret == ESP_OK) || (ret == ESP_ERR_INVALID_STATE), false, "Install GPIO ISR service failed"
+        );
+        ESP_UTILS_CHECK_ERROR_RETURN(
+            gpio_isr_handler_add(static_cast<gpio_num_t>(te_config.gpio_num), onTearingEffect, &_interruption.data),
+            false, "Add TE pin ISR handler failed"
+        );
+        // The interrupt ignores the pulses until the context is set
+        _tear_sync = tear_sync;
+        ESP_UTILS_LOGD("TE pin(%d) enabled", te_config.gpio_num);
+    }
+
 end:
     setState(State::BEGIN);
 
@@ -517,6 +792,24 @@ bool LCD::del()
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
 
+    if (_tear_sync != nullptr) {
+        ESP_UTILS_CHECK_ERROR_RETURN(
+            gpio_isr_handler_remove(static_cast<gpio_num_t>(_config.tearing_effect.gpio_num)), false,
+            "Remove TE pin ISR handler failed"
+        );
+        _tear_sync = nullptr;
+    }
+
+    if (_refresh_monitor.timer != nullptr) {
+        _refresh_monitor.is_started = false;
+        // The timer might be stopped already if it is not started successfully
+        esp_timer_stop(_refresh_monitor.timer);
+        ESP_UTILS_CHECK_ERROR_RETURN(
+            esp_timer_delete(_refresh_monitor.timer), false, "Delete refresh recovery timer failed"
+        );
+        _refresh_monitor.timer = nullptr;
+    }
+
     if (refresh_panel != nullptr) {
         ESP_UTILS_CHECK_ERROR_RETURN(
             esp_lcd_panel_del(refresh_panel), false, "Delete refresh panel(@%p) failed", refresh_panel
@@ -527,6 +820,17 @@ bool LCD::del()
 
     _transformation = {};
     _interruption = {};
+    // Only release the stream buffers, keep the configurations
+    _stream = Stream{_stream.buffer_size, _stream.transform, _stream.swap_bytes, _stream.dither};
+    _fill = {};
+    _swap_chain = nullptr;
+    // Only release the indexed frame buffer, keep the configurations
+    _indexed_frame_buffer.buffer = nullptr;
+    // Only reset the counters, keep the configurations
+    _refresh_monitor.monitor = {};
+#if ESP_PANEL_DRIVERS_LCD_ENABLE_STATS
+    _stats.is_started = false;
+#endif
 
     setState(State::DEINIT);
 
@@ -539,70 +843,20 @@ bool LCD::drawBitmap(int x_start, int y_start, int width, int height, const uint
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
 
-    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
-
     ESP_UTILS_LOGD(
         "Param: x_start(%d), y_start(%d), width(%d), height(%d), color_data(@%p), timeout_ms(%d)",
         x_start, y_start, width, height, color_data, timeout_ms
     );
 
-    // Check basic parameters validity
-    ESP_UTILS_CHECK_FALSE_RETURN(
-        (x_start >= 0) && (y_start >= 0), false, "Invalid start coordinates: (%d,%d)", x_start, y_start
-    );
-    ESP_UTILS_CHECK_FALSE_RETURN((width >= 0) && (height >= 0), false, "Invalid dimensions: (%d,%d)", width, height);
+    DrawBitmapToken token = 0;
     ESP_UTILS_CHECK_FALSE_RETURN(
-        ((width == 0) && (height == 0)) || (color_data != nullptr), false, "Invalid color_data"
-    );
-
-    // Get display parameters
-    auto swap_xy = getTransformation().swap_xy;
-    auto frame_width = getFrameWidth();
-    auto frame_height = getFrameHeight();
-    auto x_align = getBasicAttributes().basic_bus_spec.x_coord_align;
-    auto y_align = getBasicAttributes().basic_bus_spec.y_coord_align;
-    auto x_end = x_start + width;
-    auto y_end = y_start + height;
-
-    // Check boundary limits
-    auto max_x = swap_xy ? frame_height : frame_width;
-    auto max_y = swap_xy ? frame_width : frame_height;
-    if (frame_width > 0) {
-        ESP_UTILS_CHECK_FALSE_RETURN(x_end <= max_x, false, "x_end(%d) exceeds display limit(%d)", x_end, max_x);
-    }
-    if (frame_height > 0) {
-        ESP_UTILS_CHECK_FALSE_RETURN(y_end <= max_y, false, "y_end(%d) exceeds display limit(%d)", y_end, max_y);
-    }
-
-    // Check coordinate alignment
-    if (x_start & (x_align - 1)) {
-        ESP_UTILS_LOGW("x_start(%d) not aligned to %d", x_start, x_align);
-    } else if (width & (x_align - 1)) {
-        ESP_UTILS_LOGW("width(%d) not aligned to %d", width, x_align);
-    }
-    if (y_start & (y_align - 1)) {
-        ESP_UTILS_LOGW("y_start(%d) not aligned to %d", y_start, y_align);
-    } else if (height & (y_align - 1)) {
-        ESP_UTILS_LOGW("height(%d) not aligned to %d", height, y_align);
-    }
-
-    // Send data to the panel
-    ESP_UTILS_CHECK_ERROR_RETURN(
-        esp_lcd_panel_draw_bitmap(refresh_panel, x_start, y_start, x_end, y_end, color_data), false,
-        "Draw bitmap failed"
+        drawBitmapAsync(x_start, y_start, width, height, color_data, &token), false, "Draw bitmap failed"
     );
 
-    // For RGB bus, since `drawBitmap()` uses `memcpy()` instead of DMA operation, doesn't need to wait for finish
-    if ((getBus()->getBasicAttributes().type == ESP_PANEL_BUS_TYPE_RGB) &&
-            (_interruption.on_draw_bitmap_finish != nullptr)) {
-        _interruption.on_draw_bitmap_finish(_interruption.data.user_data);
-    }
-    /* Otherwise, wait for the semaphore to be given by the callback function */
-    if ((_interruption.draw_bitmap_finish_sem != nullptr) && (timeout_ms != 0)) {
-        BaseType_t timeout_tick = (timeout_ms < 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    /* Wait for this drawing to be finished by the callback function */
+    if (timeout_ms != 0) {
         ESP_UTILS_CHECK_FALSE_RETURN(
-            xSemaphoreTake(_interruption.draw_bitmap_finish_sem, timeout_tick) == pdTRUE, false,
-            "Draw bitmap wait for finish timeout"
+            waitDrawBitmapFinish(token, timeout_ms), false, "Draw bitmap wait for finish timeout"
         );
     }
 
@@ -611,85 +865,448 @@ bool LCD::drawBitmap(int x_start, int y_start, int width, int height, const uint
     return true;
 }
 
-bool LCD::mirrorX(bool en)
+bool LCD::drawBitmapAsync(
+    int x_start, int y_start, int width, int height, const uint8_t *color_data, DrawBitmapToken *token,
+    int timeout_ms
+)
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
 
-    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::INIT), false, "Not initialized");
-    ESP_UTILS_CHECK_FALSE_RETURN(
-        isFunctionSupported(BasicBusSpecification::FUNC_MIRROR_X), false, "This function is not supported"
+    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
+
+    ESP_UTILS_LOGD(
+        "Param: x_start(%d), y_start(%d), width(%d), height(%d), color_data(@%p), token(@%p), timeout_ms(%d)",
+        x_start, y_start, width, height, color_data, token, timeout_ms
     );
 
-    ESP_UTILS_LOGD("Param: en(%d)", en);
-    ESP_UTILS_CHECK_ERROR_RETURN(
-        esp_lcd_panel_mirror(refresh_panel, en, _transformation.mirror_y), false, "Mirror X failed"
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        checkDrawBitmapParams(x_start, y_start, width, height, color_data), false, "Invalid parameters"
     );
-    _transformation.mirror_x = en;
+
+    DrawBitmapToken submit_token = 0;
+    if (isStreamRequired(color_data)) {
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            drawBitmapByStream(x_start, y_start, width, height, color_data, 0, nullptr, submit_token, timeout_ms),
+            false, "Draw bitmap by stream failed"
+        );
+    } else {
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            drawBitmapDirect(
+                x_start, y_start, x_start + width, y_start + height, color_data, submit_token, timeout_ms
+            ), false, "Draw bitmap failed"
+        );
+    }
+
+    if (token != nullptr) {
+        *token = submit_token;
+    }
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
     return true;
 }
 
-bool LCD::mirrorY(bool en)
+bool LCD::drawBitmap(
+    int x_start, int y_start, int width, int height, const uint8_t *color_data,
+    LCD_ColorConvert::PixelFormat color_format, int timeout_ms
+)
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
 
-    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::INIT), false, "Not initialized");
-    ESP_UTILS_CHECK_FALSE_RETURN(
-        isFunctionSupported(BasicBusSpecification::FUNC_MIRROR_Y), false, "This function is not supported"
+    ESP_UTILS_LOGD(
+        "Param: x_start(%d), y_start(%d), width(%d), height(%d), color_data(@%p), color_format(%d), timeout_ms(%d)",
+        x_start, y_start, width, height, color_data, static_cast<int>(color_format), timeout_ms
     );
 
-    ESP_UTILS_LOGD("Param: en(%d)", en);
-    ESP_UTILS_CHECK_ERROR_RETURN(
-        esp_lcd_panel_mirror(refresh_panel, _transformation.mirror_x, en), false, "Mirror X failed"
+    DrawBitmapToken token = 0;
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        drawBitmapAsync(x_start, y_start, width, height, color_data, color_format, &token), false,
+        "Draw bitmap failed"
     );
-    _transformation.mirror_y = en;
+
+    if (timeout_ms != 0) {
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            waitDrawBitmapFinish(token, timeout_ms), false, "Draw bitmap wait for finish timeout"
+        );
+    }
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
     return true;
 }
 
-bool LCD::swapXY(bool en)
+bool LCD::drawBitmapAsync(
+    int x_start, int y_start, int width, int height, const uint8_t *color_data,
+    LCD_ColorConvert::PixelFormat color_format, DrawBitmapToken *token, int timeout_ms
+)
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
 
-    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::INIT), false, "Not initialized");
+    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
+
+    ESP_UTILS_LOGD(
+        "Param: x_start(%d), y_start(%d), width(%d), height(%d), color_data(@%p), color_format(%d), token(@%p), "
+        "timeout_ms(%d)", x_start, y_start, width, height, color_data, static_cast<int>(color_format), token,
+        timeout_ms
+    );
+
+    int bits_per_pixel = getFrameColorBits();
+    LCD_ColorConvert::PixelFormat panel_format = {};
     ESP_UTILS_CHECK_FALSE_RETURN(
-        isFunctionSupported(BasicBusSpecification::FUNC_SWAP_XY), false, "This function is not supported"
+        LCD_ColorConvert::getPixelFormatByBits(bits_per_pixel, panel_format), false,
+        "Color bits(%d) is not supported for conversion", bits_per_pixel
     );
 
-    ESP_UTILS_LOGD("Param: en(%d)", en);
-    ESP_UTILS_CHECK_ERROR_RETURN(esp_lcd_panel_swap_xy(refresh_panel, en), false, "Swap XY failed");
-    _transformation.swap_xy = en;
+    // Nothing to convert, draw it as usual
+    if (color_format == panel_format) {
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            drawBitmapAsync(x_start, y_start, width, height, color_data, token, timeout_ms), false, "Draw bitmap failed"
+        );
+        goto end;
+    }
+
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        _stream.buffers[0] != nullptr, false,
+        "Stream buffer is required for conversion, call `configStreamBufferSize()` first"
+    );
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        checkDrawBitmapParams(x_start, y_start, width, height, color_data), false, "Invalid parameters"
+    );
+
+    {
+        DrawBitmapToken submit_token = 0;
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            drawBitmapByStream(
+                x_start, y_start, width, height, color_data, 0, &color_format, submit_token, timeout_ms
+            ), false, "Draw bitmap by stream failed"
+        );
+        if (token != nullptr) {
+            *token = submit_token;
+        }
+    }
 
+end:
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
     return true;
 }
 
-bool LCD::setGapX(uint16_t gap)
+bool LCD::waitDrawBitmapFinish(DrawBitmapToken token, int timeout_ms)
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
 
-    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::INIT), false, "Not initialized");
+    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
     ESP_UTILS_CHECK_FALSE_RETURN(
-        isFunctionSupported(BasicBusSpecification::FUNC_GAP), false, "This function is not supported"
+        static_cast<int32_t>(_interruption.draw_bitmap_submit_count - token) >= 0, false,
+        "Invalid token(%d)", static_cast<int>(token)
     );
 
-    ESP_UTILS_LOGD("Param: gap(%d)", static_cast<int>(gap));
-    ESP_UTILS_CHECK_ERROR_RETURN(
-        esp_lcd_panel_set_gap(refresh_panel, gap, _transformation.gap_y), false, "Set X gap failed"
+    if (isDrawBitmapFinished(token)) {
+        goto end;
+    }
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (_interruption.draw_bitmap_finish_sem != nullptr) && (timeout_ms != 0), false, "Draw bitmap not finished"
     );
-    _transformation.gap_x = gap;
 
+    {
+#if ESP_PANEL_DRIVERS_LCD_ENABLE_STATS
+        int64_t wait_start_us = esp_timer_get_time();
+#endif
+        /* The semaphore is given once per finished drawing, so check the token again each time it is taken */
+        TickType_t start_tick = xTaskGetTickCount();
+        TickType_t timeout_tick = (timeout_ms < 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+        TickType_t wait_tick = timeout_tick;
+        while (!isDrawBitmapFinished(token)) {
+            if (timeout_ms > 0) {
+                TickType_t elapsed_tick = xTaskGetTickCount() - start_tick;
+                ESP_UTILS_CHECK_FALSE_RETURN(
+                    elapsed_tick < timeout_tick, false, "Wait for token(%d) timeout", static_cast<int>(token)
+                );
+                wait_tick = timeout_tick - elapsed_tick;
+            }
+            xSemaphoreTake(_interruption.draw_bitmap_finish_sem, wait_tick);
+        }
+#if ESP_PANEL_DRIVERS_LCD_ENABLE_STATS
+        int64_t wait_us = esp_timer_get_time() - wait_start_us;
+        portENTER_CRITICAL(&_stats.lock);
+        _stats.stats.onWaitFinish(wait_us);
+        portEXIT_CRITICAL(&_stats.lock);
+#endif
+    }
+
+end:
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
     return true;
 }
 
-bool LCD::setGapY(uint16_t gap)
+bool LCD::waitDrawBitmapFinishAll(int timeout_ms)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        waitDrawBitmapFinish(_interruption.draw_bitmap_submit_count, timeout_ms), false,
+        "Wait for all drawings finish failed"
+    );
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool LCD::setDrawBitmapTransform(const LCD_Transform::Operation &operation)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_LOGD(
+        "Param: rotation(%d), mirror_x(%d), mirror_y(%d)", static_cast<int>(operation.rotation), operation.mirror_x,
+        operation.mirror_y
+    );
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        operation.isIdentity() || (_stream.buffer_size > 0), false,
+        "Stream buffer is required, call `configStreamBufferSize()` first"
+    );
+
+    // Make sure the previous bitmaps are finished before the coordinates change
+    if (isOverState(State::BEGIN)) {
+        ESP_UTILS_CHECK_FALSE_RETURN(waitDrawBitmapFinishAll(), false, "Wait for drawings finish failed");
+    }
+    _stream.transform = operation;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool LCD::setDrawBitmapSwapBytes(bool en)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_LOGD("Param: en(%d)", en);
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        !en || (_stream.buffer_size > 0), false, "Stream buffer is required, call `configStreamBufferSize()` first"
+    );
+
+    // Make sure the previous bitmaps are finished before the byte order changes
+    if (isOverState(State::BEGIN)) {
+        ESP_UTILS_CHECK_FALSE_RETURN(waitDrawBitmapFinishAll(), false, "Wait for drawings finish failed");
+    }
+    _stream.swap_bytes = en;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool LCD::setDrawBitmapDither(bool en)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_LOGD("Param: en(%d)", en);
+
+    // Make sure the previous bitmaps are finished before the conversion changes
+    if (isOverState(State::BEGIN)) {
+        ESP_UTILS_CHECK_FALSE_RETURN(waitDrawBitmapFinishAll(), false, "Wait for drawings finish failed");
+    }
+    _stream.dither = en;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool LCD::invalidateRect(int x_start, int y_start, int width, int height)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
+
+    ESP_UTILS_LOGD("Param: x_start(%d), y_start(%d), width(%d), height(%d)", x_start, y_start, width, height);
+    ESP_UTILS_CHECK_FALSE_RETURN((width >= 0) && (height >= 0), false, "Invalid dimensions: (%d,%d)", width, height);
+
+    // Only allocated once used, the drawings without a shadow buffer don't need it
+    if (_damage == nullptr) {
+        ESP_UTILS_CHECK_EXCEPTION_RETURN(
+            _damage = utils::make_shared<LCD_DamageTracker>(), false, "Create damage tracker failed"
+        );
+    }
+    updateDamageConfig();
+    _damage->add({x_start, y_start, width, height});
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool LCD::flushDamage(const uint8_t *shadow_buffer, int timeout_ms)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
+
+    ESP_UTILS_LOGD("Param: shadow_buffer(@%p), timeout_ms(%d)", shadow_buffer, timeout_ms);
+    ESP_UTILS_CHECK_NULL_RETURN(shadow_buffer, false, "Invalid shadow buffer");
+
+    if (_damage == nullptr) {
+        ESP_UTILS_LOGD("No damage to flush");
+        ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+        return true;
+    }
+
+    int bits_per_pixel = getFrameColorBits();
+    int bytes_per_pixel = LCD_Transform::getBytesPerPixel(bits_per_pixel);
+    ESP_UTILS_CHECK_FALSE_RETURN(bytes_per_pixel > 0, false, "Invalid color bits(%d)", bits_per_pixel);
+
+    // The panels with frame buffers copy the lines of a window into the frame buffer, no stream buffer is needed
+    auto bus_type = getBus()->getBasicAttributes().type;
+    bool is_frame_buffer_bus = (bus_type == ESP_PANEL_BUS_TYPE_RGB) || (bus_type == ESP_PANEL_BUS_TYPE_MIPI_DSI);
+
+    // The rectangles are cleared if the coordinate space changed since they were added
+    updateDamageConfig();
+    auto &config = _damage->getConfig();
+    auto rects = _damage->getRects();
+    int rect_num = _damage->getRectNum();
+    size_t stride = config.width * bytes_per_pixel;
+    DrawBitmapToken token = 0;
+    for (int i = 0; i < rect_num; i++) {
+        auto &rect = rects[i];
+        auto data = shadow_buffer + rect.y * stride + rect.x * bytes_per_pixel;
+
+        ESP_UTILS_LOGD(
+            "Flush damage window(%d): x(%d), y(%d), width(%d), height(%d)", i, rect.x, rect.y, rect.width, rect.height
+        );
+        // A window of full lines is contiguous in the shadow buffer, the others are gathered line by line
+        if ((rect.width == config.width) && !isStreamRequired(data)) {
+            ESP_UTILS_CHECK_FALSE_RETURN(
+                drawBitmapDirect(rect.x, rect.y, rect.x + rect.width, rect.y + rect.height, data, token, timeout_ms),
+                false, "Draw damage window failed"
+            );
+        } else if (is_frame_buffer_bus) {
+            for (int y = rect.y; y < rect.y + rect.height; y++, data += stride) {
+                ESP_UTILS_CHECK_FALSE_RETURN(
+                    drawBitmapDirect(rect.x, y, rect.x + rect.width, y + 1, data, token, timeout_ms), false,
+                    "Draw damage line(%d) failed", y
+                );
+            }
+        } else {
+            ESP_UTILS_CHECK_FALSE_RETURN(
+                _stream.buffers[0] != nullptr, false,
+                "Stream buffer is required for partial windows, call `configStreamBufferSize()` first"
+            );
+            ESP_UTILS_CHECK_FALSE_RETURN(
+                drawBitmapByStream(
+                    rect.x, rect.y, rect.width, rect.height, data, stride, nullptr, token, timeout_ms
+                ), false,
+                "Draw damage window by stream failed"
+            );
+        }
+    }
+    _damage->clear();
+
+    if ((rect_num > 0) && (timeout_ms != 0)) {
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            waitDrawBitmapFinish(token, timeout_ms), false, "Wait for damage windows finish timeout"
+        );
+    }
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool LCD::setDamageTransactionCost(int pixels)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_LOGD("Param: pixels(%d)", pixels);
+    ESP_UTILS_CHECK_FALSE_RETURN(pixels >= 0, false, "Invalid cost(%d)", pixels);
+
+    _damage_transaction_cost = pixels;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool LCD::mirrorX(bool en)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::INIT), false, "Not initialized");
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        isFunctionSupported(BasicBusSpecification::FUNC_MIRROR_X), false, "This function is not supported"
+    );
+
+    ESP_UTILS_LOGD("Param: en(%d)", en);
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        esp_lcd_panel_mirror(refresh_panel, en, _transformation.mirror_y), false, "Mirror X failed"
+    );
+    _transformation.mirror_x = en;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool LCD::mirrorY(bool en)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::INIT), false, "Not initialized");
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        isFunctionSupported(BasicBusSpecification::FUNC_MIRROR_Y), false, "This function is not supported"
+    );
+
+    ESP_UTILS_LOGD("Param: en(%d)", en);
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        esp_lcd_panel_mirror(refresh_panel, _transformation.mirror_x, en), false, "Mirror X failed"
+    );
+    _transformation.mirror_y = en;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool LCD::swapXY(bool en)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::INIT), false, "Not initialized");
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        isFunctionSupported(BasicBusSpecification::FUNC_SWAP_XY), false, "This function is not supported"
+    );
+
+    ESP_UTILS_LOGD("Param: en(%d)", en);
+    ESP_UTILS_CHECK_ERROR_RETURN(esp_lcd_panel_swap_xy(refresh_panel, en), false, "Swap XY failed");
+    _transformation.swap_xy = en;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool LCD::setGapX(uint16_t gap)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::INIT), false, "Not initialized");
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        isFunctionSupported(BasicBusSpecification::FUNC_GAP), false, "This function is not supported"
+    );
+
+    ESP_UTILS_LOGD("Param: gap(%d)", static_cast<int>(gap));
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        esp_lcd_panel_set_gap(refresh_panel, gap, _transformation.gap_y), false, "Set X gap failed"
+    );
+    _transformation.gap_x = gap;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool LCD::setGapY(uint16_t gap)
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
 
@@ -792,35 +1409,449 @@ bool LCD::attachRefreshFinishCallback(FunctionRefreshFinishCallback callback, vo
     }
 #endif
 
-    if ((_interruption.data.user_data != nullptr) && (_interruption.data.user_data != user_data)) {
-        ESP_UTILS_LOGW("The previous user_data(@%p) is existed, will overwrite it", _interruption.data.user_data);
+    if ((_interruption.data.user_data != nullptr) && (_interruption.data.user_data != user_data)) {
+        ESP_UTILS_LOGW("The previous user_data(@%p) is existed, will overwrite it", _interruption.data.user_data);
+    }
+    _interruption.data.user_data = user_data;
+    _interruption.on_refresh_finish = callback;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool LCD::switchFrameBufferTo(void *frame_buffer)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (getBus()->getBasicAttributes().type == ESP_PANEL_BUS_TYPE_RGB) ||
+        (getBus()->getBasicAttributes().type == ESP_PANEL_BUS_TYPE_MIPI_DSI),
+        false, "Only valid for RGB and MIPI-DSI bus"
+    );
+
+    ESP_UTILS_LOGD("Param: frame_buffer(@%p)", frame_buffer);
+
+    /* For MIPI-DSI bus, the switch also ends with `on_color_trans_done`, but it has no token. Let the tokens finish
+     * first, so that the interrupt sees the end of the switch before the ones of the next tokens
+     */
+    bool is_untracked = (getBus()->getBasicAttributes().type == ESP_PANEL_BUS_TYPE_MIPI_DSI);
+    if (is_untracked) {
+        ESP_UTILS_CHECK_FALSE_RETURN(waitDrawBitmapFinishAll(), false, "Wait for drawings finish failed");
+        portENTER_CRITICAL(&_interruption.lock);
+        _interruption.draw_bitmap_untracked_count++;
+        portEXIT_CRITICAL(&_interruption.lock);
+    }
+    if (esp_lcd_panel_draw_bitmap(refresh_panel, 0, 0, getFrameWidth(), getFrameHeight(), frame_buffer) != ESP_OK) {
+        if (is_untracked) {
+            portENTER_CRITICAL(&_interruption.lock);
+            _interruption.draw_bitmap_untracked_count--;
+            portEXIT_CRITICAL(&_interruption.lock);
+        }
+        ESP_UTILS_CHECK_FALSE_RETURN(false, false, "Switch to frame buffer failed");
+    }
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool LCD::initSwapChain(int buffer_num, LCD_SwapChain::PresentMode mode)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
+    auto bus_type = getBus()->getBasicAttributes().type;
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (bus_type == ESP_PANEL_BUS_TYPE_RGB) || (bus_type == ESP_PANEL_BUS_TYPE_MIPI_DSI), false,
+        "Only valid for RGB and MIPI-DSI bus"
+    );
+
+    ESP_UTILS_LOGD("Param: buffer_num(%d), mode(%d)", buffer_num, static_cast<int>(mode));
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (buffer_num >= LCD_SwapChain::BUFFER_NUM_MIN) && (buffer_num <= LCD_SwapChain::BUFFER_NUM_MAX), false,
+        "Invalid buffer number(%d), should be in range [%d, %d]", buffer_num, LCD_SwapChain::BUFFER_NUM_MIN,
+        LCD_SwapChain::BUFFER_NUM_MAX
+    );
+
+    void *buffers[LCD_SwapChain::BUFFER_NUM_MAX] = {};
+    for (int i = 0; i < buffer_num; i++) {
+        buffers[i] = getFrameBufferByIndex(i);
+        ESP_UTILS_CHECK_NULL_RETURN(
+            buffers[i], false, "Get frame buffer(%d) failed, check `configFrameBufferNumber()`", i
+        );
+    }
+
+    // Only allocated for the swap chain, it is kept until `del()` since the refresh interrupt reads it
+    if (_swap_chain == nullptr) {
+        std::shared_ptr<SwapChainContext> swap_chain = nullptr;
+        ESP_UTILS_CHECK_EXCEPTION_RETURN(
+            swap_chain = utils::make_shared<SwapChainContext>(), false, "Create swap chain context failed"
+        );
+        swap_chain->sem = xSemaphoreCreateBinaryStatic(&swap_chain->sem_buffer);
+        portMUX_INITIALIZE(&swap_chain->lock);
+        _swap_chain = swap_chain;
+    }
+
+    // The chain starts with the first buffer in front, make the panel show it
+    ESP_UTILS_CHECK_FALSE_RETURN(switchFrameBufferTo(buffers[0]), false, "Switch to the first frame buffer failed");
+    LCD_SwapChain chain;
+    ESP_UTILS_CHECK_FALSE_RETURN(chain.init(buffers, buffer_num, mode), false, "Init swap chain failed");
+    portENTER_CRITICAL(&_swap_chain->lock);
+    _swap_chain->chain = chain;
+    portEXIT_CRITICAL(&_swap_chain->lock);
+    // Copying a region costs little more than its pixels, so the history keeps the rectangles separate
+    _swap_chain->history.configure({
+        .width = getFrameWidth(),
+        .height = getFrameHeight(),
+        .x_align = 1,
+        .y_align = 1,
+        .transaction_cost = 0,
+    });
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool LCD::delSwapChain()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    if (_swap_chain != nullptr) {
+        portENTER_CRITICAL(&_swap_chain->lock);
+        _swap_chain->chain.deinit();
+        portEXIT_CRITICAL(&_swap_chain->lock);
+    }
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+void *LCD::acquireBackBuffer(int *age, int timeout_ms)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isSwapChainInit(), nullptr, "Swap chain is not initialized");
+
+    ESP_UTILS_LOGD("Param: age(@%p), timeout_ms(%d)", age, timeout_ms);
+
+    int index = -1;
+    int buffer_age = 0;
+    TickType_t start_tick = xTaskGetTickCount();
+    TickType_t timeout_tick = (timeout_ms < 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    TickType_t wait_tick = timeout_tick;
+    while (true) {
+        portENTER_CRITICAL(&_swap_chain->lock);
+        index = _swap_chain->chain.acquire();
+        buffer_age = _swap_chain->chain.getAge(index);
+        portEXIT_CRITICAL(&_swap_chain->lock);
+        if (index >= 0) {
+            break;
+        }
+
+        /* The semaphore is given once a buffer is released by the refresh interrupt */
+        if (timeout_ms >= 0) {
+            TickType_t elapsed_tick = xTaskGetTickCount() - start_tick;
+            ESP_UTILS_CHECK_FALSE_RETURN(elapsed_tick < timeout_tick, nullptr, "Wait for free buffer timeout");
+            wait_tick = timeout_tick - elapsed_tick;
+        }
+        xSemaphoreTake(_swap_chain->sem, wait_tick);
+    }
+
+    if (age != nullptr) {
+        *age = buffer_age;
+    }
+    ESP_UTILS_LOGD("Acquired buffer(%d), age(%d)", index, buffer_age);
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return _swap_chain->chain.getBuffer(index);
+}
+
+bool LCD::releaseBackBuffer(void *buffer)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isSwapChainInit(), false, "Swap chain is not initialized");
+
+    ESP_UTILS_LOGD("Param: buffer(@%p)", buffer);
+
+    portENTER_CRITICAL(&_swap_chain->lock);
+    bool ret = _swap_chain->chain.release(_swap_chain->chain.getIndex(buffer));
+    portEXIT_CRITICAL(&_swap_chain->lock);
+    ESP_UTILS_CHECK_FALSE_RETURN(ret, false, "Buffer(@%p) is not acquired", buffer);
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool LCD::repairBackBuffer(void *buffer, int age, const LCD_Transform::Rect *skip_rects, int skip_rect_num)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isSwapChainInit(), false, "Swap chain is not initialized");
+
+    ESP_UTILS_LOGD(
+        "Param: buffer(@%p), age(%d), skip_rects(@%p), skip_rect_num(%d)", buffer, age, skip_rects, skip_rect_num
+    );
+    ESP_UTILS_CHECK_FALSE_RETURN((skip_rects != nullptr) || (skip_rect_num == 0), false, "Invalid skip rectangles");
+
+    auto &chain = _swap_chain->chain;
+    int index = chain.getIndex(buffer);
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        chain.getState(index) == LCD_SwapChain::BufferState::ACQUIRED, false, "Buffer(@%p) is not acquired", buffer
+    );
+    // Only this task presents buffers, so the latest frame doesn't change during the copy
+    int latest_index = chain.getLatestIndex();
+    if ((age == 1) || (latest_index < 0) || (latest_index == index)) {
+        ESP_UTILS_LOGD("Buffer is up to date");
+        ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+        return true;
+    }
+
+    LCD_DamageTracker damage;
+    if (!_swap_chain->history.getDamageSince(age, damage)) {
+        ESP_UTILS_LOGD("Damage history is not long enough, repair the whole frame");
+        damage.add({0, 0, getFrameWidth(), getFrameHeight()});
+    }
+
+    auto src_buffer = static_cast<const uint8_t *>(chain.getBuffer(latest_index));
+    auto dst_buffer = static_cast<uint8_t *>(buffer);
+    int bytes_per_pixel = (getFrameColorBits() + 7) / 8;
+    size_t line_bytes = getFrameWidth() * bytes_per_pixel;
+    for (int i = 0; i < damage.getRectNum(); i++) {
+        auto &rect = damage.getRects()[i];
+        bool is_skipped = false;
+        for (int j = 0; (j < skip_rect_num) && !is_skipped; j++) {
+            auto &skip = skip_rects[j];
+            is_skipped = (rect.x >= skip.x) && (rect.y >= skip.y) && (rect.x + rect.width <= skip.x + skip.width) &&
+                         (rect.y + rect.height <= skip.y + skip.height);
+        }
+        if (is_skipped) {
+            continue;
+        }
+
+        size_t offset = rect.y * line_bytes + rect.x * bytes_per_pixel;
+        size_t copy_bytes = rect.width * bytes_per_pixel;
+        if (copy_bytes == line_bytes) {
+            memcpy(dst_buffer + offset, src_buffer + offset, line_bytes * rect.height);
+            continue;
+        }
+        for (int y = 0; y < rect.height; y++, offset += line_bytes) {
+            memcpy(dst_buffer + offset, src_buffer + offset, copy_bytes);
+        }
+    }
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool LCD::present(void *buffer, const LCD_Transform::Rect *damage_rects, int damage_rect_num, int timeout_ms)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isSwapChainInit(), false, "Swap chain is not initialized");
+
+    ESP_UTILS_LOGD(
+        "Param: buffer(@%p), damage_rects(@%p), damage_rect_num(%d), timeout_ms(%d)", buffer, damage_rects,
+        damage_rect_num, timeout_ms
+    );
+
+    auto &chain = _swap_chain->chain;
+    int index = chain.getIndex(buffer);
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        chain.getState(index) == LCD_SwapChain::BufferState::ACQUIRED, false, "Buffer(@%p) is not acquired", buffer
+    );
+
+    /* In FIFO mode, wait until the queued buffer is shown. Only this task queues buffers, so it stays presentable */
+    TickType_t start_tick = xTaskGetTickCount();
+    TickType_t timeout_tick = (timeout_ms < 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    TickType_t wait_tick = timeout_tick;
+    while (!chain.canPresent()) {
+        if (timeout_ms >= 0) {
+            TickType_t elapsed_tick = xTaskGetTickCount() - start_tick;
+            ESP_UTILS_CHECK_FALSE_RETURN(elapsed_tick < timeout_tick, false, "Wait for queued buffer shown timeout");
+            wait_tick = timeout_tick - elapsed_tick;
+        }
+        xSemaphoreTake(_swap_chain->sem, wait_tick);
+    }
+
+    // Switch the panel first, so the refresh interrupt never releases the front buffer before the switch. If a
+    // refresh finishes in between, the previous front buffer is just released one refresh later
+    ESP_UTILS_CHECK_FALSE_RETURN(switchFrameBufferTo(buffer), false, "Switch frame buffer failed");
+    portENTER_CRITICAL(&_swap_chain->lock);
+    bool ret = chain.present(index);
+    portEXIT_CRITICAL(&_swap_chain->lock);
+    ESP_UTILS_CHECK_FALSE_RETURN(ret, false, "Present buffer(%d) failed", index);
+    _swap_chain->history.addFrame(damage_rects, damage_rect_num);
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+float LCD::getRefreshRate()
+{
+    if (_tear_sync == nullptr) {
+        return 0;
+    }
+
+    portENTER_CRITICAL(&_tear_sync->lock);
+    float rate = _tear_sync->sync.getRefreshRate();
+    portEXIT_CRITICAL(&_tear_sync->lock);
+
+    return rate;
+}
+
+LCD_TearSync LCD::getTearSync()
+{
+    if (_tear_sync == nullptr) {
+        return {};
+    }
+
+    portENTER_CRITICAL(&_tear_sync->lock);
+    LCD_TearSync sync = _tear_sync->sync;
+    portEXIT_CRITICAL(&_tear_sync->lock);
+
+    return sync;
+}
+
+LCD_RefreshMonitor LCD::getRefreshMonitor()
+{
+    if (!_refresh_monitor.is_started) {
+        return {};
+    }
+
+    portENTER_CRITICAL(&_refresh_monitor.lock);
+    LCD_RefreshMonitor monitor = _refresh_monitor.monitor;
+    portEXIT_CRITICAL(&_refresh_monitor.lock);
+
+    return monitor;
+}
+
+LCD_Stats LCD::getStats()
+{
+#if ESP_PANEL_DRIVERS_LCD_ENABLE_STATS
+    if (!_stats.is_started) {
+        return {};
+    }
+
+    portENTER_CRITICAL(&_stats.lock);
+    LCD_Stats stats = _stats.stats;
+    portEXIT_CRITICAL(&_stats.lock);
+
+    return stats;
+#else
+    return {};
+#endif
+}
+
+void LCD::resetStats()
+{
+#if ESP_PANEL_DRIVERS_LCD_ENABLE_STATS
+    if (!_stats.is_started) {
+        return;
     }
-    _interruption.data.user_data = user_data;
-    _interruption.on_refresh_finish = callback;
-
-    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
-    return true;
+    portENTER_CRITICAL(&_stats.lock);
+    _stats.stats.reset();
+    portEXIT_CRITICAL(&_stats.lock);
+#endif
 }
 
-bool LCD::switchFrameBufferTo(void *frame_buffer)
+bool LCD::fillRect(int x_start, int y_start, int width, int height, uint32_t color, int timeout_ms)
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
 
     ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
+
+    ESP_UTILS_LOGD(
+        "Param: x_start(%d), y_start(%d), width(%d), height(%d), color(0x%08x), timeout_ms(%d)", x_start, y_start,
+        width, height, static_cast<unsigned>(color), timeout_ms
+    );
     ESP_UTILS_CHECK_FALSE_RETURN(
-        (getBus()->getBasicAttributes().type == ESP_PANEL_BUS_TYPE_RGB) ||
-        (getBus()->getBasicAttributes().type == ESP_PANEL_BUS_TYPE_MIPI_DSI),
-        false, "Only valid for RGB and MIPI-DSI bus"
+        !_indexed_frame_buffer.is_enabled, false, "Not supported with the indexed frame buffer"
     );
 
-    ESP_UTILS_LOGD("Param: frame_buffer(@%p)", frame_buffer);
+    int bits_per_pixel = getFrameColorBits();
+    int bytes_per_pixel = LCD_Transform::getBytesPerPixel(bits_per_pixel);
+    ESP_UTILS_CHECK_FALSE_RETURN(bytes_per_pixel > 0, false, "Invalid color bits(%d)", bits_per_pixel);
+    if (_stream.swap_bytes && (bits_per_pixel == 16)) {
+        color = ((color & 0xff) << 8) | ((color >> 8) & 0xff);
+    }
 
-    ESP_UTILS_CHECK_ERROR_RETURN(
-        esp_lcd_panel_draw_bitmap(refresh_panel, 0, 0, getFrameWidth(), getFrameHeight(), frame_buffer), false,
-        "Switch to frame buffer failed"
+    if (_fill.buffer == nullptr) {
+        auto buffer = static_cast<uint8_t *>(heap_caps_malloc(FILL_BUFFER_SIZE, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL));
+        ESP_UTILS_CHECK_NULL_RETURN(buffer, false, "Allocate fill buffer failed");
+        _fill.buffer = std::shared_ptr<uint8_t>(buffer, heap_caps_free);
+        _fill.is_filled = false;
+    }
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        checkDrawBitmapParams(x_start, y_start, width, height, _fill.buffer.get()), false, "Invalid parameters"
     );
 
+    if ((width > 0) && (height > 0)) {
+        auto buffer = _fill.buffer.get();
+        int buffer_pixels = FILL_BUFFER_SIZE / bytes_per_pixel;
+
+        // The buffer is only rewritten when the color changes, after the previous fillings are sent
+        if (!_fill.is_filled || (_fill.color != color)) {
+            ESP_UTILS_CHECK_FALSE_RETURN(
+                waitDrawBitmapFinish(_fill.token, -1), false, "Wait for fill buffer finish failed"
+            );
+            for (int i = 0; i < bytes_per_pixel; i++) {
+                buffer[i] = static_cast<uint8_t>(color >> (i * 8));
+            }
+            for (int filled = 1; filled < buffer_pixels; filled *= 2) {
+                int count = std::min(filled, buffer_pixels - filled);
+                memcpy(buffer + filled * bytes_per_pixel, buffer, count * bytes_per_pixel);
+            }
+            _fill.color = color;
+            _fill.is_filled = true;
+        }
+
+        // The color is uniform, so the software transformation only moves the rectangle
+        LCD_Transform::Rect rect = {x_start, y_start, width, height};
+        auto &transform = _stream.transform;
+        if (!transform.isIdentity()) {
+            int panel_width = getTransformation().swap_xy ? getFrameHeight() : getFrameWidth();
+            int panel_height = getTransformation().swap_xy ? getFrameWidth() : getFrameHeight();
+            int image_width = transform.isSwapXY() ? panel_height : panel_width;
+            int image_height = transform.isSwapXY() ? panel_width : panel_height;
+            rect = LCD_Transform::mapRect(transform, image_width, image_height, rect);
+        }
+
+        // Split the rectangle into aligned chunks which fit in the buffer, full rows are preferred
+        auto &bus_spec = getBasicAttributes().basic_bus_spec;
+        int x_align = std::max(static_cast<int>(bus_spec.x_coord_align), 1);
+        int y_align = std::max(static_cast<int>(bus_spec.y_coord_align), 1);
+        int chunk_width = std::min(rect.width, std::max(buffer_pixels / y_align / x_align * x_align, x_align));
+        int chunk_height = std::min(rect.height, std::max(buffer_pixels / chunk_width / y_align * y_align, 1));
+        int x_end = rect.x + rect.width;
+        int y_end = rect.y + rect.height;
+        for (int y = rect.y; y < y_end; y += chunk_height) {
+            for (int x = rect.x; x < x_end; x += chunk_width) {
+                ESP_UTILS_CHECK_FALSE_RETURN(
+                    drawBitmapDirect(
+                        x, y, std::min(x + chunk_width, x_end), std::min(y + chunk_height, y_end), buffer,
+                        _fill.token, -1
+                    ), false, "Draw fill chunk failed"
+                );
+            }
+        }
+
+        if (timeout_ms != 0) {
+            ESP_UTILS_CHECK_FALSE_RETURN(
+                waitDrawBitmapFinish(_fill.token, timeout_ms), false, "Wait for filling finish timeout"
+            );
+        }
+    }
+
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
     return true;
@@ -832,6 +1863,10 @@ bool LCD::colorBarTest(uint16_t width, uint16_t height)
 
     ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
 
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        !_indexed_frame_buffer.is_enabled, false, "Not supported with the indexed frame buffer"
+    );
+
     int bits_per_piexl = getFrameColorBits();
     ESP_UTILS_LOGD("LCD bits per pixel: %d", bits_per_piexl);
     ESP_UTILS_CHECK_FALSE_RETURN(bits_per_piexl > 0, false, "Invalid color bits");
@@ -839,50 +1874,34 @@ bool LCD::colorBarTest(uint16_t width, uint16_t height)
     ESP_UTILS_LOGD("Param: width(%d), height(%d)", width, height);
 
     auto y_coord_align = getBasicAttributes().basic_bus_spec.y_coord_align;
-    int bytes_per_piexl = bits_per_piexl / 8;
     // Make sure the height is aligned to the `y_coord_align`
     int row_per_bar = (height / bits_per_piexl) & ~(y_coord_align - 1);
     int line_count = 0;
-    int res_line_count = 0;
 
-    /* Malloc memory for a single color bar */
-    utils::vector<uint8_t> single_bar(row_per_bar * width * bytes_per_piexl);
-    auto single_bar_buf = single_bar.data();
     auto bus_type = getBus()->getBasicAttributes().type;
+    // For SPI bus (and 8-bit I80 bus), the data bytes should be swapped since the data is sent by LSB first, unless it
+    // is done by the stream already
+    bool is_byte_bus = (bus_type == ESP_PANEL_BUS_TYPE_SPI) || (bus_type == ESP_PANEL_BUS_TYPE_QSPI);
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_I80
+    is_byte_bus = is_byte_bus ||
+                  ((bus_type == ESP_PANEL_BUS_TYPE_I80) && (static_cast<BusI80 *>(getBus())->getDataWidth() == 8));
+#endif
+    bool swap_data = is_byte_bus && !(_stream.swap_bytes && (bits_per_piexl == 16));
     /* Draw color bar from top left to bottom right, the order is B - G - R */
     for (int j = 0; j < bits_per_piexl; j++) {
-        for (int i = 0; i < row_per_bar * width; i++) {
-            for (int k = 0; k < bytes_per_piexl; k++) {
-                if ((bus_type == ESP_PANEL_BUS_TYPE_SPI) || (bus_type == ESP_PANEL_BUS_TYPE_QSPI)) {
-                    // For SPI bus, the data bytes should be swapped since the data is sent by LSB first
-                    single_bar_buf[i * bytes_per_piexl + k] = SPI_SWAP_DATA_TX(BIT(j), bits_per_piexl) >> (k * 8);
-                } else {
-                    single_bar_buf[i * bytes_per_piexl + k] = BIT(j) >> (k * 8);
-                }
-            }
-        }
-        line_count += row_per_bar;
+        uint32_t color = swap_data ? SPI_SWAP_DATA_TX(BIT(j), bits_per_piexl) : BIT(j);
         ESP_UTILS_CHECK_FALSE_RETURN(
-            drawBitmap(0, j * row_per_bar, width, row_per_bar, single_bar_buf, -1), false,
-            "Draw bitmap wait until finish failed"
+            fillRect(0, line_count, width, row_per_bar, color, -1), false, "Fill color bar failed"
         );
+        line_count += row_per_bar;
     }
 
     /* Fill the rest of the screen with white color */
-    res_line_count = height - line_count;
-    if (res_line_count > 0) {
-        ESP_UTILS_LOGD("Fill the rest lines(%d) with white color", res_line_count);
-        memset(single_bar_buf, 0xff, row_per_bar * width * bytes_per_piexl);
-
-        for (; res_line_count > 0; res_line_count -= row_per_bar) {
-            ESP_UTILS_CHECK_FALSE_RETURN(
-                drawBitmap(
-                    0, line_count, width, res_line_count > row_per_bar ? row_per_bar : res_line_count,
-                    single_bar_buf, -1
-                ), false, "Draw bitmap wait until finish failed"
-            );
-            line_count += row_per_bar;
-        }
+    if (height > line_count) {
+        ESP_UTILS_LOGD("Fill the rest lines(%d) with white color", height - line_count);
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            fillRect(0, line_count, width, height - line_count, 0xffffffff, -1), false, "Fill rest lines failed"
+        );
     }
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
@@ -1015,6 +2034,24 @@ void *LCD::getFrameBufferByIndex(uint8_t index)
     return buffer[index];
 }
 
+bool LCD::setPaletteColors(int start, const uint32_t *colors, int num)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
+    ESP_UTILS_CHECK_NULL_RETURN(_indexed_frame_buffer.buffer, false, "Indexed frame buffer is not configured");
+
+    ESP_UTILS_LOGD("Param: start(%d), colors(@%p), num(%d)", start, colors, num);
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        _indexed_frame_buffer.palette->setColors(start, colors, num), false, "Invalid colors, the range is [0, %d)",
+        _indexed_frame_buffer.palette->getColorNum()
+    );
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
 bool LCD::processDeviceOnInit(const BasicBusSpecificationMap &bus_specs)
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
@@ -1218,6 +2255,351 @@ const BusDSI::RefreshPanelFullConfig *LCD::getBusDSI_RefreshPanelFullConfig()
 }
 #endif
 
+int LCD::getBusDrawBitmapQueueDepth()
+{
+    ESP_UTILS_CHECK_FALSE_RETURN(isBusValid(), 1, "Invalid bus");
+
+    int depth = 1;
+    auto bus = getBus();
+    switch (bus->getBasicAttributes().type) {
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_SPI
+    case ESP_PANEL_BUS_TYPE_SPI: {
+        auto config =
+            std::get_if<BusSPI::ControlPanelFullConfig>(&static_cast<BusSPI *>(bus)->getConfig().control_panel);
+        if (config != nullptr) {
+            depth = static_cast<int>(config->trans_queue_depth);
+        }
+        break;
+    }
+#endif
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_QSPI
+    case ESP_PANEL_BUS_TYPE_QSPI: {
+        auto config =
+            std::get_if<BusQSPI::ControlPanelFullConfig>(&static_cast<BusQSPI *>(bus)->getConfig().control_panel);
+        if (config != nullptr) {
+            depth = static_cast<int>(config->trans_queue_depth);
+        }
+        break;
+    }
+#endif
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_I80
+    case ESP_PANEL_BUS_TYPE_I80: {
+        auto config =
+            std::get_if<BusI80::ControlPanelFullConfig>(&static_cast<BusI80 *>(bus)->getConfig().control_panel);
+        if (config != nullptr) {
+            depth = static_cast<int>(config->trans_queue_depth);
+        }
+        break;
+    }
+#endif
+    default:
+        break;
+    }
+
+    return std::max(depth, 1);
+}
+
+bool LCD::drawBitmapDirect(
+    int x_start, int y_start, int x_end, int y_end, const uint8_t *color_data, DrawBitmapToken &token, int timeout_ms
+)
+{
+    // Wait for a free slot in the draw queue
+    if (_interruption.draw_bitmap_slot_sem != nullptr) {
+        BaseType_t timeout_tick = (timeout_ms < 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            xSemaphoreTake(_interruption.draw_bitmap_slot_sem, timeout_tick) == pdTRUE, false,
+            "Wait for draw queue slot timeout"
+        );
+    }
+    // Every write to the panel is scheduled against the scanline, whichever function it comes from
+    waitTearingEffect(x_start, y_start, x_end - x_start, y_end - y_start);
+
+    // The counter should be increased before sending, since the callback might be called inside the draw function
+    DrawBitmapToken submit_token = _interruption.draw_bitmap_submit_count + 1;
+    // Measure the write speed for the TE scheduler, only when the bus is idle so that no queueing time is included
+    if ((_tear_sync != nullptr) && (_interruption.draw_bitmap_finish_count == submit_token - 1)) {
+        portENTER_CRITICAL(&_tear_sync->lock);
+        _tear_sync->write_start_us = esp_timer_get_time();
+        _tear_sync->write_pixels = (x_end - x_start) * (y_end - y_start);
+        _tear_sync->write_token = submit_token;
+        portEXIT_CRITICAL(&_tear_sync->lock);
+    }
+    _interruption.draw_bitmap_submit_count = submit_token;
+#if ESP_PANEL_DRIVERS_LCD_ENABLE_STATS
+    portENTER_CRITICAL(&_stats.lock);
+    _stats.stats.onDrawBitmapSubmit(submit_token, esp_timer_get_time());
+    portEXIT_CRITICAL(&_stats.lock);
+#endif
+
+    // Send data to the panel, or copy the indexes into the indexed frame buffer
+    bool is_sent = false;
+    if (_indexed_frame_buffer.buffer != nullptr) {
+        is_sent = LCD_Palette::copyIndices(
+            _indexed_frame_buffer.format, color_data, x_end - x_start, y_end - y_start, 0,
+            _indexed_frame_buffer.buffer.get(), getFrameWidth(), x_start, y_start
+        );
+    } else {
+        is_sent = (esp_lcd_panel_draw_bitmap(refresh_panel, x_start, y_start, x_end, y_end, color_data) == ESP_OK);
+    }
+    if (!is_sent) {
+        _interruption.draw_bitmap_submit_count = submit_token - 1;
+        if (_interruption.draw_bitmap_slot_sem != nullptr) {
+            xSemaphoreGive(_interruption.draw_bitmap_slot_sem);
+        }
+        ESP_UTILS_CHECK_FALSE_RETURN(false, false, "Draw bitmap failed");
+    }
+#if ESP_PANEL_DRIVERS_LCD_ENABLE_STATS
+    {
+        int width = x_end - x_start;
+        int height = y_end - y_start;
+        size_t bytes = (_indexed_frame_buffer.buffer != nullptr) ?
+                       LCD_Palette::getFrameBufferSize(_indexed_frame_buffer.format, width, height) :
+                       static_cast<size_t>(width) * height * LCD_Transform::getBytesPerPixel(getFrameColorBits());
+        portENTER_CRITICAL(&_stats.lock);
+        _stats.stats.onDrawBitmapSent(bytes);
+        portEXIT_CRITICAL(&_stats.lock);
+    }
+#endif
+
+    // For RGB bus, since `drawBitmap()` uses `memcpy()` instead of DMA operation, the drawing is already finished
+    if (getBus()->getBasicAttributes().type == ESP_PANEL_BUS_TYPE_RGB) {
+#if ESP_PANEL_DRIVERS_LCD_ENABLE_STATS
+        portENTER_CRITICAL(&_stats.lock);
+        _stats.stats.onDrawBitmapFinish(submit_token, esp_timer_get_time());
+        portEXIT_CRITICAL(&_stats.lock);
+#endif
+        _interruption.draw_bitmap_finish_count = submit_token;
+        if (_interruption.on_draw_bitmap_finish != nullptr) {
+            _interruption.on_draw_bitmap_finish(_interruption.data.user_data);
+        }
+    }
+
+    token = submit_token;
+
+    return true;
+}
+
+bool LCD::drawBitmapByStream(
+    int x_start, int y_start, int width, int height, const uint8_t *color_data, size_t color_stride,
+    const LCD_ColorConvert::PixelFormat *color_format, DrawBitmapToken &token, int timeout_ms
+)
+{
+    int bits_per_pixel = getFrameColorBits();
+    int bytes_per_pixel = LCD_Transform::getBytesPerPixel(bits_per_pixel);
+    ESP_UTILS_CHECK_FALSE_RETURN(bytes_per_pixel > 0, false, "Invalid color bits(%d)", bits_per_pixel);
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        !_stream.swap_bytes || (bits_per_pixel == 16), false, "Swapping bytes is only supported for RGB565"
+    );
+    LCD_ColorConvert::PixelFormat panel_format = {};
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (color_format == nullptr) || LCD_ColorConvert::getPixelFormatByBits(bits_per_pixel, panel_format), false,
+        "Color bits(%d) is not supported for conversion", bits_per_pixel
+    );
+    LCD_ColorConvert::Options convert_options = {
+        .dither = _stream.dither,
+        .swap_bytes = _stream.swap_bytes,
+    };
+
+    // Each strip contains full rows of the bitmap, which become full columns on the panel when rotated by 90/270
+    // degrees, so only one coordinate needs to be aligned
+    auto &transform = _stream.transform;
+    auto &bus_spec = getBasicAttributes().basic_bus_spec;
+    int rows_align = transform.isSwapXY() ? bus_spec.x_coord_align : bus_spec.y_coord_align;
+    size_t row_bytes = width * bytes_per_pixel;
+    size_t color_row_bytes = (color_format != nullptr) ? width * LCD_ColorConvert::getBytesPerPixel(*color_format) :
+                             row_bytes;
+    color_stride = (color_stride > 0) ? color_stride : color_row_bytes;
+    // Converting and transforming need two steps, the strip is converted into the second half of the buffer first
+    bool is_convert_transform = (color_format != nullptr) && !transform.isIdentity();
+    size_t strip_size = is_convert_transform ? ((_stream.buffer_size / 2) & ~static_cast<size_t>(0x3)) :
+                        _stream.buffer_size;
+    int strip_rows = strip_size / row_bytes;
+    strip_rows -= strip_rows % rows_align;
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        strip_rows > 0, false, "Stream buffer(%d bytes) can't hold %d rows of %d bytes",
+        static_cast<int>(_stream.buffer_size), rows_align, static_cast<int>(row_bytes)
+    );
+
+    // Size of the bitmap coordinate space, before the software transformation
+    int panel_width = getTransformation().swap_xy ? getFrameHeight() : getFrameWidth();
+    int panel_height = getTransformation().swap_xy ? getFrameWidth() : getFrameHeight();
+    int image_width = transform.isSwapXY() ? panel_height : panel_width;
+    int image_height = transform.isSwapXY() ? panel_width : panel_height;
+
+    for (int y = 0; y < height; y += strip_rows) {
+        int rows = std::min(strip_rows, height - y);
+        int index = _stream.buffer_index;
+        auto buffer = _stream.buffers[index].get();
+        auto strip_data = color_data + y * color_stride;
+        LCD_Transform::Rect area = {x_start, y_start + y, width, rows};
+
+        // Wait until the strip previously placed in this buffer is transmitted, then refill it
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            waitDrawBitmapFinish(_stream.buffer_tokens[index], timeout_ms), false, "Wait for stream buffer timeout"
+        );
+        if (color_format != nullptr) {
+            // The bytes are swapped by the conversion, and the dithering pattern follows the bitmap coordinates
+            auto converted = is_convert_transform ? (buffer + strip_size) : buffer;
+            ESP_UTILS_CHECK_FALSE_RETURN(
+                LCD_ColorConvert::convert(
+                    *color_format, strip_data, width, rows, color_stride, panel_format, converted, row_bytes,
+                    x_start, y_start + y, convert_options
+                ), false, "Convert strip failed"
+            );
+            if (is_convert_transform) {
+                ESP_UTILS_CHECK_FALSE_RETURN(
+                    LCD_Transform::transform(transform, bits_per_pixel, converted, width, rows, row_bytes, buffer, 0),
+                    false, "Transform strip failed"
+                );
+                area = LCD_Transform::mapRect(transform, image_width, image_height, area);
+            }
+        } else if (transform.isIdentity()) {
+            // A packed bitmap is copied as a whole, a window of a larger image line by line
+            int copy_num = (color_stride == row_bytes) ? 1 : rows;
+            int copy_rows = rows / copy_num;
+            for (int i = 0; i < copy_num; i++) {
+                auto from = strip_data + i * color_stride;
+                auto to = buffer + i * row_bytes;
+                if (_stream.swap_bytes) {
+                    LCD_ColorConvert::copySwapBytesRGB565(
+                        reinterpret_cast<uint16_t *>(to), reinterpret_cast<const uint16_t *>(from), copy_rows * width
+                    );
+                } else {
+                    memcpy(to, from, copy_rows * row_bytes);
+                }
+            }
+        } else {
+            ESP_UTILS_CHECK_FALSE_RETURN(
+                LCD_Transform::transform(transform, bits_per_pixel, strip_data, width, rows, color_stride, buffer, 0),
+                false, "Transform strip failed"
+            );
+            area = LCD_Transform::mapRect(transform, image_width, image_height, area);
+            // The strip is in the internal buffer now, so swapping it in place is cheap
+            if (_stream.swap_bytes) {
+                LCD_ColorConvert::copySwapBytesRGB565(
+                    reinterpret_cast<uint16_t *>(buffer), reinterpret_cast<const uint16_t *>(buffer), rows * width
+                );
+            }
+        }
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            drawBitmapDirect(
+                area.x, area.y, area.x + area.width, area.y + area.height, buffer, _stream.buffer_tokens[index],
+                timeout_ms
+            ), false, "Draw stream strip failed"
+        );
+
+        token = _stream.buffer_tokens[index];
+        _stream.buffer_index = (index + 1) % STREAM_BUFFER_NUM;
+    }
+
+    return true;
+}
+
+bool LCD::checkDrawBitmapParams(int x_start, int y_start, int width, int height, const uint8_t *color_data)
+{
+    // Check basic parameters validity
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (x_start >= 0) && (y_start >= 0), false, "Invalid start coordinates: (%d,%d)", x_start, y_start
+    );
+    ESP_UTILS_CHECK_FALSE_RETURN((width >= 0) && (height >= 0), false, "Invalid dimensions: (%d,%d)", width, height);
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        ((width == 0) && (height == 0)) || (color_data != nullptr), false, "Invalid color_data"
+    );
+
+    // Get display parameters, the software transformation swaps the axes as well
+    auto swap_xy = getTransformation().swap_xy ^ _stream.transform.isSwapXY();
+    auto frame_width = getFrameWidth();
+    auto frame_height = getFrameHeight();
+    auto x_align = getBasicAttributes().basic_bus_spec.x_coord_align;
+    auto y_align = getBasicAttributes().basic_bus_spec.y_coord_align;
+    auto x_end = x_start + width;
+    auto y_end = y_start + height;
+
+    // Check boundary limits
+    auto max_x = swap_xy ? frame_height : frame_width;
+    auto max_y = swap_xy ? frame_width : frame_height;
+    if (frame_width > 0) {
+        ESP_UTILS_CHECK_FALSE_RETURN(x_end <= max_x, false, "x_end(%d) exceeds display limit(%d)", x_end, max_x);
+    }
+    if (frame_height > 0) {
+        ESP_UTILS_CHECK_FALSE_RETURN(y_end <= max_y, false, "y_end(%d) exceeds display limit(%d)", y_end, max_y);
+    }
+
+    // Check coordinate alignment
+    if (x_start & (x_align - 1)) {
+        ESP_UTILS_LOGW("x_start(%d) not aligned to %d", x_start, x_align);
+    } else if (width & (x_align - 1)) {
+        ESP_UTILS_LOGW("width(%d) not aligned to %d", width, x_align);
+    }
+    if (y_start & (y_align - 1)) {
+        ESP_UTILS_LOGW("y_start(%d) not aligned to %d", y_start, y_align);
+    } else if (height & (y_align - 1)) {
+        ESP_UTILS_LOGW("height(%d) not aligned to %d", height, y_align);
+    }
+
+    return true;
+}
+
+bool LCD::isStreamRequired(const uint8_t *color_data) const
+{
+    return (_stream.buffers[0] != nullptr) && (color_data != nullptr) &&
+           (!_stream.transform.isIdentity() || _stream.swap_bytes || !esp_ptr_dma_capable(color_data));
+}
+
+void LCD::updateDamageConfig()
+{
+    // The software transformation swaps the axes, so the alignments are swapped as well
+    auto swap_xy = getTransformation().swap_xy ^ _stream.transform.isSwapXY();
+    auto &bus_spec = getBasicAttributes().basic_bus_spec;
+    bool transform_swap_xy = _stream.transform.isSwapXY();
+
+    _damage->configure({
+        .width = swap_xy ? getFrameHeight() : getFrameWidth(),
+        .height = swap_xy ? getFrameWidth() : getFrameHeight(),
+        .x_align = transform_swap_xy ? bus_spec.y_coord_align : bus_spec.x_coord_align,
+        .y_align = transform_swap_xy ? bus_spec.x_coord_align : bus_spec.y_coord_align,
+        .transaction_cost = _damage_transaction_cost,
+    });
+}
+
+void LCD::waitTearingEffect(int x_start, int y_start, int width, int height)
+{
+    if (_tear_sync == nullptr) {
+        return;
+    }
+
+    // The rectangle is already transformed by software, map it to the rows of the panel, which always scans from its
+    // top row
+    int row_start = y_start;
+    int row_num = height;
+    if (getTransformation().swap_xy) {
+        // The rows are written column by column, treat it as a whole frame
+        row_start = 0;
+        row_num = getFrameHeight();
+    } else if (getTransformation().mirror_y) {
+        row_start = getFrameHeight() - y_start - height;
+    }
+
+    /* Block on the TE semaphore: a wait for the next frame ends right at its pulse, a wait for the scanline to leave
+     * the rows is rounded up to the tick. The loop is bounded in case the pulses stop
+     */
+    const int64_t tick_us = static_cast<int64_t>(portTICK_PERIOD_MS) * 1000;
+    for (int i = 0; i < 3; i++) {
+        portENTER_CRITICAL(&_tear_sync->lock);
+        int64_t wait_us = _tear_sync->sync.getWaitTime(esp_timer_get_time(), row_start, row_num, width * height);
+        portEXIT_CRITICAL(&_tear_sync->lock);
+        if (wait_us <= 0) {
+            return;
+        }
+
+        // Drop the pulse given before this wait
+        xSemaphoreTake(_tear_sync->sem, 0);
+        xSemaphoreTake(_tear_sync->sem, static_cast<TickType_t>((wait_us + tick_us - 1) / tick_us));
+    }
+}
+
+// The interrupt handlers below only call the `always_inline` methods of the helper classes (stats, swap chain, tear
+// sync, refresh monitor and palette), which keeps them in IRAM without marking the helpers `IRAM_ATTR`
 IRAM_ATTR bool LCD::onDrawBitmapFinish(void *panel_io, void *edata, void *user_ctx)
 {
     Interruption::CallbackData *callback_data = (Interruption::CallbackData *)user_ctx;
@@ -1231,12 +2613,43 @@ IRAM_ATTR bool LCD::onDrawBitmapFinish(void *panel_io, void *edata, void *user_c
     }
 
     BaseType_t need_yield = pdFALSE;
-    if (lcd_ptr->_interruption.on_draw_bitmap_finish != nullptr) {
-        need_yield =
-            lcd_ptr->_interruption.on_draw_bitmap_finish(lcd_ptr->_interruption.data.user_data) ? pdTRUE : need_yield;
+    auto &interruption = lcd_ptr->_interruption;
+    // The transfers end in order, the ones without token (like `switchFrameBufferTo()`) don't finish a token
+    bool is_token = false;
+    portENTER_CRITICAL_ISR(&interruption.lock);
+    if (interruption.draw_bitmap_untracked_count > 0) {
+        interruption.draw_bitmap_untracked_count--;
+    } else if (interruption.draw_bitmap_finish_count != interruption.draw_bitmap_submit_count) {
+        interruption.draw_bitmap_finish_count = interruption.draw_bitmap_finish_count + 1;
+        is_token = true;
+    }
+    portEXIT_CRITICAL_ISR(&interruption.lock);
+    if (is_token) {
+#if ESP_PANEL_DRIVERS_LCD_ENABLE_STATS
+        auto &stats = lcd_ptr->_stats;
+        int64_t time_us = esp_timer_get_time();
+        portENTER_CRITICAL_ISR(&stats.lock);
+        stats.stats.onDrawBitmapFinish(interruption.draw_bitmap_finish_count, time_us);
+        portEXIT_CRITICAL_ISR(&stats.lock);
+#endif
+        if (interruption.draw_bitmap_slot_sem != nullptr) {
+            xSemaphoreGiveFromISR(interruption.draw_bitmap_slot_sem, &need_yield);
+        }
+    }
+    auto tear_sync = lcd_ptr->_tear_sync.get();
+    if (tear_sync != nullptr) {
+        portENTER_CRITICAL_ISR(&tear_sync->lock);
+        if ((tear_sync->write_start_us != 0) && (interruption.draw_bitmap_finish_count == tear_sync->write_token)) {
+            tear_sync->sync.onWriteFinish(tear_sync->write_pixels, esp_timer_get_time() - tear_sync->write_start_us);
+            tear_sync->write_start_us = 0;
+        }
+        portEXIT_CRITICAL_ISR(&tear_sync->lock);
+    }
+    if (interruption.on_draw_bitmap_finish != nullptr) {
+        need_yield = interruption.on_draw_bitmap_finish(interruption.data.user_data) ? pdTRUE : need_yield;
     }
-    if (lcd_ptr->_interruption.draw_bitmap_finish_sem != nullptr) {
-        xSemaphoreGiveFromISR(lcd_ptr->_interruption.draw_bitmap_finish_sem, &need_yield);
+    if (interruption.draw_bitmap_finish_sem != nullptr) {
+        xSemaphoreGiveFromISR(interruption.draw_bitmap_finish_sem, &need_yield);
     }
 
     return (need_yield == pdTRUE);
@@ -1254,7 +2667,32 @@ IRAM_ATTR bool LCD::onRefreshFinish(void *panel_io, void *edata, void *user_ctx)
         return false;
     }
 
+    auto &refresh_monitor = lcd_ptr->_refresh_monitor;
+    if (refresh_monitor.is_started) {
+        int64_t time_us = esp_timer_get_time();
+        portENTER_CRITICAL_ISR(&refresh_monitor.lock);
+        refresh_monitor.monitor.onFrameFinish(time_us);
+        portEXIT_CRITICAL_ISR(&refresh_monitor.lock);
+    }
+#if ESP_PANEL_DRIVERS_LCD_ENABLE_STATS
+    auto &stats = lcd_ptr->_stats;
+    int64_t refresh_time_us = esp_timer_get_time();
+    portENTER_CRITICAL_ISR(&stats.lock);
+    stats.stats.onRefreshFinish(refresh_time_us);
+    portEXIT_CRITICAL_ISR(&stats.lock);
+#endif
+
     BaseType_t need_yield = pdFALSE;
+    // The panel has switched to the queued buffer of the swap chain, release the previous front buffer
+    auto swap_chain = lcd_ptr->_swap_chain.get();
+    if ((swap_chain != nullptr) && swap_chain->chain.isInit()) {
+        portENTER_CRITICAL_ISR(&swap_chain->lock);
+        bool is_released = swap_chain->chain.onRefreshFinish();
+        portEXIT_CRITICAL_ISR(&swap_chain->lock);
+        if (is_released) {
+            xSemaphoreGiveFromISR(swap_chain->sem, &need_yield);
+        }
+    }
     if (lcd_ptr->_interruption.on_refresh_finish != nullptr) {
         need_yield =
             lcd_ptr->_interruption.on_refresh_finish(lcd_ptr->_interruption.data.user_data) ? pdTRUE : need_yield;
@@ -1263,4 +2701,85 @@ IRAM_ATTR bool LCD::onRefreshFinish(void *panel_io, void *edata, void *user_ctx)
     return (need_yield == pdTRUE);
 }
 
+IRAM_ATTR void LCD::onTearingEffect(void *arg)
+{
+    Interruption::CallbackData *callback_data = (Interruption::CallbackData *)arg;
+    if (callback_data == nullptr) {
+        return;
+    }
+
+    LCD *lcd_ptr = (LCD *)callback_data->lcd_ptr;
+    if (lcd_ptr == nullptr) {
+        return;
+    }
+
+    auto tear_sync = lcd_ptr->_tear_sync.get();
+    if (tear_sync == nullptr) {
+        return;
+    }
+
+    int64_t time_us = esp_timer_get_time();
+    portENTER_CRITICAL_ISR(&tear_sync->lock);
+    tear_sync->sync.onTearingEffect(time_us);
+    portEXIT_CRITICAL_ISR(&tear_sync->lock);
+
+    BaseType_t need_yield = pdFALSE;
+    xSemaphoreGiveFromISR(tear_sync->sem, &need_yield);
+    if (need_yield == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+IRAM_ATTR bool LCD::onBounceEmpty(void *panel, void *bounce_buf, int pos_px, int len_bytes, void *user_ctx)
+{
+    Interruption::CallbackData *callback_data = (Interruption::CallbackData *)user_ctx;
+    if (callback_data == nullptr) {
+        return false;
+    }
+
+    LCD *lcd_ptr = (LCD *)callback_data->lcd_ptr;
+    if (lcd_ptr == nullptr) {
+        return false;
+    }
+
+    auto &refresh_monitor = lcd_ptr->_refresh_monitor;
+    if (refresh_monitor.is_started) {
+        int64_t time_us = esp_timer_get_time();
+        portENTER_CRITICAL_ISR(&refresh_monitor.lock);
+        refresh_monitor.monitor.onBounceFill(time_us);
+        portEXIT_CRITICAL_ISR(&refresh_monitor.lock);
+    }
+
+    auto &indexed = lcd_ptr->_indexed_frame_buffer;
+    indexed.palette->expand(
+        indexed.buffer.get(), pos_px, len_bytes / indexed.bytes_per_pixel, static_cast<uint8_t *>(bounce_buf)
+    );
+
+    return false;
+}
+
+void LCD::onRefreshRecoveryTimer(void *arg)
+{
+    LCD *lcd_ptr = static_cast<LCD *>(arg);
+    if (lcd_ptr == nullptr) {
+        return;
+    }
+
+    auto &refresh_monitor = lcd_ptr->_refresh_monitor;
+    portENTER_CRITICAL(&refresh_monitor.lock);
+    bool need_restart = refresh_monitor.monitor.takeRestartRequest();
+    portEXIT_CRITICAL(&refresh_monitor.lock);
+    if (!need_restart) {
+        return;
+    }
+
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_RGB
+    // The transmission is restarted at the next VSYNC
+    esp_err_t ret = esp_lcd_rgb_panel_restart(lcd_ptr->refresh_panel);
+    if (ret != ESP_OK) {
+        ESP_UTILS_LOGE("Restart RGB panel failed(%s)", esp_err_to_name(ret));
+    }
+#endif // ESP_PANEL_DRIVERS_BUS_ENABLE_RGB
+}
+
 } // namespace esp_panel::drivers
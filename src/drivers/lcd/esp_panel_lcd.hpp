@@ -14,9 +14,18 @@
 #include "esp_lcd_panel_vendor.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
+#include "esp_timer.h"
 #include "utils/esp_panel_utils_cxx.hpp"
 #include "drivers/bus/esp_panel_bus_factory.hpp"
 #include "port/esp_panel_lcd_vendor_types.h"
+#include "esp_panel_lcd_color_convert.hpp"
+#include "esp_panel_lcd_damage.hpp"
+#include "esp_panel_lcd_palette.hpp"
+#include "esp_panel_lcd_refresh_monitor.hpp"
+#include "esp_panel_lcd_stats.hpp"
+#include "esp_panel_lcd_swap_chain.hpp"
+#include "esp_panel_lcd_tear_sync.hpp"
+#include "esp_panel_lcd_transform.hpp"
 #include "esp_panel_lcd_conf_internal.h"
 
 namespace esp_panel::drivers {
@@ -37,6 +46,21 @@ public:
      */
     static constexpr int FRAME_BUFFER_MAX_NUM = 3;
 
+    /**
+     * @brief Number of internal ping-pong buffers used to stream bitmaps
+     */
+    static constexpr int STREAM_BUFFER_NUM = 2;
+
+    /**
+     * @brief Size of the internal buffer used by `fillRect()`, in bytes
+     */
+    static constexpr size_t FILL_BUFFER_SIZE = 4096;
+
+    /**
+     * @brief Period of the check for the restart requested by the refresh monitor, in milliseconds
+     */
+    static constexpr int REFRESH_RECOVERY_CHECK_PERIOD_MS = 50;
+
     /**
      * @brief Panel handle type definition for refresh operations
      */
@@ -58,6 +82,14 @@ public:
      */
     using FunctionRefreshFinishCallback = bool (*)(void *user_data);
 
+    /**
+     * @brief Token type used to track the completion of an asynchronous bitmap drawing
+     *
+     * Tokens are increasing sequence numbers (wrapping around), so a token is finished once every transfer submitted
+     * before it has finished as well
+     */
+    using DrawBitmapToken = uint32_t;
+
     /**
      * @brief Basic bus specification structure for LCD devices
      */
@@ -167,6 +199,14 @@ public:
     using VendorFullConfig = esp_panel_lcd_vendor_config_t;
     using VendorConfig = std::variant<VendorPartialConfig, VendorFullConfig>;
 
+    /**
+     * @brief Tearing effect (TE) pin configuration structure, only valid for SPI, QSPI and I80 bus
+     */
+    struct TearingEffectConfig {
+        int gpio_num = -1;              /*!< TE GPIO pin number (-1 if unused) */
+        int active_level = 1;           /*!< Level of the TE pulse, its leading edge marks the start of a frame */
+    };
+
     /**
      * @brief Configuration structure for LCD device
      */
@@ -208,6 +248,7 @@ public:
 
         DeviceConfig device = DevicePartialConfig{};     /*!< Device configuration storage */
         VendorConfig vendor = VendorPartialConfig{};     /*!< Vendor configuration storage */
+        TearingEffectConfig tearing_effect = {};         /*!< TE pin configuration */
     };
 
     /**
@@ -373,6 +414,20 @@ public:
      */
     bool configResetActiveLevel(int level);
 
+    /**
+     * @brief Configure the tearing effect (TE) pin of LCD
+     *
+     * When configured, each `drawBitmap()` is scheduled against the TE pulses so that the write never crosses the
+     * scanline of the panel. The measured refresh rate is available by `getRefreshRate()`.
+     *
+     * @param[in] gpio_num TE GPIO pin number, -1 to disable
+     * @param[in] active_level Level of the TE pulse, 0: low, 1: high
+     * @return `true` if successful, `false` otherwise
+     * @note This function should be called before `begin()`, and only valid for SPI, QSPI and I80 bus
+     * @note The TE output of the panel should be enabled by the initialization commands (`TEON`, 0x35)
+     */
+    bool configTearingEffectIO(int gpio_num, int active_level = 1);
+
     /**
      * @brief Configure the number of frame buffers
      *
@@ -383,6 +438,63 @@ public:
      */
     bool configFrameBufferNumber(int num);
 
+    /**
+     * @brief Configure an indexed frame buffer instead of the RGB frame buffers
+     *
+     * The application frame buffer holds a palette index for each pixel (see `LCD_Palette` for the layout), and it is
+     * expanded to RGB565/RGB888 through the palette while the bounce buffers are filled in the interrupt. This cuts
+     * the size and the PSRAM bandwidth of the frame buffer by 2-6x.
+     *
+     * In this mode, the data of `drawBitmap()` are indexes in the same format, each row starting at a byte boundary.
+     * The frame buffer is available by `getIndexedFrameBuffer()` and the colors are set by `setPaletteColors()`.
+     *
+     * @param[in] format Index format
+     * @return `true` if successful, `false` otherwise
+     * @note This function should be called before `init()`, and only valid for the RGB bus
+     * @note The bounce buffers should be enabled by `BusRGB::configRGB_BounceBufferSize()`, and the color bits of the
+     *       bus should be 16 or 24
+     * @note The palette is allocated by this function and the frame buffer is allocated from PSRAM (if available) in
+     *       `begin()`. The palette is read in the interrupt, so the general memory allocator should use internal SRAM
+     *       if `CONFIG_LCD_RGB_ISR_IRAM_SAFE` is set
+     */
+    bool configIndexedFrameBuffer(LCD_Palette::IndexFormat format);
+
+    /**
+     * @brief Configure the detection of the refresh underruns and the automatic recovery from them
+     *
+     * When the bounce buffer refill can't keep up with the pixel clock, the panel shows the stale pixels shifted (the
+     * screen "drift"). The bounce buffer fills are timestamped, and the frames with a fill later than the transmission
+     * time of a bounce buffer are counted as underruns. Each underrun restarts the transmission at the next VSYNC by
+     * `esp_lcd_rgb_panel_restart()`, and the counters are available by `getRefreshMonitor()`. The late frame
+     * interrupts are only counted, since they are paced by the pixel clock and only show the interrupt latency.
+     *
+     * @param[in] en Whether to enable
+     * @param[in] tolerance_percent Intervals longer than the nominal ones by more than this percentage are underruns
+     * @return `true` if successful, `false` otherwise
+     * @note This function should be called before `begin()` and after `configIndexedFrameBuffer()`, since the bounce
+     *       buffer fills are only observable when they are done by the driver. It is only valid for the RGB bus which
+     *       is not refreshed on demand
+     * @note The restart is requested from an `esp_timer` every `REFRESH_RECOVERY_CHECK_PERIOD_MS` milliseconds, since
+     *       `esp_lcd_rgb_panel_restart()` can't be called in the interrupt
+     */
+    bool configRefreshRecovery(bool en, int tolerance_percent = LCD_RefreshMonitor::TOLERANCE_PERCENT_DEFAULT);
+
+    /**
+     * @brief Configure the size of the internal buffers used to stream bitmaps which are not DMA-capable
+     *
+     * When enabled, `drawBitmap()` and `drawBitmapAsync()` split the bitmap located in non-DMA-capable memory (like
+     * PSRAM) into strips, and copy strip N+1 into one internal ping-pong buffer while strip N is transmitted from the
+     * other one
+     *
+     * @param[in] size Size of each buffer in bytes, `0` means disable the streaming (default)
+     * @return `true` if successful, `false` otherwise
+     * @note This function should be called before `begin()`
+     * @note The buffers are allocated from internal DMA-capable memory in `begin()`, and a strip always contains full
+     *       rows aligned to `y_coord_align`, so the size should be able to hold at least `y_coord_align` rows
+     * @note This function is not valid for the RGB/MIPI-DSI bus
+     */
+    bool configStreamBufferSize(size_t size);
+
     /**
      * @brief Initialize the LCD device
      *
@@ -440,6 +552,244 @@ public:
      */
     bool drawBitmap(int x_start, int y_start, int width, int height, const uint8_t *color_data, int timeout_ms = 0);
 
+    /**
+     * @brief Queue the bitmap to be drawn to the LCD and return a token to track its completion
+     *
+     * @param[in] x_start X coordinate of the start point, the range is [0, lcd_width - 1]
+     * @param[in] y_start Y coordinate of the start point, the range is [0, lcd_height - 1]
+     * @param[in] width Width of the bitmap, the range is [0, lcd_width - x_start]
+     * @param[in] height Height of the bitmap, the range is [0, lcd_height - y_start]
+     * @param[in] color_data Pointer of the color data array
+     * @param[out] token Pointer to store the token of this transfer, set to `nullptr` if not needed
+     * @param[in] timeout_ms Wait timeout for a free queue slot in milliseconds, default is -1 (wait forever)
+     * @return `true` if successful, `false` otherwise
+     * @note This function should be called after `begin()`
+     * @note Up to `getDrawBitmapQueueDepth()` transfers can be in flight at the same time, this function only blocks
+     *       when the queue is full
+     * @note The bitmap data should not be modified until `waitDrawBitmapFinish()` returns `true` for the token
+     * @note For bus which not use DMA operation (like RGB), the token is finished when this function returns
+     * @note If the bitmap is streamed through the internal buffers (see `configStreamBufferSize()`), it is fully copied
+     *       when this function returns and the token is the one of the last strip
+     * @note The tokens are counted without lock, so the drawing functions should be called from a single task
+     */
+    bool drawBitmapAsync(
+        int x_start, int y_start, int width, int height, const uint8_t *color_data, DrawBitmapToken *token = nullptr,
+        int timeout_ms = -1
+    );
+
+    /**
+     * @brief Draw a bitmap of another pixel format to the LCD, it is converted strip by strip while streaming
+     *
+     * @param[in] x_start X coordinate of the start point, the range is [0, lcd_width - 1]
+     * @param[in] y_start Y coordinate of the start point, the range is [0, lcd_height - 1]
+     * @param[in] width Width of the bitmap, the range is [0, lcd_width - x_start]
+     * @param[in] height Height of the bitmap, the range is [0, lcd_height - y_start]
+     * @param[in] color_data Pointer of the color data array
+     * @param[in] color_format Pixel format of the color data, see `LCD_ColorConvert::PixelFormat`
+     * @param[in] timeout_ms Maximum time to wait for drawing completion in milliseconds. Set to `-1` to wait
+     *                       indefinitely, `0` to return once the bitmap is queued
+     * @return `true` if successful, `false` otherwise
+     * @note The color bits of the panel should be 16/18/24. If the format is different from the panel, the stream
+     *       buffers are required, call `configStreamBufferSize()` before `begin()`
+     * @note The bitmap is fully converted when this function returns, so it can be immediately modified
+     */
+    bool drawBitmap(
+        int x_start, int y_start, int width, int height, const uint8_t *color_data,
+        LCD_ColorConvert::PixelFormat color_format, int timeout_ms = 0
+    );
+
+    /**
+     * @brief Queue a bitmap of another pixel format to be drawn to the LCD and return a token to track its completion
+     *
+     * @param[in] x_start X coordinate of the start point, the range is [0, lcd_width - 1]
+     * @param[in] y_start Y coordinate of the start point, the range is [0, lcd_height - 1]
+     * @param[in] width Width of the bitmap, the range is [0, lcd_width - x_start]
+     * @param[in] height Height of the bitmap, the range is [0, lcd_height - y_start]
+     * @param[in] color_data Pointer of the color data array
+     * @param[in] color_format Pixel format of the color data, see `LCD_ColorConvert::PixelFormat`
+     * @param[out] token Pointer to store the token of this transfer, set to `nullptr` if not needed
+     * @param[in] timeout_ms Wait timeout for a free queue slot or stream buffer in milliseconds, default is -1 (wait
+     *                       forever)
+     * @return `true` if successful, `false` otherwise
+     * @note Same as `drawBitmap()` with a pixel format, see `drawBitmapAsync()` for the token
+     */
+    bool drawBitmapAsync(
+        int x_start, int y_start, int width, int height, const uint8_t *color_data,
+        LCD_ColorConvert::PixelFormat color_format, DrawBitmapToken *token = nullptr, int timeout_ms = -1
+    );
+
+    /**
+     * @brief Wait for the asynchronous bitmap drawing specified by the token to finish
+     *
+     * @param[in] token Token returned by `drawBitmapAsync()`
+     * @param[in] timeout_ms Wait timeout in milliseconds, default is -1 (wait forever), 0 means check only
+     * @return `true` if the drawing is finished, `false` if timeout or error
+     * @note This function should be called after `begin()`
+     * @note Waiting for a token also waits for all the tokens submitted before it
+     */
+    bool waitDrawBitmapFinish(DrawBitmapToken token, int timeout_ms = -1);
+
+    /**
+     * @brief Wait for all the queued bitmap drawings to finish
+     *
+     * @param[in] timeout_ms Wait timeout in milliseconds, default is -1 (wait forever)
+     * @return `true` if all drawings are finished, `false` if timeout or error
+     * @note This function should be called after `begin()`
+     */
+    bool waitDrawBitmapFinishAll(int timeout_ms = -1);
+
+    /**
+     * @brief Check if the asynchronous bitmap drawing specified by the token is finished
+     *
+     * @param[in] token Token returned by `drawBitmapAsync()`
+     * @return `true` if finished, `false` otherwise
+     */
+    bool isDrawBitmapFinished(DrawBitmapToken token) const
+    {
+        return static_cast<int32_t>(_interruption.draw_bitmap_finish_count - token) >= 0;
+    }
+
+    /**
+     * @brief Get the maximum number of bitmap drawings that can be in flight at the same time
+     *
+     * @return Queue depth, `0` if the LCD is not begun
+     * @note For SPI/QSPI/I80 bus, it is the transaction queue depth set by `configSPI_TransQueueDepth()`,
+     *       `configQSPI_TransQueueDepth()` or `configI80_TransQueueDepth()`. For other bus, it is `1`
+     */
+    int getDrawBitmapQueueDepth() const
+    {
+        return _interruption.draw_bitmap_queue_depth;
+    }
+
+    /**
+     * @brief Get the size of each internal stream buffer
+     *
+     * @return Size in bytes, `0` if the streaming is disabled
+     */
+    size_t getStreamBufferSize() const
+    {
+        return _stream.buffer_size;
+    }
+
+    /**
+     * @brief Set the software transformation (rotation and mirroring) applied to the bitmaps while streaming
+     *
+     * The bitmaps given to `drawBitmap()` and `drawBitmapAsync()` are transformed strip by strip into the internal
+     * stream buffers, their coordinates are in the transformed space (width and height are swapped for 90/270 degrees)
+     *
+     * @param[in] operation Transformation operation, see `LCD_Transform::Rotation` for the direction of the rotation
+     * @return `true` if successful, `false` otherwise
+     * @note The stream buffers are required, call `configStreamBufferSize()` before `begin()`
+     * @note This function waits for all the queued drawings to finish if the LCD is begun
+     * @note Prefer the hardware transformations (`swapXY()`, `mirrorX()`, `mirrorY()`) when they are supported
+     */
+    bool setDrawBitmapTransform(const LCD_Transform::Operation &operation);
+
+    /**
+     * @brief Get the software transformation applied to the bitmaps while streaming
+     *
+     * @return Transformation operation
+     */
+    const LCD_Transform::Operation &getDrawBitmapTransform() const
+    {
+        return _stream.transform;
+    }
+
+    /**
+     * @brief Enable or disable swapping the two bytes of each RGB565 pixel while streaming
+     *
+     * SPI/QSPI (and 8-bit I80) panels expect big-endian RGB565 data. When enabled, the bitmaps given to `drawBitmap()`
+     * and `drawBitmapAsync()` can be in the native little-endian order, the bytes are swapped while being copied into
+     * the internal stream buffers instead of by a separate pass over the whole bitmap
+     *
+     * @param[in] en true to enable, false to disable
+     * @return `true` if successful, `false` otherwise
+     * @note The stream buffers are required, call `configStreamBufferSize()` before `begin()`
+     * @note Only valid when the color bits is 16 (RGB565)
+     * @note This function waits for all the queued drawings to finish if the LCD is begun
+     */
+    bool setDrawBitmapSwapBytes(bool en);
+
+    /**
+     * @brief Check if the RGB565 bytes are swapped while streaming
+     *
+     * @return `true` if enabled, `false` otherwise
+     */
+    bool getDrawBitmapSwapBytes() const
+    {
+        return _stream.swap_bytes;
+    }
+
+    /**
+     * @brief Enable or disable the ordered dithering when converting the pixel format while streaming
+     *
+     * A 4x4 Bayer pattern aligned to the bitmap coordinates hides the banding of the gradients when the components are
+     * reduced to 5/6 bits, see `drawBitmap()` with a pixel format
+     *
+     * @param[in] en true to enable, false to disable
+     * @return `true` if successful, `false` otherwise
+     * @note This function waits for all the queued drawings to finish if the LCD is begun
+     */
+    bool setDrawBitmapDither(bool en);
+
+    /**
+     * @brief Check if the ordered dithering is enabled when converting the pixel format
+     *
+     * @return `true` if enabled, `false` otherwise
+     */
+    bool getDrawBitmapDither() const
+    {
+        return _stream.dither;
+    }
+
+    /**
+     * @brief Mark a rectangle of the shadow buffer as damaged, it will be sent by `flushDamage()`
+     *
+     * The rectangle is snapped to the coordinate alignment of the panel and merged with the other damaged rectangles
+     * when sending their bounding box is cheaper than sending them separately, see `setDamageTransactionCost()`.
+     * The coordinates are the same as `drawBitmap()`.
+     *
+     * @param[in] x_start X coordinate of the start point
+     * @param[in] y_start Y coordinate of the start point
+     * @param[in] width Width of the rectangle
+     * @param[in] height Height of the rectangle
+     * @return `true` if successful, `false` otherwise
+     */
+    bool invalidateRect(int x_start, int y_start, int width, int height);
+
+    /**
+     * @brief Send the damaged rectangles of the shadow buffer to the panel and clear them
+     *
+     * @param[in] shadow_buffer Pointer of the shadow buffer, it holds the whole image in the coordinates of
+     *                          `drawBitmap()` with packed lines
+     * @param[in] timeout_ms Maximum time to wait for all the windows to be finished in milliseconds. Set to `-1` to
+     *                       wait indefinitely, `0` to return once they are queued
+     * @return `true` if successful, `false` otherwise
+     * @note For the RGB and MIPI-DSI bus, the windows are copied line by line into the frame buffer. For the other
+     *       buses, only the windows which span the whole width can be sent directly, the others are gathered through
+     *       the stream buffers, call `configStreamBufferSize()` before `begin()`
+     */
+    bool flushDamage(const uint8_t *shadow_buffer, int timeout_ms = -1);
+
+    /**
+     * @brief Set the cost of sending a window used to merge the damaged rectangles
+     *
+     * @param[in] pixels Cost in pixels, it should match the time of the window commands and the transfer setup.
+     *                   Larger values produce fewer and larger windows
+     * @return `true` if successful, `false` otherwise
+     */
+    bool setDamageTransactionCost(int pixels);
+
+    /**
+     * @brief Get the damage tracker which holds the pending rectangles
+     *
+     * @return Damage tracker pointer, or nullptr if `invalidateRect()` is never called
+     */
+    const LCD_DamageTracker *getDamageTracker() const
+    {
+        return _damage.get();
+    }
+
     /**
      * @brief Mirror the X axis
      *
@@ -542,9 +892,176 @@ public:
      * @note This function is only valid for RGB/MIPI-DSI bus which maintains frame buffer (GRAM)
      * @note This function should be called after `begin()`
      * @note This function typically calls `esp_lcd_panel_draw_bitmap()` to switch to the specified frame buffer
+     * @note For MIPI-DSI bus, this function waits for the bitmaps queued by `drawBitmapAsync()` to finish first
      */
     bool switchFrameBufferTo(void *frame_buffer);
 
+    /**
+     * @brief Create a swap chain on the frame buffers for tear-free multiple buffering
+     *
+     * The frame buffers from `getFrameBufferByIndex()` are handed out by `acquireBackBuffer()` and shown by
+     * `present()`. The previous front buffer is only released after the panel has switched to the new one, which is
+     * signaled by the refresh finish interrupt, so the application never renders into a buffer being scanned out.
+     *
+     * @param[in] buffer_num Number of frame buffers, should be 2 or 3 and not more than the configured number (see
+     *                       `configFrameBufferNumber()`)
+     * @param[in] mode Present mode, see `LCD_SwapChain::PresentMode`
+     * @return `true` if successful, `false` otherwise
+     * @note This function should be called after `begin()`, and only valid for RGB and MIPI-DSI bus
+     * @note The panel is switched to the first frame buffer
+     */
+    bool initSwapChain(int buffer_num, LCD_SwapChain::PresentMode mode = LCD_SwapChain::PresentMode::FIFO);
+
+    /**
+     * @brief Delete the swap chain, the frame buffers are kept
+     *
+     * @return `true` if successful, `false` otherwise
+     */
+    bool delSwapChain();
+
+    /**
+     * @brief Acquire a back buffer of the swap chain for rendering
+     *
+     * @param[out] age Pointer to store the age of the buffer, set to `nullptr` if not needed. `1` means the buffer
+     *                 holds the previous frame, `N` the frame presented `N` presents ago, and `0` means undefined.
+     *                 Only the areas changed in the last `age` frames need to be redrawn
+     * @param[in] timeout_ms Wait timeout for a free buffer in milliseconds, default is -1 (wait forever)
+     * @return Pointer of the buffer, `nullptr` if failed or timeout
+     * @note The buffer should be passed to `present()` or `releaseBackBuffer()` afterwards
+     * @note Use `repairBackBuffer()` to bring the buffer up to date with the latest frame
+     */
+    void *acquireBackBuffer(int *age = nullptr, int timeout_ms = -1);
+
+    /**
+     * @brief Bring an acquired back buffer up to date with the latest presented frame
+     *
+     * Only the regions damaged since the buffer was last presented are copied from the latest frame, according to the
+     * damage history recorded by `present()`. The whole frame is copied if the history is not long enough.
+     *
+     * @param[in] buffer Pointer of the buffer returned by `acquireBackBuffer()`
+     * @param[in] age Age of the buffer returned by `acquireBackBuffer()`
+     * @param[in] skip_rects Rectangles which will be fully redrawn in this frame, the damaged regions inside any of
+     *                       them are not copied. Set to `nullptr` if not needed
+     * @param[in] skip_rect_num Number of the rectangles in `skip_rects`
+     * @return `true` if successful, `false` otherwise
+     * @note The rectangles are in the frame buffer coordinates, which are not affected by the transformation
+     */
+    bool repairBackBuffer(
+        void *buffer, int age, const LCD_Transform::Rect *skip_rects = nullptr, int skip_rect_num = 0
+    );
+
+    /**
+     * @brief Give back an acquired buffer without presenting it
+     *
+     * @param[in] buffer Pointer of the buffer returned by `acquireBackBuffer()`
+     * @return `true` if successful, `false` otherwise
+     */
+    bool releaseBackBuffer(void *buffer);
+
+    /**
+     * @brief Present an acquired buffer, the panel switches to it at the next refresh
+     *
+     * @param[in] buffer Pointer of the buffer returned by `acquireBackBuffer()`
+     * @param[in] timeout_ms Wait timeout in milliseconds when another buffer is waiting to be shown (FIFO mode only),
+     *                       default is -1 (wait forever)
+     * @return `true` if successful, `false` otherwise
+     * @note This function should be called from a single task
+     * @note In MAILBOX mode, this function never waits. A buffer presented but not shown yet is released and counted
+     *       by `LCD_SwapChain::getDroppedCount()`
+     */
+    bool present(void *buffer, int timeout_ms = -1)
+    {
+        return present(buffer, nullptr, 0, timeout_ms);
+    }
+
+    /**
+     * @brief Present an acquired buffer and record the regions changed in it
+     *
+     * Same as `present(void *, int)`, the damaged rectangles are recorded in the damage history so that
+     * `repairBackBuffer()` only copies them into the buffers reused later
+     *
+     * @param[in] buffer Pointer of the buffer returned by `acquireBackBuffer()`
+     * @param[in] damage_rects Rectangles changed compared with the previous frame, in the frame buffer coordinates.
+     *                         Set to `nullptr` if the whole frame changes
+     * @param[in] damage_rect_num Number of the rectangles in `damage_rects`
+     * @param[in] timeout_ms Wait timeout in milliseconds when another buffer is waiting to be shown (FIFO mode only),
+     *                       default is -1 (wait forever)
+     * @return `true` if successful, `false` otherwise
+     */
+    bool present(void *buffer, const LCD_Transform::Rect *damage_rects, int damage_rect_num, int timeout_ms = -1);
+
+    /**
+     * @brief Get the refresh rate of the panel measured from the TE pulses
+     *
+     * @return Refresh rate in Hz, `0` if the TE pin is not configured or not enough pulses are received
+     */
+    float getRefreshRate();
+
+    /**
+     * @brief Get a snapshot of the TE synchronization state
+     *
+     * @return TE synchronization state, see `LCD_TearSync`
+     */
+    LCD_TearSync getTearSync();
+
+    /**
+     * @brief Get a snapshot of the refresh underrun counters
+     *
+     * @return Refresh monitor, see `LCD_RefreshMonitor`. All counters are `0` if `configRefreshRecovery()` is not
+     *         enabled
+     */
+    LCD_RefreshMonitor getRefreshMonitor();
+
+    /**
+     * @brief Get a snapshot of the performance counters
+     *
+     * The counters are reset by `begin()`. Print them by `LCD_Stats::toString()`.
+     *
+     * @return Performance counters, see `LCD_Stats`. All counters are `0` if `ESP_PANEL_DRIVERS_LCD_ENABLE_STATS` is
+     *         disabled or the driver is not begun
+     */
+    LCD_Stats getStats();
+
+    /**
+     * @brief Reset the performance counters
+     *
+     * @note This function does nothing if `ESP_PANEL_DRIVERS_LCD_ENABLE_STATS` is disabled
+     */
+    void resetStats();
+
+    /**
+     * @brief Get the swap chain state
+     *
+     * @return Swap chain pointer, or nullptr if `initSwapChain()` is not called
+     */
+    const LCD_SwapChain *getSwapChain() const
+    {
+        return (_swap_chain != nullptr) ? &_swap_chain->chain : nullptr;
+    }
+
+    /**
+     * @brief Fill a rectangle of the LCD with a solid color
+     *
+     * A small internal buffer (`FILL_BUFFER_SIZE`) is filled once with the color and sent repeatedly, so no bitmap of
+     * the rectangle size is allocated
+     *
+     * @param[in] x_start X coordinate of the start point, the range is [0, lcd_width - 1]
+     * @param[in] y_start Y coordinate of the start point, the range is [0, lcd_height - 1]
+     * @param[in] width Width of the rectangle, the range is [0, lcd_width - x_start]
+     * @param[in] height Height of the rectangle, the range is [0, lcd_height - y_start]
+     * @param[in] color Pixel value in the panel color format. Its bytes are stored from the lowest one, the same as
+     *                  the data of `drawBitmap()` (e.g. for SPI panels, RGB565 should be byte swapped unless
+     *                  `setDrawBitmapSwapBytes()` is enabled)
+     * @param[in] timeout_ms Maximum time to wait for the filling to finish in milliseconds. Set to `-1` to wait
+     *                       indefinitely, `0` to return once it is queued
+     * @return `true` if successful, `false` otherwise
+     * @note This function should be called after `begin()`
+     * @note The coordinates are the same as `drawBitmap()`, including the software transformation
+     * @note For RGB/MIPI-DSI bus, the rows are copied into the frame buffer by the driver, which keeps the mirroring
+     *       and the cache coherence handled
+     */
+    bool fillRect(int x_start, int y_start, int width, int height, uint32_t color, int timeout_ms = 0);
+
     /**
      * @brief Draw color bars for testing
      *
@@ -634,6 +1151,39 @@ public:
      */
     void *getFrameBufferByIndex(uint8_t index = 0);
 
+    /**
+     * @brief Set the colors of the palette of the indexed frame buffer
+     *
+     * @param[in] start First index to set
+     * @param[in] colors Colors in `0xRRGGBB` format
+     * @param[in] num Number of colors
+     * @return `true` if successful, `false` otherwise
+     * @note This function should be called after `begin()`, and only valid when `configIndexedFrameBuffer()` is used
+     * @note The colors take effect from the next filled bounce buffer, all the colors are black after `begin()`
+     */
+    bool setPaletteColors(int start, const uint32_t *colors, int num);
+
+    /**
+     * @brief Get the indexed frame buffer
+     *
+     * @return Frame buffer pointer, or nullptr if `configIndexedFrameBuffer()` is not used or not begun
+     * @note The size is `LCD_Palette::getFrameBufferSize()` of the frame resolution
+     */
+    void *getIndexedFrameBuffer()
+    {
+        return _indexed_frame_buffer.buffer.get();
+    }
+
+    /**
+     * @brief Get the palette of the indexed frame buffer
+     *
+     * @return Palette pointer, or nullptr if `configIndexedFrameBuffer()` is not used
+     */
+    const LCD_Palette *getPalette() const
+    {
+        return _indexed_frame_buffer.palette.get();
+    }
+
     /**
      * @brief Get LCD basic attributes
      *
@@ -892,7 +1442,177 @@ private:
         FunctionRefreshFinishCallback on_refresh_finish = nullptr;        /*!< Refresh completion callback */
         SemaphoreHandle_t draw_bitmap_finish_sem = nullptr;              /*!< Draw completion semaphore */
         std::shared_ptr<StaticSemaphore_t> on_draw_bitmap_finish_sem_buffer = nullptr; /*!< Semaphore buffer */
+        SemaphoreHandle_t draw_bitmap_slot_sem = nullptr;                /*!< Free draw queue slots semaphore */
+        std::shared_ptr<StaticSemaphore_t> draw_bitmap_slot_sem_buffer = nullptr;     /*!< Semaphore buffer */
+        int draw_bitmap_queue_depth = 0;                                  /*!< Maximum in-flight drawings */
+        // Only written by the drawing task, the drawing functions shouldn't be called from several tasks at once
+        volatile DrawBitmapToken draw_bitmap_submit_count = 0;            /*!< Number of submitted drawings */
+        volatile DrawBitmapToken draw_bitmap_finish_count = 0;            /*!< Number of finished drawings */
+        uint32_t draw_bitmap_untracked_count = 0;                         /*!< In-flight transfers without token */
+        portMUX_TYPE lock = {};                                           /*!< Lock against the draw finish interrupt */
+    };
+
+    /**
+     * @brief Streaming buffers structure
+     */
+    struct Stream {
+        size_t buffer_size = 0;                                            /*!< Size of each buffer in bytes */
+        LCD_Transform::Operation transform = {};                           /*!< Software transformation per strip */
+        bool swap_bytes = false;                                           /*!< Swap RGB565 bytes per strip */
+        bool dither = false;                                               /*!< Dither the converted strips */
+        std::shared_ptr<uint8_t> buffers[STREAM_BUFFER_NUM] = {};          /*!< Internal DMA-capable buffers */
+        DrawBitmapToken buffer_tokens[STREAM_BUFFER_NUM] = {};             /*!< Last drawing token of each buffer */
+        int buffer_index = 0;                                              /*!< Index of the next buffer to fill */
+    };
+
+    /**
+     * @brief Swap chain context structure
+     */
+    struct SwapChainContext {
+        LCD_SwapChain chain = {};               /*!< Buffer states */
+        LCD_DamageHistory history = {};         /*!< Damage of the presented frames */
+        portMUX_TYPE lock = {};                 /*!< Lock against the refresh interrupt */
+        SemaphoreHandle_t sem = nullptr;        /*!< Given when a buffer is released */
+        StaticSemaphore_t sem_buffer = {};      /*!< Semaphore buffer */
+    };
+
+    /**
+     * @brief TE synchronization context structure
+     */
+    struct TearSyncContext {
+        LCD_TearSync sync = {};                 /*!< TE timing estimate and scheduler */
+        portMUX_TYPE lock = {};                 /*!< Lock against the TE and draw finish interrupts */
+        int64_t write_start_us = 0;             /*!< Start time of the measured write, 0 if none */
+        int write_pixels = 0;                   /*!< Number of pixels of the measured write */
+        DrawBitmapToken write_token = 0;        /*!< Token of the measured write */
+        SemaphoreHandle_t sem = nullptr;        /*!< Given on each TE pulse */
+        StaticSemaphore_t sem_buffer = {};      /*!< Semaphore buffer */
+    };
+
+    /**
+     * @brief Refresh monitor context structure
+     */
+    struct RefreshMonitorContext {
+        LCD_RefreshMonitor monitor = {};        /*!< Underrun detection */
+        portMUX_TYPE lock = {};                 /*!< Lock against the refresh interrupts */
+        bool is_enabled = false;                /*!< Whether the recovery is configured */
+        bool is_started = false;                /*!< Whether the interrupts are monitored */
+        int tolerance_percent = LCD_RefreshMonitor::TOLERANCE_PERCENT_DEFAULT; /*!< Lateness tolerance */
+        esp_timer_handle_t timer = nullptr;     /*!< Timer to take the restart requests */
+    };
+
+#if ESP_PANEL_DRIVERS_LCD_ENABLE_STATS
+    /**
+     * @brief Performance counters context structure
+     */
+    struct StatsContext {
+        LCD_Stats stats = {};                   /*!< Performance counters */
+        portMUX_TYPE lock = {};                 /*!< Lock against the draw and refresh finish interrupts */
+        bool is_started = false;                /*!< Whether the lock is initialized */
     };
+#endif
+
+    /**
+     * @brief Solid fill buffer structure
+     */
+    struct Fill {
+        std::shared_ptr<uint8_t> buffer = nullptr;  /*!< Internal DMA-capable buffer of `FILL_BUFFER_SIZE` bytes */
+        bool is_filled = false;                     /*!< Whether the buffer holds `color` */
+        uint32_t color = 0;                         /*!< Pixel value of the buffer */
+        DrawBitmapToken token = 0;                  /*!< Last drawing token of the buffer */
+    };
+
+    /**
+     * @brief Indexed frame buffer structure
+     */
+    struct IndexedFrameBuffer {
+        bool is_enabled = false;                                        /*!< Whether the mode is configured */
+        LCD_Palette::IndexFormat format = LCD_Palette::IndexFormat::I8; /*!< Index format */
+        std::shared_ptr<LCD_Palette> palette = nullptr;                 /*!< Color lookup table */
+        std::shared_ptr<uint8_t> buffer = nullptr;                      /*!< Indexed frame buffer */
+        int bytes_per_pixel = 0;                                        /*!< Bytes per pixel of the bounce buffers */
+    };
+
+    /**
+     * @brief Submit the bitmap to the refresh panel directly
+     *
+     * @param[in] x_start X coordinate of the start point
+     * @param[in] y_start Y coordinate of the start point
+     * @param[in] x_end X coordinate of the end point (exclusive)
+     * @param[in] y_end Y coordinate of the end point (exclusive)
+     * @param[in] color_data Pointer of the color data array
+     * @param[out] token Pointer to store the token of this transfer
+     * @param[in] timeout_ms Wait timeout for a free queue slot in milliseconds
+     * @return `true` if successful, `false` otherwise
+     */
+    bool drawBitmapDirect(
+        int x_start, int y_start, int x_end, int y_end, const uint8_t *color_data, DrawBitmapToken &token,
+        int timeout_ms
+    );
+
+    /**
+     * @brief Stream the bitmap to the refresh panel through the internal ping-pong buffers
+     *
+     * @param[in] x_start X coordinate of the start point
+     * @param[in] y_start Y coordinate of the start point
+     * @param[in] width Width of the bitmap
+     * @param[in] height Height of the bitmap
+     * @param[in] color_data Pointer of the color data array
+     * @param[in] color_stride Bytes per line of the color data, `0` means packed
+     * @param[in] color_format Pixel format of the color data to convert from, `nullptr` if already in the panel format
+     * @param[out] token Pointer to store the token of the last strip
+     * @param[in] timeout_ms Wait timeout for a free queue slot or buffer in milliseconds
+     * @return `true` if successful, `false` otherwise
+     */
+    bool drawBitmapByStream(
+        int x_start, int y_start, int width, int height, const uint8_t *color_data, size_t color_stride,
+        const LCD_ColorConvert::PixelFormat *color_format, DrawBitmapToken &token, int timeout_ms
+    );
+
+    /**
+     * @brief Check the parameters of a bitmap drawing
+     *
+     * @param[in] x_start X coordinate of the start point
+     * @param[in] y_start Y coordinate of the start point
+     * @param[in] width Width of the bitmap
+     * @param[in] height Height of the bitmap
+     * @param[in] color_data Pointer of the color data array
+     * @return `true` if valid, `false` otherwise
+     */
+    bool checkDrawBitmapParams(int x_start, int y_start, int width, int height, const uint8_t *color_data);
+
+    /**
+     * @brief Check if the swap chain is initialized
+     *
+     * @return `true` if initialized, `false` otherwise
+     */
+    bool isSwapChainInit() const
+    {
+        return (_swap_chain != nullptr) && _swap_chain->chain.isInit();
+    }
+
+    /**
+     * @brief Update the damage tracker configuration from the current panel state, the tracker should be allocated
+     */
+    void updateDamageConfig();
+
+    /**
+     * @brief Wait until a write to a rectangle doesn't cross the scanline, only if the TE pin is configured
+     *
+     * @param[in] x_start Start X coordinate of the rectangle, after the software transformation
+     * @param[in] y_start Start Y coordinate of the rectangle, after the software transformation
+     * @param[in] width Width of the rectangle
+     * @param[in] height Height of the rectangle
+     */
+    void waitTearingEffect(int x_start, int y_start, int width, int height);
+
+    /**
+     * @brief Check if the bitmap should be streamed through the internal buffers
+     *
+     * @param[in] color_data Pointer of the color data array
+     * @return `true` if streaming is enabled and the data is not DMA-capable, `false` otherwise
+     */
+    bool isStreamRequired(const uint8_t *color_data) const;
 
     /**
      * @brief Get device full configuration
@@ -930,8 +1650,18 @@ private:
     const BusDSI::RefreshPanelFullConfig *getBusDSI_RefreshPanelFullConfig();
 #endif
 
+    /**
+     * @brief Get the number of bitmap drawings the bus can keep in flight
+     *
+     * @return Queue depth, at least `1`
+     */
+    int getBusDrawBitmapQueueDepth();
+
     IRAM_ATTR static bool onDrawBitmapFinish(void *panel_io, void *edata, void *user_ctx);
     IRAM_ATTR static bool onRefreshFinish(void *panel_io, void *edata, void *user_ctx);
+    IRAM_ATTR static void onTearingEffect(void *arg);
+    IRAM_ATTR static bool onBounceEmpty(void *panel, void *bounce_buf, int pos_px, int len_bytes, void *user_ctx);
+    static void onRefreshRecoveryTimer(void *arg);
 
     BasicAttributes _basic_attributes = {};     /*!< Basic device attributes */
     std::shared_ptr<Bus> _bus = nullptr;        /*!< Bus interface pointer */
@@ -939,6 +1669,17 @@ private:
     State _state = State::DEINIT;               /*!< Current driver state */
     Transformation _transformation = {};        /*!< Coordinate transformation settings */
     Interruption _interruption = {};            /*!< Interrupt handling */
+    Stream _stream = {};                        /*!< Bitmap streaming buffers */
+    Fill _fill = {};                            /*!< Solid fill buffer */
+    std::shared_ptr<SwapChainContext> _swap_chain = nullptr; /*!< Frame buffer swap chain, see `initSwapChain()` */
+    std::shared_ptr<TearSyncContext> _tear_sync = nullptr; /*!< TE pin synchronization, only with the TE pin */
+    IndexedFrameBuffer _indexed_frame_buffer = {}; /*!< Indexed frame buffer expanded in the bounce buffers */
+    RefreshMonitorContext _refresh_monitor = {}; /*!< Refresh underrun detection and recovery */
+#if ESP_PANEL_DRIVERS_LCD_ENABLE_STATS
+    StatsContext _stats = {};                   /*!< Performance counters */
+#endif
+    std::shared_ptr<LCD_DamageTracker> _damage = nullptr; /*!< Damaged rectangles of the shadow buffer */
+    int _damage_transaction_cost = LCD_DamageTracker::TRANSACTION_COST_DEFAULT; /*!< Cost of a window, in pixels */
 };
 
 } // namespace esp_panel::drivers
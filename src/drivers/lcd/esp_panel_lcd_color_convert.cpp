@@ -0,0 +1,290 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <cstring>
+#include "esp_panel_lcd_color_convert.hpp"
+
+namespace esp_panel::drivers {
+
+namespace {
+
+inline uint16_t swapBytes16(uint16_t value)
+{
+    return static_cast<uint16_t>((value << 8) | (value >> 8));
+}
+
+// Swap the bytes of the two pixels packed in a 32-bit word
+inline uint32_t swapBytes16x2(uint32_t value)
+{
+    return ((value & 0x00ff00ff) << 8) | ((value >> 8) & 0x00ff00ff);
+}
+
+using PixelFormat = LCD_ColorConvert::PixelFormat;
+
+// 4x4 Bayer matrix, the values are thresholds in 1/16 of a quantization step
+constexpr uint8_t BAYER_MATRIX[4][4] = {
+    {0, 8, 2, 10},
+    {12, 4, 14, 6},
+    {3, 11, 1, 9},
+    {15, 7, 13, 5},
+};
+
+template <PixelFormat Format>
+inline void readPixel(const uint8_t *src, int &r, int &g, int &b)
+{
+    if constexpr (Format == PixelFormat::RGB565) {
+        uint16_t value = *reinterpret_cast<const uint16_t *>(src);
+        r = ((value >> 8) & 0xf8) | (value >> 13);
+        g = ((value >> 3) & 0xfc) | ((value >> 9) & 0x03);
+        b = ((value << 3) & 0xf8) | ((value >> 2) & 0x07);
+    } else if constexpr (Format == PixelFormat::RGB666) {
+        r = (src[0] & 0xfc) | (src[0] >> 6);
+        g = (src[1] & 0xfc) | (src[1] >> 6);
+        b = (src[2] & 0xfc) | (src[2] >> 6);
+    } else if constexpr (Format == PixelFormat::RGB888) {
+        r = src[0];
+        g = src[1];
+        b = src[2];
+    } else {
+        r = src[2];
+        g = src[1];
+        b = src[0];
+    }
+}
+
+template <PixelFormat Format, bool SwapBytes>
+inline void writePixel(uint8_t *dst, int r, int g, int b)
+{
+    if constexpr (Format == PixelFormat::RGB565) {
+        uint16_t value = static_cast<uint16_t>(((r & 0xf8) << 8) | ((g & 0xfc) << 3) | (b >> 3));
+        *reinterpret_cast<uint16_t *>(dst) = SwapBytes ? swapBytes16(value) : value;
+    } else if constexpr (Format == PixelFormat::RGB666) {
+        dst[0] = r & 0xfc;
+        dst[1] = g & 0xfc;
+        dst[2] = b & 0xfc;
+    } else {
+        dst[0] = r;
+        dst[1] = g;
+        dst[2] = b;
+    }
+}
+
+template <PixelFormat Src, PixelFormat Dst, bool Dither, bool SwapBytes>
+void convertImage(
+    const uint8_t *src, int width, int height, int src_stride, uint8_t *dst, int dst_stride, int x, int y
+)
+{
+    constexpr int src_bytes = (Src == PixelFormat::RGB565) ? 2 : ((Src == PixelFormat::ARGB8888) ? 4 : 3);
+    constexpr int dst_bytes = (Dst == PixelFormat::RGB565) ? 2 : 3;
+    // Shift the thresholds to the quantization step of each component: 8 for 5 bits and 4 for 6 bits
+    constexpr int rb_shift = (Dst == PixelFormat::RGB565) ? 1 : 2;
+    constexpr int g_shift = 2;
+
+    for (int row = 0; row < height; row++) {
+        const uint8_t *from = src + row * src_stride;
+        uint8_t *to = dst + row * dst_stride;
+        const uint8_t *bayer_row = BAYER_MATRIX[(y + row) & 0x3];
+        for (int col = 0; col < width; col++) {
+            int r = 0;
+            int g = 0;
+            int b = 0;
+            readPixel<Src>(from, r, g, b);
+            if constexpr (Dither) {
+                int threshold = bayer_row[(x + col) & 0x3];
+                r = std::min(r + (threshold >> rb_shift), 0xff);
+                g = std::min(g + (threshold >> g_shift), 0xff);
+                b = std::min(b + (threshold >> rb_shift), 0xff);
+            }
+            writePixel<Dst, SwapBytes>(to, r, g, b);
+            from += src_bytes;
+            to += dst_bytes;
+        }
+    }
+}
+
+template <PixelFormat Src, PixelFormat Dst>
+void convertImageByOptions(
+    const uint8_t *src, int width, int height, int src_stride, uint8_t *dst, int dst_stride, int x, int y,
+    const LCD_ColorConvert::Options &options
+)
+{
+    // Only RGB565 has bytes to swap, and RGB888 has nothing to dither
+    if constexpr (Dst == PixelFormat::RGB565) {
+        if (options.dither) {
+            if (options.swap_bytes) {
+                convertImage<Src, Dst, true, true>(src, width, height, src_stride, dst, dst_stride, x, y);
+            } else {
+                convertImage<Src, Dst, true, false>(src, width, height, src_stride, dst, dst_stride, x, y);
+            }
+        } else {
+            if (options.swap_bytes) {
+                convertImage<Src, Dst, false, true>(src, width, height, src_stride, dst, dst_stride, x, y);
+            } else {
+                convertImage<Src, Dst, false, false>(src, width, height, src_stride, dst, dst_stride, x, y);
+            }
+        }
+    } else if constexpr (Dst == PixelFormat::RGB666) {
+        if (options.dither) {
+            convertImage<Src, Dst, true, false>(src, width, height, src_stride, dst, dst_stride, x, y);
+        } else {
+            convertImage<Src, Dst, false, false>(src, width, height, src_stride, dst, dst_stride, x, y);
+        }
+    } else {
+        convertImage<Src, Dst, false, false>(src, width, height, src_stride, dst, dst_stride, x, y);
+    }
+}
+
+template <PixelFormat Src>
+bool convertImageByDst(
+    const uint8_t *src, int width, int height, int src_stride, PixelFormat dst_format, uint8_t *dst, int dst_stride,
+    int x, int y, const LCD_ColorConvert::Options &options
+)
+{
+    switch (dst_format) {
+    case PixelFormat::RGB565:
+        convertImageByOptions<Src, PixelFormat::RGB565>(
+            src, width, height, src_stride, dst, dst_stride, x, y, options
+        );
+        return true;
+    case PixelFormat::RGB666:
+        convertImageByOptions<Src, PixelFormat::RGB666>(
+            src, width, height, src_stride, dst, dst_stride, x, y, options
+        );
+        return true;
+    case PixelFormat::RGB888:
+        convertImageByOptions<Src, PixelFormat::RGB888>(
+            src, width, height, src_stride, dst, dst_stride, x, y, options
+        );
+        return true;
+    default:
+        return false;
+    }
+}
+
+} // namespace
+
+bool LCD_ColorConvert::convert(
+    PixelFormat src_format, const uint8_t *src, int width, int height, int src_stride, PixelFormat dst_format,
+    uint8_t *dst, int dst_stride, int x, int y, const Options &options
+)
+{
+    if ((src == nullptr) || (dst == nullptr) || (width < 0) || (height < 0) || (dst_format == PixelFormat::ARGB8888)) {
+        return false;
+    }
+    if ((width == 0) || (height == 0)) {
+        return true;
+    }
+
+    int src_line_bytes = width * getBytesPerPixel(src_format);
+    int dst_line_bytes = width * getBytesPerPixel(dst_format);
+    src_stride = (src_stride > 0) ? src_stride : src_line_bytes;
+    dst_stride = (dst_stride > 0) ? dst_stride : dst_line_bytes;
+
+    // Same format, only copy (and swap) the lines
+    if (src_format == dst_format) {
+        bool swap_bytes = options.swap_bytes && (src_format == PixelFormat::RGB565);
+        for (int row = 0; row < height; row++) {
+            if (swap_bytes) {
+                copySwapBytesRGB565(
+                    reinterpret_cast<uint16_t *>(dst + row * dst_stride),
+                    reinterpret_cast<const uint16_t *>(src + row * src_stride), width
+                );
+            } else {
+                memcpy(dst + row * dst_stride, src + row * src_stride, dst_line_bytes);
+            }
+        }
+        return true;
+    }
+
+    switch (src_format) {
+    case PixelFormat::RGB565:
+        return convertImageByDst<PixelFormat::RGB565>(
+                   src, width, height, src_stride, dst_format, dst, dst_stride, x, y, options
+               );
+    case PixelFormat::RGB666:
+        return convertImageByDst<PixelFormat::RGB666>(
+                   src, width, height, src_stride, dst_format, dst, dst_stride, x, y, options
+               );
+    case PixelFormat::RGB888:
+        return convertImageByDst<PixelFormat::RGB888>(
+                   src, width, height, src_stride, dst_format, dst, dst_stride, x, y, options
+               );
+    case PixelFormat::ARGB8888:
+        return convertImageByDst<PixelFormat::ARGB8888>(
+                   src, width, height, src_stride, dst_format, dst, dst_stride, x, y, options
+               );
+    default:
+        return false;
+    }
+}
+
+int LCD_ColorConvert::getBytesPerPixel(PixelFormat format)
+{
+    switch (format) {
+    case PixelFormat::RGB565:
+        return 2;
+    case PixelFormat::ARGB8888:
+        return 4;
+    default:
+        return 3;
+    }
+}
+
+bool LCD_ColorConvert::getPixelFormatByBits(int bits_per_pixel, PixelFormat &format)
+{
+    switch (bits_per_pixel) {
+    case 16:
+        format = PixelFormat::RGB565;
+        return true;
+    case 18:
+        format = PixelFormat::RGB666;
+        return true;
+    case 24:
+        format = PixelFormat::RGB888;
+        return true;
+    default:
+        return false;
+    }
+}
+
+void LCD_ColorConvert::copySwapBytesRGB565(uint16_t *dst, const uint16_t *src, size_t count)
+{
+    // Word operations are only possible when both pointers can be aligned to 4 bytes at the same time
+    if (((reinterpret_cast<uintptr_t>(dst) ^ reinterpret_cast<uintptr_t>(src)) & 0x3) == 0) {
+        if ((reinterpret_cast<uintptr_t>(src) & 0x3) && (count > 0)) {
+            *dst++ = swapBytes16(*src++);
+            count--;
+        }
+
+        auto dst_word = reinterpret_cast<uint32_t *>(dst);
+        auto src_word = reinterpret_cast<const uint32_t *>(src);
+        size_t word_count = count / 2;
+        size_t i = 0;
+        for (; i + 4 <= word_count; i += 4) {
+            uint32_t w0 = src_word[i];
+            uint32_t w1 = src_word[i + 1];
+            uint32_t w2 = src_word[i + 2];
+            uint32_t w3 = src_word[i + 3];
+            dst_word[i] = swapBytes16x2(w0);
+            dst_word[i + 1] = swapBytes16x2(w1);
+            dst_word[i + 2] = swapBytes16x2(w2);
+            dst_word[i + 3] = swapBytes16x2(w3);
+        }
+        for (; i < word_count; i++) {
+            dst_word[i] = swapBytes16x2(src_word[i]);
+        }
+        dst += word_count * 2;
+        src += word_count * 2;
+        count -= word_count * 2;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = swapBytes16(src[i]);
+    }
+}
+
+} // namespace esp_panel::drivers
@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esp_panel::drivers {
+
+/**
+ * @brief Pixel kernels used to prepare the color data while copying it to the transmission buffers
+ */
+class LCD_ColorConvert {
+public:
+    /**
+     * @brief Pixel format enumeration
+     *
+     * The formats describe the pixels in memory:
+     *  - `RGB565`: 16-bit little-endian word, R in the upper 5 bits
+     *  - `RGB666`: 3 bytes R, G, B, each component in the upper 6 bits of its byte (the 18-bit panel format)
+     *  - `RGB888`: 3 bytes R, G, B
+     *  - `ARGB8888`: 32-bit little-endian word `0xAARRGGBB` (bytes B, G, R, A, same as LVGL), the alpha is ignored
+     */
+    enum class PixelFormat : uint8_t {
+        RGB565 = 0,
+        RGB666,
+        RGB888,
+        ARGB8888,
+    };
+
+    /**
+     * @brief Conversion options structure
+     */
+    struct Options {
+        bool dither = false;        /*!< Apply a 4x4 ordered (Bayer) dithering when reducing the component depth */
+        bool swap_bytes = false;    /*!< Swap the two bytes of each RGB565 output pixel */
+    };
+
+    /**
+     * @brief Convert an image from a pixel format to another one
+     *
+     * @param[in] src_format Pixel format of the source, supports all the formats
+     * @param[in] src Pointer of the source pixels
+     * @param[in] width Width of the image
+     * @param[in] height Height of the image
+     * @param[in] src_stride Bytes per line of the source, `0` means packed
+     * @param[in] dst_format Pixel format of the destination, supports `RGB565`/`RGB666`/`RGB888`
+     * @param[out] dst Pointer of the destination pixels, should not overlap with the source
+     * @param[in] dst_stride Bytes per line of the destination, `0` means packed
+     * @param[in] x X coordinate of the first pixel, used to align the dithering pattern across calls
+     * @param[in] y Y coordinate of the first pixel, used to align the dithering pattern across calls
+     * @param[in] options Conversion options
+     * @return `true` if successful, `false` if the parameters are invalid
+     * @note For `RGB565` and `ARGB8888`, the buffers and strides should be aligned to the pixel size
+     */
+    static bool convert(
+        PixelFormat src_format, const uint8_t *src, int width, int height, int src_stride, PixelFormat dst_format,
+        uint8_t *dst, int dst_stride, int x, int y, const Options &options
+    );
+
+    /**
+     * @brief Get the number of bytes used to store a pixel
+     *
+     * @param[in] format Pixel format
+     * @return Bytes per pixel
+     */
+    static int getBytesPerPixel(PixelFormat format);
+
+    /**
+     * @brief Get the panel pixel format from the color bits
+     *
+     * @param[in] bits_per_pixel Color bits of the panel, supports 16/18/24
+     * @param[out] format Pixel format
+     * @return `true` if successful, `false` if not supported
+     */
+    static bool getPixelFormatByBits(int bits_per_pixel, PixelFormat &format);
+
+    /**
+     * @brief Copy RGB565 pixels and swap the two bytes of each pixel
+     *
+     * SPI/QSPI panels receive the pixels in big-endian byte order, while the CPU renders them in little-endian. Fusing
+     * the swap into the copy saves a full read and write pass over the bitmap.
+     *
+     * @param[out] dst Pointer of the destination pixels
+     * @param[in] src Pointer of the source pixels, can be the same as `dst`
+     * @param[in] count Number of pixels
+     * @note The pixels are processed by 32-bit words when the source and destination have the same alignment
+     */
+    static void copySwapBytesRGB565(uint16_t *dst, const uint16_t *src, size_t count);
+};
+
+} // namespace esp_panel::drivers
@@ -250,6 +250,17 @@
     #endif
 #endif
 
+/*
+ * Optional features, disabled if not defined by the configuration file or sdkconfig
+ */
+#ifndef ESP_PANEL_DRIVERS_LCD_ENABLE_STATS
+    #ifdef CONFIG_ESP_PANEL_DRIVERS_LCD_ENABLE_STATS
+        #define ESP_PANEL_DRIVERS_LCD_ENABLE_STATS CONFIG_ESP_PANEL_DRIVERS_LCD_ENABLE_STATS
+    #else
+        #define ESP_PANEL_DRIVERS_LCD_ENABLE_STATS (0)
+    #endif
+#endif
+
 /*
  * Enable the driver if it is used or if the compile unused drivers is enabled
  */
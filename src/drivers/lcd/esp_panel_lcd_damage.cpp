@@ -0,0 +1,194 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include "esp_panel_lcd_damage.hpp"
+
+namespace esp_panel::drivers {
+
+namespace {
+
+int64_t getArea(const LCD_DamageTracker::Rect &rect)
+{
+    return static_cast<int64_t>(rect.width) * rect.height;
+}
+
+LCD_DamageTracker::Rect getBoundingBox(const LCD_DamageTracker::Rect &a, const LCD_DamageTracker::Rect &b)
+{
+    int x_start = std::min(a.x, b.x);
+    int y_start = std::min(a.y, b.y);
+    int x_end = std::max(a.x + a.width, b.x + b.width);
+    int y_end = std::max(a.y + a.height, b.y + b.height);
+
+    return {
+        .x = x_start,
+        .y = y_start,
+        .width = x_end - x_start,
+        .height = y_end - y_start,
+    };
+}
+
+} // namespace
+
+void LCD_DamageTracker::configure(const Config &config)
+{
+    if (config != _config) {
+        _config = config;
+        _config.x_align = std::max(_config.x_align, 1);
+        _config.y_align = std::max(_config.y_align, 1);
+        _config.transaction_cost = std::max(_config.transaction_cost, 0);
+        clear();
+    }
+}
+
+void LCD_DamageTracker::add(const Rect &rect)
+{
+    // Snap into the spare slot directly, it is only kept if not empty
+    Rect &snapped = _rects[_rect_num];
+    snapped = snap(_config, rect);
+    if ((snapped.width <= 0) || (snapped.height <= 0)) {
+        return;
+    }
+
+    _rect_num++;
+    mergeFrom(_rect_num - 1);
+
+    // Out of storage, merge the cheapest pair. The result may now be worth merging with others
+    while (_rect_num > RECTS_MAX_NUM) {
+        int best_i = 0;
+        int best_j = 1;
+        int64_t best_gain = INT64_MAX;
+        for (int i = 0; i < _rect_num; i++) {
+            for (int j = i + 1; j < _rect_num; j++) {
+                int64_t gain = getMergeGain(_rects[i], _rects[j]);
+                if (gain < best_gain) {
+                    best_gain = gain;
+                    best_i = i;
+                    best_j = j;
+                }
+            }
+        }
+        _rects[best_i] = getBoundingBox(_rects[best_i], _rects[best_j]);
+        remove(best_j);
+        mergeFrom(best_i);
+    }
+}
+
+LCD_DamageTracker::Rect LCD_DamageTracker::snap(const Config &config, const Rect &rect)
+{
+    int x_align = std::max(config.x_align, 1);
+    int y_align = std::max(config.y_align, 1);
+    int x_start = std::max(rect.x, 0);
+    int y_start = std::max(rect.y, 0);
+    int x_end = std::min(rect.x + rect.width, config.width);
+    int y_end = std::min(rect.y + rect.height, config.height);
+    if ((x_start >= x_end) || (y_start >= y_end)) {
+        return {};
+    }
+
+    // Expand to the alignment, the end is clipped since the panel size is not always aligned
+    x_start = x_start / x_align * x_align;
+    y_start = y_start / y_align * y_align;
+    x_end = std::min((x_end + x_align - 1) / x_align * x_align, config.width);
+    y_end = std::min((y_end + y_align - 1) / y_align * y_align, config.height);
+
+    return {
+        .x = x_start,
+        .y = y_start,
+        .width = x_end - x_start,
+        .height = y_end - y_start,
+    };
+}
+
+int64_t LCD_DamageTracker::getMergeGain(const Rect &a, const Rect &b) const
+{
+    // Cost of one merged window minus the cost of two separate windows, merging is worth it when not positive
+    return getArea(getBoundingBox(a, b)) - getArea(a) - getArea(b) - _config.transaction_cost;
+}
+
+void LCD_DamageTracker::remove(int index)
+{
+    for (int i = index; i < _rect_num - 1; i++) {
+        _rects[i] = _rects[i + 1];
+    }
+    _rect_num--;
+}
+
+void LCD_DamageTracker::mergeFrom(int index)
+{
+    // Keep merging the rectangle at `index` with the most profitable one until no merge reduces the cost
+    while (true) {
+        int best = -1;
+        int64_t best_gain = 1;
+        for (int i = 0; i < _rect_num; i++) {
+            if (i == index) {
+                continue;
+            }
+            int64_t gain = getMergeGain(_rects[index], _rects[i]);
+            if (gain < best_gain) {
+                best_gain = gain;
+                best = i;
+            }
+        }
+        if (best < 0) {
+            return;
+        }
+
+        _rects[index] = getBoundingBox(_rects[index], _rects[best]);
+        remove(best);
+        if (best < index) {
+            index--;
+        }
+    }
+}
+
+void LCD_DamageHistory::configure(const LCD_DamageTracker::Config &config)
+{
+    _config = config;
+    for (auto &frame : _frames) {
+        frame.configure(config);
+        frame.clear();
+    }
+    clear();
+}
+
+void LCD_DamageHistory::addFrame(const Rect *rects, int rect_num)
+{
+    auto &frame = _frames[_next_index];
+    frame.configure(_config);
+    frame.clear();
+    if (rects == nullptr) {
+        frame.add({0, 0, _config.width, _config.height});
+    } else {
+        for (int i = 0; i < rect_num; i++) {
+            frame.add(rects[i]);
+        }
+    }
+
+    _next_index = (_next_index + 1) % FRAMES_MAX_NUM;
+    _frame_num = std::min(_frame_num + 1, FRAMES_MAX_NUM);
+}
+
+bool LCD_DamageHistory::getDamageSince(int age, LCD_DamageTracker &damage) const
+{
+    damage.configure(_config);
+    damage.clear();
+    if ((age <= 0) || (age - 1 > _frame_num)) {
+        return false;
+    }
+
+    // The buffer misses the frames presented after it, which are the latest `age - 1` ones
+    for (int i = 1; i < age; i++) {
+        auto &frame = _frames[(_next_index - i + FRAMES_MAX_NUM) % FRAMES_MAX_NUM];
+        for (int j = 0; j < frame.getRectNum(); j++) {
+            damage.add(frame.getRects()[j]);
+        }
+    }
+
+    return true;
+}
+
+} // namespace esp_panel::drivers
@@ -0,0 +1,180 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "esp_panel_lcd_transform.hpp"
+
+namespace esp_panel::drivers {
+
+/**
+ * @brief Damage (dirty) rectangle tracker with alignment-aware merging
+ *
+ * The tracker snaps the invalidated rectangles to the coordinate alignment of the panel and merges them with a simple
+ * cost model: each window costs `transaction_cost` pixels of bus time (CASET/RASET/RAMWR and DMA setup) plus its area.
+ * Two windows are merged when their bounding box is cheaper than sending them separately. It uses a fixed-size
+ * storage and never allocates memory.
+ */
+class LCD_DamageTracker {
+public:
+    using Rect = LCD_Transform::Rect;
+
+    static constexpr int RECTS_MAX_NUM = 16;                    /*!< Maximum number of tracked rectangles */
+    static constexpr int TRANSACTION_COST_DEFAULT = 256;        /*!< Default cost of a window, in pixels */
+
+    /**
+     * @brief Configuration structure
+     */
+    struct Config {
+        bool operator==(const Config &other) const
+        {
+            return (width == other.width) && (height == other.height) && (x_align == other.x_align) &&
+                   (y_align == other.y_align) && (transaction_cost == other.transaction_cost);
+        }
+
+        bool operator!=(const Config &other) const
+        {
+            return !(*this == other);
+        }
+
+        int width = 0;                                      /*!< Width of the coordinate space */
+        int height = 0;                                     /*!< Height of the coordinate space */
+        int x_align = 1;                                    /*!< Alignment of the X coordinates */
+        int y_align = 1;                                    /*!< Alignment of the Y coordinates */
+        int transaction_cost = TRANSACTION_COST_DEFAULT;    /*!< Cost of sending one window, in pixels */
+    };
+
+    /**
+     * @brief Apply a new configuration, the tracked rectangles are cleared if it changes
+     *
+     * @param[in] config Configuration
+     */
+    void configure(const Config &config);
+
+    /**
+     * @brief Add a damaged rectangle
+     *
+     * @param[in] rect Rectangle, it will be snapped to the alignment and clipped to the coordinate space
+     * @note When the storage is full, the two rectangles which are the cheapest to merge are merged
+     */
+    void add(const Rect &rect);
+
+    /**
+     * @brief Clear all the tracked rectangles
+     */
+    void clear()
+    {
+        _rect_num = 0;
+    }
+
+    /**
+     * @brief Get the tracked rectangles
+     *
+     * @return Pointer of the rectangles array, the size is `getRectNum()`
+     */
+    const Rect *getRects() const
+    {
+        return _rects;
+    }
+
+    /**
+     * @brief Get the number of tracked rectangles
+     */
+    int getRectNum() const
+    {
+        return _rect_num;
+    }
+
+    /**
+     * @brief Get the current configuration
+     */
+    const Config &getConfig() const
+    {
+        return _config;
+    }
+
+    /**
+     * @brief Snap a rectangle to the alignment and clip it to the coordinate space
+     *
+     * @param[in] config Configuration
+     * @param[in] rect Rectangle
+     * @return Snapped rectangle, its size is zero if it is outside the coordinate space
+     */
+    static Rect snap(const Config &config, const Rect &rect);
+
+private:
+    int64_t getMergeGain(const Rect &a, const Rect &b) const;
+    void remove(int index);
+    void mergeFrom(int index);
+
+    Config _config = {};
+    Rect _rects[RECTS_MAX_NUM + 1] = {};
+    int _rect_num = 0;
+};
+
+/**
+ * @brief Damage history of the presented frames, used to repair the reused buffers of a swap chain
+ *
+ * A buffer of age `N` holds the frame presented `N` presents ago, so it misses the damage of the last `N - 1` frames.
+ * Only these regions need to be copied from the latest frame before rendering into it, instead of the whole frame.
+ */
+class LCD_DamageHistory {
+public:
+    using Rect = LCD_DamageTracker::Rect;
+
+    static constexpr int FRAMES_MAX_NUM = 4;    /*!< Maximum number of recorded frames */
+
+    /**
+     * @brief Apply a new configuration, the history is cleared
+     *
+     * @param[in] config Configuration of the damage trackers, see `LCD_DamageTracker::Config`
+     */
+    void configure(const LCD_DamageTracker::Config &config);
+
+    /**
+     * @brief Forget all the recorded frames, all the buffers will need a full repair
+     */
+    void clear()
+    {
+        _frame_num = 0;
+    }
+
+    /**
+     * @brief Record the damage of a presented frame
+     *
+     * @param[in] rects Damaged rectangles of the frame, `nullptr` means the whole frame
+     * @param[in] rect_num Number of the rectangles
+     */
+    void addFrame(const Rect *rects, int rect_num);
+
+    /**
+     * @brief Get the damage accumulated since a buffer of the given age was presented
+     *
+     * @param[in] age Age of the buffer, see `LCD_SwapChain::getAge()`
+     * @param[out] damage Damage tracker to store the union of the damage, it is reconfigured and cleared first
+     * @return `true` if successful, `false` if the history is not long enough (or the age is `0`), the whole frame
+     *         should be repaired then
+     */
+    bool getDamageSince(int age, LCD_DamageTracker &damage) const;
+
+    /**
+     * @brief Get the number of recorded frames
+     */
+    int getFrameNum() const
+    {
+        return _frame_num;
+    }
+
+private:
+    LCD_DamageTracker::Config _config = {};
+    LCD_DamageTracker _frames[FRAMES_MAX_NUM] = {};
+    int _frame_num = 0;
+    int _next_index = 0;
+};
+
+} // namespace esp_panel::drivers
@@ -27,6 +27,18 @@ const LCD::BasicBusSpecificationMap LCD_GC9A01::_bus_specifications = {
                          (1U << BasicBusSpecification::FUNC_DISPLAY_ON_OFF),
         },
     },
+    {
+        ESP_PANEL_BUS_TYPE_I80, BasicBusSpecification{
+            .color_bits = (1U << BasicBusSpecification::COLOR_BITS_RGB565_16) |
+                          (1U << BasicBusSpecification::COLOR_BITS_RGB666_18),
+            .functions = (1U << BasicBusSpecification::FUNC_INVERT_COLOR) |
+                         (1U << BasicBusSpecification::FUNC_MIRROR_X) |
+                         (1U << BasicBusSpecification::FUNC_MIRROR_Y) |
+                         (1U << BasicBusSpecification::FUNC_SWAP_XY) |
+                         (1U << BasicBusSpecification::FUNC_GAP) |
+                         (1U << BasicBusSpecification::FUNC_DISPLAY_ON_OFF),
+        },
+    },
 };
 // *INDENT-ON*
 
@@ -0,0 +1,116 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <cstring>
+#include "esp_panel_lcd_palette.hpp"
+
+namespace esp_panel::drivers {
+
+using PixelFormat = LCD_ColorConvert::PixelFormat;
+
+bool LCD_Palette::configure(IndexFormat index_format, PixelFormat pixel_format)
+{
+    if ((index_format > IndexFormat::I8) ||
+            ((pixel_format != PixelFormat::RGB565) && (pixel_format != PixelFormat::RGB888))) {
+        return false;
+    }
+
+    _index_format = index_format;
+    _pixel_format = pixel_format;
+    memset(_pixels, 0, sizeof(_pixels));
+    memset(_pairs, 0, sizeof(_pairs));
+
+    return true;
+}
+
+bool LCD_Palette::setColors(int start, const uint32_t *colors, int num)
+{
+    if ((colors == nullptr) || (start < 0) || (num < 0) || (start + num > getColorNum())) {
+        return false;
+    }
+
+    for (int i = 0; i < num; i++) {
+        uint32_t r = (colors[i] >> 16) & 0xff;
+        uint32_t g = (colors[i] >> 8) & 0xff;
+        uint32_t b = colors[i] & 0xff;
+        if (_pixel_format == PixelFormat::RGB565) {
+            _pixels[start + i] = ((r & 0xf8) << 8) | ((g & 0xfc) << 3) | (b >> 3);
+        } else {
+            _pixels[start + i] = r | (g << 8) | (b << 16);
+        }
+    }
+
+    // Rebuild the pairs of the changed colors, each byte holds the high nibble (first pixel) and the low one
+    if ((_pixel_format == PixelFormat::RGB565) && (_index_format == IndexFormat::I4)) {
+        for (int value = 0; value < COLOR_NUM_MAX; value++) {
+            int first = value >> 4;
+            int second = value & 0x0f;
+            if (((first >= start) && (first < start + num)) || ((second >= start) && (second < start + num))) {
+                _pairs[value] = _pixels[first] | (_pixels[second] << 16);
+            }
+        }
+    }
+
+    return true;
+}
+
+size_t LCD_Palette::getFrameBufferSize(IndexFormat format, int width, int height)
+{
+    if ((width <= 0) || (height <= 0)) {
+        return 0;
+    }
+
+    return (static_cast<size_t>(width) * height * getBitsPerIndex(format) + 7) / 8;
+}
+
+bool LCD_Palette::copyIndices(
+    IndexFormat format, const uint8_t *src, int width, int height, int src_stride, uint8_t *frame, int frame_width,
+    int x, int y
+)
+{
+    if ((src == nullptr) || (frame == nullptr) || (format > IndexFormat::I8) || (width < 0) || (height < 0) ||
+            (x < 0) || (y < 0) || (x + width > frame_width)) {
+        return false;
+    }
+
+    int bits = getBitsPerIndex(format);
+    size_t row_bytes = (static_cast<size_t>(width) * bits + 7) / 8;
+    if (src_stride == 0) {
+        src_stride = row_bytes;
+    } else if (static_cast<size_t>(src_stride) < row_bytes) {
+        return false;
+    }
+
+    size_t frame_row_bits = static_cast<size_t>(frame_width) * bits;
+    size_t bit_pos = (static_cast<size_t>(y) * frame_width + x) * bits;
+    // Every row starts at a byte boundary and covers whole bytes, copy it directly
+    if (((frame_row_bits & 0x7) == 0) && ((bit_pos & 0x7) == 0) && (((static_cast<size_t>(width) * bits) & 0x7) == 0)) {
+        for (int row = 0; row < height; row++) {
+            memcpy(frame + bit_pos / 8, src, row_bytes);
+            src += src_stride;
+            bit_pos += frame_row_bits;
+        }
+        return true;
+    }
+
+    uint32_t mask = (1U << bits) - 1;
+    for (int row = 0; row < height; row++) {
+        size_t dst_bit = bit_pos;
+        for (int col = 0; col < width; col++, dst_bit += bits) {
+            size_t src_bit = static_cast<size_t>(col) * bits;
+            uint32_t index = (src[src_bit >> 3] >> (8 - bits - (src_bit & 0x7))) & mask;
+            int shift = 8 - bits - (dst_bit & 0x7);
+            uint8_t &byte = frame[dst_bit >> 3];
+            byte = static_cast<uint8_t>((byte & ~(mask << shift)) | (index << shift));
+        }
+        src += src_stride;
+        bit_pos += frame_row_bits;
+    }
+
+    return true;
+}
+
+} // namespace esp_panel::drivers
@@ -0,0 +1,215 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "esp_panel_lcd_color_convert.hpp"
+
+namespace esp_panel::drivers {
+
+/**
+ * @brief Color lookup table of an indexed frame buffer
+ *
+ * The indexed frame buffer stores a palette index for each pixel instead of the color, which cuts the size and the
+ * bandwidth of the frame buffer by 2-6x. It is expanded to the panel pixel format by `expand()` while the bounce
+ * buffers of the RGB panel are filled.
+ *
+ * The frame buffer is a contiguous bit stream without any row padding: the index of pixel `N` (`N = y * width + x`)
+ * starts at bit `N * bits_per_index`, and the first pixel takes the most significant bits of a byte (same as LVGL).
+ */
+class LCD_Palette {
+public:
+    /**
+     * @brief Index format enumeration
+     */
+    enum class IndexFormat : uint8_t {
+        I1 = 0,     /*!< 1-bit index, 2 colors */
+        I2,         /*!< 2-bit index, 4 colors */
+        I4,         /*!< 4-bit index, 16 colors */
+        I8,         /*!< 8-bit index, 256 colors */
+    };
+
+    static constexpr int COLOR_NUM_MAX = 256;
+
+    /**
+     * @brief Configure the formats, all the colors are reset to black
+     *
+     * @param[in] index_format Index format of the frame buffer
+     * @param[in] pixel_format Pixel format to expand to, supports `RGB565`/`RGB888`
+     * @return `true` if successful, `false` if the formats are not supported
+     */
+    bool configure(IndexFormat index_format, LCD_ColorConvert::PixelFormat pixel_format);
+
+    /**
+     * @brief Set the colors of a range of indexes
+     *
+     * @param[in] start First index to set
+     * @param[in] colors Colors in `0xRRGGBB` format
+     * @param[in] num Number of colors
+     * @return `true` if successful, `false` if the range exceeds `getColorNum()`
+     * @note The colors are stored in the expanded pixel format, so they can be changed while the panel is refreshing
+     */
+    bool setColors(int start, const uint32_t *colors, int num);
+
+    /**
+     * @brief Get the stored pixel value of an index
+     *
+     * @param[in] index Palette index
+     * @return Pixel value, RGB565 is the 16-bit word and RGB888 holds the bytes R, G, B from the lowest byte
+     */
+    uint32_t getPixel(int index) const
+    {
+        return _pixels[index & (COLOR_NUM_MAX - 1)];
+    }
+
+    /**
+     * @brief Get the index format
+     *
+     * @return Index format
+     */
+    IndexFormat getIndexFormat() const
+    {
+        return _index_format;
+    }
+
+    /**
+     * @brief Get the pixel format to expand to
+     *
+     * @return Pixel format
+     */
+    LCD_ColorConvert::PixelFormat getPixelFormat() const
+    {
+        return _pixel_format;
+    }
+
+    /**
+     * @brief Get the number of colors of the index format
+     *
+     * @return Number of colors
+     */
+    int getColorNum() const
+    {
+        return 1 << getBitsPerIndex(_index_format);
+    }
+
+    /**
+     * @brief Expand a run of pixels of the indexed frame buffer to the pixel format
+     *
+     * @param[in] frame Pointer of the indexed frame buffer
+     * @param[in] pixel_offset Index of the first pixel in the frame buffer, can start in the middle of a byte
+     * @param[in] pixel_num Number of pixels to expand
+     * @param[out] dst Pointer of the expanded pixels, should be aligned to the pixel size for `RGB565`
+     */
+    __attribute__((always_inline)) inline void expand(
+        const uint8_t *frame, size_t pixel_offset, size_t pixel_num, uint8_t *dst
+    ) const
+    {
+        if (_pixel_format == LCD_ColorConvert::PixelFormat::RGB565) {
+            uint16_t *out = reinterpret_cast<uint16_t *>(dst);
+            if (_index_format == IndexFormat::I8) {
+                const uint8_t *src = frame + pixel_offset;
+                for (size_t i = 0; i < pixel_num; i++) {
+                    out[i] = static_cast<uint16_t>(_pixels[src[i]]);
+                }
+                return;
+            }
+            if (_index_format == IndexFormat::I4) {
+                const uint8_t *src = frame + pixel_offset / 2;
+                // Start in the middle of a byte, take its low nibble
+                if ((pixel_offset & 1) && (pixel_num > 0)) {
+                    *out++ = static_cast<uint16_t>(_pixels[*src++ & 0x0f]);
+                    pixel_num--;
+                }
+                // Two pixels per byte, looked up at once
+                size_t pair_num = pixel_num / 2;
+                if ((reinterpret_cast<uintptr_t>(out) & 0x3) == 0) {
+                    uint32_t *out32 = reinterpret_cast<uint32_t *>(out);
+                    for (size_t i = 0; i < pair_num; i++) {
+                        out32[i] = _pairs[src[i]];
+                    }
+                } else {
+                    for (size_t i = 0; i < pair_num; i++) {
+                        out[2 * i] = static_cast<uint16_t>(_pixels[src[i] >> 4]);
+                        out[2 * i + 1] = static_cast<uint16_t>(_pixels[src[i] & 0x0f]);
+                    }
+                }
+                if (pixel_num & 1) {
+                    out[2 * pair_num] = static_cast<uint16_t>(_pixels[src[pair_num] >> 4]);
+                }
+                return;
+            }
+        }
+
+        int bits = getBitsPerIndex(_index_format);
+        uint32_t mask = (1U << bits) - 1;
+        size_t bit_pos = pixel_offset * bits;
+        if (_pixel_format == LCD_ColorConvert::PixelFormat::RGB565) {
+            uint16_t *out = reinterpret_cast<uint16_t *>(dst);
+            for (size_t i = 0; i < pixel_num; i++, bit_pos += bits) {
+                out[i] = static_cast<uint16_t>(_pixels[(frame[bit_pos >> 3] >> (8 - bits - (bit_pos & 0x7))) & mask]);
+            }
+        } else {
+            for (size_t i = 0; i < pixel_num; i++, bit_pos += bits, dst += 3) {
+                uint32_t pixel = _pixels[(frame[bit_pos >> 3] >> (8 - bits - (bit_pos & 0x7))) & mask];
+                dst[0] = pixel;
+                dst[1] = pixel >> 8;
+                dst[2] = pixel >> 16;
+            }
+        }
+    }
+
+    /**
+     * @brief Get the number of bits of an index
+     *
+     * @param[in] format Index format
+     * @return Bits per index
+     */
+    static constexpr int getBitsPerIndex(IndexFormat format)
+    {
+        return 1 << static_cast<int>(format);
+    }
+
+    /**
+     * @brief Get the size of an indexed frame buffer
+     *
+     * @param[in] format Index format
+     * @param[in] width Width of the frame
+     * @param[in] height Height of the frame
+     * @return Size in bytes
+     */
+    static size_t getFrameBufferSize(IndexFormat format, int width, int height);
+
+    /**
+     * @brief Copy an indexed bitmap into a rectangle of the indexed frame buffer
+     *
+     * @param[in] format Index format of both the bitmap and the frame buffer
+     * @param[in] src Pointer of the bitmap, each row starts at a byte boundary (the first pixel in the most
+     *                significant bits)
+     * @param[in] width Width of the bitmap
+     * @param[in] height Height of the bitmap
+     * @param[in] src_stride Bytes per row of the bitmap, `0` means `ceil(width * bits_per_index / 8)`
+     * @param[out] frame Pointer of the indexed frame buffer
+     * @param[in] frame_width Width of the frame
+     * @param[in] x X coordinate of the rectangle in the frame
+     * @param[in] y Y coordinate of the rectangle in the frame
+     * @return `true` if successful, `false` if the parameters are invalid
+     * @note The rows are copied by `memcpy()` when they are byte aligned in both buffers, otherwise index by index
+     */
+    static bool copyIndices(
+        IndexFormat format, const uint8_t *src, int width, int height, int src_stride, uint8_t *frame,
+        int frame_width, int x, int y
+    );
+
+private:
+    IndexFormat _index_format = IndexFormat::I8;
+    LCD_ColorConvert::PixelFormat _pixel_format = LCD_ColorConvert::PixelFormat::RGB565;
+    uint32_t _pixels[COLOR_NUM_MAX] = {};   // Expanded pixel of each index
+    uint32_t _pairs[COLOR_NUM_MAX] = {};    // Two RGB565 pixels of each I4 byte, the first one in the lower half
+};
+
+} // namespace esp_panel::drivers
@@ -0,0 +1,37 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "esp_panel_lcd_refresh_monitor.hpp"
+
+namespace esp_panel::drivers {
+
+void LCD_RefreshMonitor::configure(uint32_t frame_period_us, uint32_t bounce_period_us, int tolerance_percent)
+{
+    *this = LCD_RefreshMonitor();
+    if (tolerance_percent < 0) {
+        tolerance_percent = 0;
+    }
+    _frame_limit_us = static_cast<int64_t>(frame_period_us) * (100 + tolerance_percent) / 100;
+    _bounce_limit_us = static_cast<int64_t>(bounce_period_us) * (100 + tolerance_percent) / 100;
+}
+
+bool LCD_RefreshMonitor::takeRestartRequest()
+{
+    if (!_is_restart_pending) {
+        return false;
+    }
+
+    _is_restart_pending = false;
+    _restart_count++;
+    // The restart shifts the next frame, don't take it as late
+    _frame_time_us = 0;
+    _fill_time_us = 0;
+    _is_frame_late = false;
+
+    return true;
+}
+
+} // namespace esp_panel::drivers
@@ -0,0 +1,161 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace esp_panel::drivers {
+
+/**
+ * @brief Underrun detection of the panels refreshed continuously from a frame buffer (RGB)
+ *
+ * When the PSRAM can't keep up, a bounce buffer is refilled after the DMA has already sent it, and the panel shows the
+ * stale pixels shifted until the transmission is restarted (the screen "drift"). This class watches the timestamps of
+ * the bounce buffer fills: a fill later than the transmission time of a bounce buffer means an underrun. Each frame
+ * with an underrun is counted once and requests a restart, which is taken by the caller from the task context.
+ *
+ * The frame interrupts are paced by the pixel clock even during an underrun, so a late one only means a long interrupt
+ * latency (e.g. the cache disabled by a flash operation). It is counted, but never requests a restart.
+ *
+ * This class doesn't lock, the caller should protect it against the refresh interrupts.
+ */
+class LCD_RefreshMonitor {
+public:
+    static constexpr int TOLERANCE_PERCENT_DEFAULT = 25;    /*!< Default lateness tolerance of the intervals */
+
+    /**
+     * @brief Reset the counters, configure the nominal timing
+     *
+     * @param[in] frame_period_us Period of a frame in microseconds, including the blanking
+     * @param[in] bounce_period_us Transmission time of a bounce buffer in microseconds, `0` if not monitored (no
+     *                             underrun is detected then)
+     * @param[in] tolerance_percent Intervals longer than the nominal ones by more than this percentage are late
+     */
+    void configure(uint32_t frame_period_us, uint32_t bounce_period_us, int tolerance_percent);
+
+    /**
+     * @brief Record the end of a frame, it should be called from the refresh finish interrupt
+     *
+     * The frame with a late bounce buffer fill requests a restart. The interval right after a restart is not
+     * checked, since the restart shifts the frame.
+     *
+     * @param[in] time_us Timestamp in microseconds
+     */
+    __attribute__((always_inline)) inline void onFrameFinish(int64_t time_us)
+    {
+        if ((_frame_time_us != 0) && (time_us - _frame_time_us > _frame_limit_us)) {
+            _delayed_frame_count++;
+        }
+        _frame_time_us = time_us;
+        _fill_time_us = 0;
+        _frame_count++;
+        if (_is_frame_late) {
+            _is_frame_late = false;
+            _late_frame_count++;
+            _is_restart_pending = true;
+        }
+    }
+
+    /**
+     * @brief Record the fill of a bounce buffer, it should be called from the bounce buffer interrupt
+     *
+     * The first fill of a frame follows the vertical blanking, so only the intervals between the fills of the same
+     * frame are checked.
+     *
+     * @param[in] time_us Timestamp in microseconds
+     */
+    __attribute__((always_inline)) inline void onBounceFill(int64_t time_us)
+    {
+        if ((_bounce_limit_us > 0) && (_fill_time_us != 0) && (time_us - _fill_time_us > _bounce_limit_us)) {
+            _late_fill_count++;
+            _is_frame_late = true;
+        }
+        _fill_time_us = time_us;
+    }
+
+    /**
+     * @brief Take the pending restart request
+     *
+     * @return `true` if a restart is requested, the request is cleared and counted as a restart. `false` otherwise
+     */
+    bool takeRestartRequest();
+
+    /**
+     * @brief Check if a restart is requested
+     *
+     * @return `true` if requested, `false` otherwise
+     */
+    bool isRestartPending() const
+    {
+        return _is_restart_pending;
+    }
+
+    /**
+     * @brief Get the number of the finished frames
+     *
+     * @return Number of frames
+     */
+    uint32_t getFrameCount() const
+    {
+        return _frame_count;
+    }
+
+    /**
+     * @brief Get the number of the frames with an underrun
+     *
+     * @return Number of frames
+     */
+    uint32_t getLateFrameCount() const
+    {
+        return _late_frame_count;
+    }
+
+    /**
+     * @brief Get the number of the frames finished later than their period, which is not an underrun
+     *
+     * @return Number of frames
+     */
+    uint32_t getDelayedFrameCount() const
+    {
+        return _delayed_frame_count;
+    }
+
+    /**
+     * @brief Get the number of the late bounce buffer fills
+     *
+     * @return Number of fills
+     */
+    uint32_t getLateFillCount() const
+    {
+        return _late_fill_count;
+    }
+
+    /**
+     * @brief Get the number of the restarts taken by `takeRestartRequest()`
+     *
+     * @return Number of restarts
+     */
+    uint32_t getRestartCount() const
+    {
+        return _restart_count;
+    }
+
+private:
+    int64_t _frame_limit_us = 0;
+    int64_t _bounce_limit_us = 0;
+    int64_t _frame_time_us = 0;
+    int64_t _fill_time_us = 0;
+    bool _is_frame_late = false;
+    bool _is_restart_pending = false;
+    uint32_t _frame_count = 0;
+    uint32_t _late_frame_count = 0;
+    uint32_t _delayed_frame_count = 0;
+    uint32_t _late_fill_count = 0;
+    uint32_t _restart_count = 0;
+};
+
+} // namespace esp_panel::drivers
@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <cstdio>
+#include "esp_panel_lcd_stats.hpp"
+
+namespace esp_panel::drivers {
+
+void LCD_Stats::reset()
+{
+    *this = LCD_Stats();
+}
+
+uint32_t LCD_Stats::getLatencyPercentileUs(int percent) const
+{
+    if (_latency_count == 0) {
+        return 0;
+    }
+    if (percent < 0) {
+        percent = 0;
+    } else if (percent > 100) {
+        percent = 100;
+    }
+
+    // Rank of the percentile, counted from 1
+    uint64_t rank = (static_cast<uint64_t>(_latency_count) * percent + 99) / 100;
+    if (rank == 0) {
+        rank = 1;
+    }
+    uint64_t count = 0;
+    for (int i = 0; i < LATENCY_BUCKET_NUM - 1; i++) {
+        count += _latency_buckets[i];
+        if (count >= rank) {
+            uint32_t upper_us = getLatencyBucketLowerUs(i + 1);
+            return (upper_us < _latency_max_us) ? upper_us : _latency_max_us;
+        }
+    }
+
+    return _latency_max_us;
+}
+
+std::string LCD_Stats::toString() const
+{
+    std::string text;
+    char line[128];
+
+    snprintf(
+        line, sizeof(line), "Draw bitmap: %u transfers, %llu bytes\n", static_cast<unsigned>(_draw_bitmap_count),
+        static_cast<unsigned long long>(_draw_bitmap_bytes)
+    );
+    text += line;
+    snprintf(
+        line, sizeof(line), "Latency: %u samples, min %u us, avg %u us, max %u us, p50 < %u us, p99 < %u us\n",
+        static_cast<unsigned>(_latency_count), static_cast<unsigned>(_latency_min_us),
+        static_cast<unsigned>(getLatencyAverageUs()), static_cast<unsigned>(_latency_max_us),
+        static_cast<unsigned>(getLatencyPercentileUs(50)), static_cast<unsigned>(getLatencyPercentileUs(99))
+    );
+    text += line;
+    for (int i = 0; i < LATENCY_BUCKET_NUM; i++) {
+        if (_latency_buckets[i] == 0) {
+            continue;
+        }
+        if (i < LATENCY_BUCKET_NUM - 1) {
+            snprintf(
+                line, sizeof(line), "  [%u, %u) us: %u\n", static_cast<unsigned>(getLatencyBucketLowerUs(i)),
+                static_cast<unsigned>(getLatencyBucketLowerUs(i + 1)), static_cast<unsigned>(_latency_buckets[i])
+            );
+        } else {
+            snprintf(
+                line, sizeof(line), "  [%u, -) us: %u\n", static_cast<unsigned>(getLatencyBucketLowerUs(i)),
+                static_cast<unsigned>(_latency_buckets[i])
+            );
+        }
+        text += line;
+    }
+    // Avoid the float formatting, which might not be supported by the C library
+    int rate_centi_hz = (_refresh_period_us > 0) ? static_cast<int>(100000000LL / _refresh_period_us) : 0;
+    snprintf(
+        line, sizeof(line), "Refresh: %u frames, %d.%02d Hz\n", static_cast<unsigned>(_refresh_count),
+        rate_centi_hz / 100, rate_centi_hz % 100
+    );
+    text += line;
+    snprintf(
+        line, sizeof(line), "Wait: %u times, total %lld us, max %lld us\n", static_cast<unsigned>(_wait_count),
+        static_cast<long long>(_wait_time_us), static_cast<long long>(_wait_max_us)
+    );
+    text += line;
+
+    return text;
+}
+
+} // namespace esp_panel::drivers
@@ -0,0 +1,305 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace esp_panel::drivers {
+
+/**
+ * @brief Performance counters of the display pipeline
+ *
+ * It counts the bitmap transfers, measures their latency from the submission to the finish interrupt into a
+ * histogram of power-of-two buckets, measures the refresh rate from the refresh finish interrupt, and accumulates the
+ * time blocked waiting for the transfers.
+ *
+ * This class doesn't lock, the caller should protect it against the interrupts.
+ */
+class LCD_Stats {
+public:
+    static constexpr int LATENCY_BUCKET_NUM = 20;   /*!< Number of the latency buckets, the last one is unbounded */
+    static constexpr int PENDING_DRAW_NUM = 16;     /*!< Number of the transfers in flight whose latency is measured */
+    static constexpr int REFRESH_PERIOD_SHIFT = 3;  /*!< Weight of a new refresh interval, `1 / (1 << shift)` */
+
+    /**
+     * @brief Reset all counters
+     */
+    void reset();
+
+    /**
+     * @brief Record the submission time of a transfer, it should be called right before the transfer is started
+     *
+     * @param[in] token Token of the transfer
+     * @param[in] time_us Timestamp in microseconds
+     */
+    void onDrawBitmapSubmit(uint32_t token, int64_t time_us)
+    {
+        auto &pending = _pending_draws[token % PENDING_DRAW_NUM];
+        pending.token = token;
+        pending.time_us = time_us;
+    }
+
+    /**
+     * @brief Count a transfer which is started successfully
+     *
+     * @param[in] bytes Size of the transfer in bytes
+     */
+    void onDrawBitmapSent(size_t bytes)
+    {
+        _draw_bitmap_count++;
+        _draw_bitmap_bytes += bytes;
+    }
+
+    /**
+     * @brief Record the finish time of a transfer, it should be called from the transfer finish interrupt
+     *
+     * The latency is not measured if the submission time is overwritten, when more than `PENDING_DRAW_NUM` transfers
+     * are in flight.
+     *
+     * @param[in] token Token of the transfer
+     * @param[in] time_us Timestamp in microseconds
+     */
+    __attribute__((always_inline)) inline void onDrawBitmapFinish(uint32_t token, int64_t time_us)
+    {
+        auto &pending = _pending_draws[token % PENDING_DRAW_NUM];
+        if ((pending.time_us == 0) || (pending.token != token)) {
+            return;
+        }
+
+        uint32_t latency_us = static_cast<uint32_t>(time_us - pending.time_us);
+        pending.time_us = 0;
+        _latency_buckets[getLatencyBucketIndex(latency_us)]++;
+        _latency_count++;
+        _latency_sum_us += latency_us;
+        if ((_latency_count == 1) || (latency_us < _latency_min_us)) {
+            _latency_min_us = latency_us;
+        }
+        if (latency_us > _latency_max_us) {
+            _latency_max_us = latency_us;
+        }
+    }
+
+    /**
+     * @brief Record the end of a frame, it should be called from the refresh finish interrupt
+     *
+     * @param[in] time_us Timestamp in microseconds
+     */
+    __attribute__((always_inline)) inline void onRefreshFinish(int64_t time_us)
+    {
+        if (_refresh_time_us != 0) {
+            int32_t period_us = static_cast<int32_t>(time_us - _refresh_time_us);
+            if (_refresh_period_us == 0) {
+                _refresh_period_us = period_us;
+            } else {
+                _refresh_period_us += (period_us - _refresh_period_us) >> REFRESH_PERIOD_SHIFT;
+            }
+        }
+        _refresh_time_us = time_us;
+        _refresh_count++;
+    }
+
+    /**
+     * @brief Record the time blocked waiting for the transfers to finish
+     *
+     * @param[in] wait_us Blocked time in microseconds
+     */
+    void onWaitFinish(int64_t wait_us)
+    {
+        _wait_count++;
+        _wait_time_us += wait_us;
+        if (wait_us > _wait_max_us) {
+            _wait_max_us = wait_us;
+        }
+    }
+
+    /**
+     * @brief Get the number of the transfers
+     *
+     * @return Number of transfers
+     */
+    uint32_t getDrawBitmapCount() const
+    {
+        return _draw_bitmap_count;
+    }
+
+    /**
+     * @brief Get the size of the transfers
+     *
+     * @return Size in bytes
+     */
+    uint64_t getDrawBitmapBytes() const
+    {
+        return _draw_bitmap_bytes;
+    }
+
+    /**
+     * @brief Get the number of the measured latencies
+     *
+     * @return Number of latencies
+     */
+    uint32_t getLatencyCount() const
+    {
+        return _latency_count;
+    }
+
+    /**
+     * @brief Get the number of the latencies in a bucket
+     *
+     * @param[in] index Bucket index, see `getLatencyBucketIndex()`
+     * @return Number of latencies, `0` if the index is invalid
+     */
+    uint32_t getLatencyBucket(int index) const
+    {
+        return ((index >= 0) && (index < LATENCY_BUCKET_NUM)) ? _latency_buckets[index] : 0;
+    }
+
+    /**
+     * @brief Get the minimum latency
+     *
+     * @return Latency in microseconds, `0` if none is measured
+     */
+    uint32_t getLatencyMinUs() const
+    {
+        return _latency_min_us;
+    }
+
+    /**
+     * @brief Get the maximum latency
+     *
+     * @return Latency in microseconds, `0` if none is measured
+     */
+    uint32_t getLatencyMaxUs() const
+    {
+        return _latency_max_us;
+    }
+
+    /**
+     * @brief Get the average latency
+     *
+     * @return Latency in microseconds, `0` if none is measured
+     */
+    uint32_t getLatencyAverageUs() const
+    {
+        return (_latency_count > 0) ? static_cast<uint32_t>(_latency_sum_us / _latency_count) : 0;
+    }
+
+    /**
+     * @brief Get an upper bound of a latency percentile from the histogram
+     *
+     * @param[in] percent Percentile, in the range of [0, 100]
+     * @return Upper bound of the bucket holding the percentile, capped by the maximum latency. `0` if none is measured
+     */
+    uint32_t getLatencyPercentileUs(int percent) const;
+
+    /**
+     * @brief Get the number of the finished frames
+     *
+     * @return Number of frames
+     */
+    uint32_t getRefreshCount() const
+    {
+        return _refresh_count;
+    }
+
+    /**
+     * @brief Get the refresh rate, averaged over the recent frames
+     *
+     * @return Refresh rate in Hz, `0` if not enough frames are finished
+     */
+    float getRefreshRate() const
+    {
+        return (_refresh_period_us > 0) ? 1000000.0f / _refresh_period_us : 0;
+    }
+
+    /**
+     * @brief Get the number of the blocking waits
+     *
+     * @return Number of waits
+     */
+    uint32_t getWaitCount() const
+    {
+        return _wait_count;
+    }
+
+    /**
+     * @brief Get the total time of the blocking waits
+     *
+     * @return Time in microseconds
+     */
+    int64_t getWaitTimeUs() const
+    {
+        return _wait_time_us;
+    }
+
+    /**
+     * @brief Get the longest blocking wait
+     *
+     * @return Time in microseconds
+     */
+    int64_t getWaitMaxUs() const
+    {
+        return _wait_max_us;
+    }
+
+    /**
+     * @brief Format the counters as multiple lines of text
+     *
+     * @return Text
+     */
+    std::string toString() const;
+
+    /**
+     * @brief Get the bucket of a latency
+     *
+     * Bucket `0` holds the latencies in [0, 2) us, bucket `i` holds the ones in [2^i, 2^(i+1)) us, and the last bucket
+     * holds all the longer ones.
+     *
+     * @param[in] latency_us Latency in microseconds
+     * @return Bucket index
+     */
+    static constexpr int getLatencyBucketIndex(uint32_t latency_us)
+    {
+        int index = (latency_us > 1) ? (31 - __builtin_clz(latency_us)) : 0;
+        return (index < LATENCY_BUCKET_NUM) ? index : (LATENCY_BUCKET_NUM - 1);
+    }
+
+    /**
+     * @brief Get the lower bound of a latency bucket
+     *
+     * @param[in] index Bucket index
+     * @return Latency in microseconds
+     */
+    static constexpr uint32_t getLatencyBucketLowerUs(int index)
+    {
+        return (index > 0) ? (1U << index) : 0;
+    }
+
+private:
+    struct PendingDraw {
+        uint32_t token = 0;
+        int64_t time_us = 0;
+    };
+
+    uint32_t _draw_bitmap_count = 0;
+    uint64_t _draw_bitmap_bytes = 0;
+    PendingDraw _pending_draws[PENDING_DRAW_NUM] = {};
+    uint32_t _latency_buckets[LATENCY_BUCKET_NUM] = {};
+    uint32_t _latency_count = 0;
+    uint64_t _latency_sum_us = 0;
+    uint32_t _latency_min_us = 0;
+    uint32_t _latency_max_us = 0;
+    uint32_t _refresh_count = 0;
+    int64_t _refresh_time_us = 0;
+    int32_t _refresh_period_us = 0;
+    uint32_t _wait_count = 0;
+    int64_t _wait_time_us = 0;
+    int64_t _wait_max_us = 0;
+};
+
+} // namespace esp_panel::drivers
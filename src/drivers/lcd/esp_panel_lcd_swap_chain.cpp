@@ -0,0 +1,110 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "esp_panel_lcd_swap_chain.hpp"
+
+namespace esp_panel::drivers {
+
+bool LCD_SwapChain::init(void *const buffers[], int buffer_num, PresentMode mode)
+{
+    if ((buffers == nullptr) || (buffer_num < BUFFER_NUM_MIN) || (buffer_num > BUFFER_NUM_MAX)) {
+        return false;
+    }
+    for (int i = 0; i < buffer_num; i++) {
+        if (buffers[i] == nullptr) {
+            return false;
+        }
+    }
+
+    deinit();
+    for (int i = 0; i < buffer_num; i++) {
+        _buffers[i] = buffers[i];
+        _states[i] = BufferState::FREE;
+    }
+    _buffer_num = buffer_num;
+    _mode = mode;
+    // The panel scans out the first frame buffer after initialization
+    _states[0] = BufferState::FRONT;
+    _front_index = 0;
+
+    return true;
+}
+
+int LCD_SwapChain::acquire()
+{
+    int index = -1;
+    for (int i = 0; i < _buffer_num; i++) {
+        if ((_states[i] == BufferState::FREE) && ((index < 0) || (_present_ids[i] > _present_ids[index]))) {
+            index = i;
+        }
+    }
+    if (index >= 0) {
+        _states[index] = BufferState::ACQUIRED;
+    }
+
+    return index;
+}
+
+bool LCD_SwapChain::release(int index)
+{
+    if ((index < 0) || (index >= _buffer_num) || (_states[index] != BufferState::ACQUIRED)) {
+        return false;
+    }
+    _states[index] = BufferState::FREE;
+
+    return true;
+}
+
+bool LCD_SwapChain::present(int index)
+{
+    if ((index < 0) || (index >= _buffer_num) || (_states[index] != BufferState::ACQUIRED) || !canPresent()) {
+        return false;
+    }
+
+    if (_queued_index >= 0) {
+        _states[_queued_index] = BufferState::FREE;
+        _dropped_count++;
+    }
+    _present_count++;
+    _present_ids[index] = _present_count;
+    _states[index] = BufferState::QUEUED;
+    _queued_index = index;
+
+    return true;
+}
+
+int LCD_SwapChain::getAge(int index) const
+{
+    if ((index < 0) || (index >= _buffer_num) || (_present_ids[index] == 0)) {
+        return 0;
+    }
+
+    return static_cast<int>(_present_count - _present_ids[index]) + 1;
+}
+
+int LCD_SwapChain::getLatestIndex() const
+{
+    for (int i = 0; i < _buffer_num; i++) {
+        if ((_present_ids[i] > 0) && (_present_ids[i] == _present_count)) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+int LCD_SwapChain::getIndex(const void *buffer) const
+{
+    for (int i = 0; i < _buffer_num; i++) {
+        if (_buffers[i] == buffer) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+} // namespace esp_panel::drivers
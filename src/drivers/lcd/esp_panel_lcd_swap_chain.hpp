@@ -0,0 +1,239 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace esp_panel::drivers {
+
+/**
+ * @brief Swap chain state machine for the frame buffers of RGB and MIPI-DSI panels
+ *
+ * Each buffer is in one of the states below:
+ *  - `FREE`: can be acquired for rendering
+ *  - `ACQUIRED`: being rendered by the application
+ *  - `QUEUED`: presented, it will be scanned out from the next refresh
+ *  - `FRONT`: being scanned out by the panel
+ *
+ * The panel keeps scanning the front buffer until the next refresh finishes after a buffer is queued, then the queued
+ * buffer becomes the front one and the previous front buffer is released. This class only holds the state and
+ * doesn't lock or wait, the caller should protect it against the refresh interrupt.
+ */
+class LCD_SwapChain {
+public:
+    static constexpr int BUFFER_NUM_MIN = 2;    /*!< Minimum number of buffers */
+    static constexpr int BUFFER_NUM_MAX = 3;    /*!< Maximum number of buffers */
+
+    /**
+     * @brief Present mode enumeration
+     */
+    enum class PresentMode : uint8_t {
+        FIFO = 0,   /*!< Every presented buffer is shown, presenting waits while another one is queued */
+        MAILBOX,    /*!< Presenting never waits, a queued buffer which is not shown yet is replaced */
+    };
+
+    /**
+     * @brief Buffer state enumeration
+     */
+    enum class BufferState : uint8_t {
+        FREE = 0,
+        ACQUIRED,
+        QUEUED,
+        FRONT,
+    };
+
+    /**
+     * @brief Initialize the swap chain, the first buffer is the front one
+     *
+     * @param[in] buffers Array of the frame buffers
+     * @param[in] buffer_num Number of the frame buffers, the range is [`BUFFER_NUM_MIN`, `BUFFER_NUM_MAX`]
+     * @param[in] mode Present mode
+     * @return `true` if successful, `false` if the parameters are invalid
+     */
+    bool init(void *const buffers[], int buffer_num, PresentMode mode);
+
+    /**
+     * @brief Deinitialize the swap chain
+     */
+    void deinit()
+    {
+        *this = LCD_SwapChain();
+    }
+
+    /**
+     * @brief Check if the swap chain is initialized
+     */
+    bool isInit() const
+    {
+        return _buffer_num > 0;
+    }
+
+    /**
+     * @brief Acquire a free buffer for rendering
+     *
+     * The free buffer with the most recent content is chosen, so its age is the smallest
+     *
+     * @return Index of the buffer, `-1` if no buffer is free
+     */
+    int acquire();
+
+    /**
+     * @brief Release an acquired buffer without presenting it
+     *
+     * @param[in] index Index of the buffer
+     * @return `true` if successful, `false` if the buffer is not acquired
+     */
+    bool release(int index);
+
+    /**
+     * @brief Check if a buffer can be presented now
+     *
+     * @return `true` if possible, `false` if the caller should wait for the next refresh (FIFO mode only)
+     */
+    bool canPresent() const
+    {
+        return (_mode == PresentMode::MAILBOX) || (_queued_index < 0);
+    }
+
+    /**
+     * @brief Queue an acquired buffer, the caller should switch the panel to it before calling this function
+     *
+     * @param[in] index Index of the buffer
+     * @return `true` if successful, `false` if the buffer is not acquired or `canPresent()` is `false`
+     * @note In MAILBOX mode, the queued buffer which is not shown yet is released and counted as dropped
+     */
+    bool present(int index);
+
+    /**
+     * @brief Update the state when the panel finishes a refresh, it should be called from the refresh interrupt
+     *
+     * @return `true` if a buffer is released, `false` otherwise
+     */
+    __attribute__((always_inline)) inline bool onRefreshFinish()
+    {
+        if (_queued_index < 0) {
+            return false;
+        }
+        if (_front_index >= 0) {
+            _states[_front_index] = BufferState::FREE;
+        }
+        _states[_queued_index] = BufferState::FRONT;
+        _front_index = _queued_index;
+        _queued_index = -1;
+
+        return true;
+    }
+
+    /**
+     * @brief Get the age of a buffer
+     *
+     * The age is the number of presents since the content of the buffer was presented: `1` means the content is the
+     * previous frame, `2` the one before it, and so on
+     *
+     * @param[in] index Index of the buffer
+     * @return Age of the buffer, `0` if its content is undefined (never presented)
+     */
+    int getAge(int index) const;
+
+    /**
+     * @brief Get the index of the buffer which holds the latest presented frame
+     *
+     * @return Index of the buffer, `-1` if nothing is presented yet
+     */
+    int getLatestIndex() const;
+
+    /**
+     * @brief Get the index of a buffer
+     *
+     * @param[in] buffer Pointer of the buffer
+     * @return Index of the buffer, `-1` if not found
+     */
+    int getIndex(const void *buffer) const;
+
+    /**
+     * @brief Get the pointer of a buffer
+     *
+     * @param[in] index Index of the buffer
+     * @return Pointer of the buffer, `nullptr` if the index is invalid
+     */
+    void *getBuffer(int index) const
+    {
+        return ((index >= 0) && (index < _buffer_num)) ? _buffers[index] : nullptr;
+    }
+
+    /**
+     * @brief Get the state of a buffer
+     *
+     * @param[in] index Index of the buffer
+     * @return State of the buffer
+     */
+    BufferState getState(int index) const
+    {
+        return ((index >= 0) && (index < _buffer_num)) ? _states[index] : BufferState::FREE;
+    }
+
+    /**
+     * @brief Get the number of buffers
+     */
+    int getBufferNum() const
+    {
+        return _buffer_num;
+    }
+
+    /**
+     * @brief Get the present mode
+     */
+    PresentMode getMode() const
+    {
+        return _mode;
+    }
+
+    /**
+     * @brief Get the index of the front buffer
+     */
+    int getFrontIndex() const
+    {
+        return _front_index;
+    }
+
+    /**
+     * @brief Get the index of the queued buffer, `-1` if none
+     */
+    int getQueuedIndex() const
+    {
+        return _queued_index;
+    }
+
+    /**
+     * @brief Get the number of presents since initialization
+     */
+    uint32_t getPresentCount() const
+    {
+        return _present_count;
+    }
+
+    /**
+     * @brief Get the number of presented buffers which are replaced before being shown (MAILBOX mode only)
+     */
+    uint32_t getDroppedCount() const
+    {
+        return _dropped_count;
+    }
+
+private:
+    void *_buffers[BUFFER_NUM_MAX] = {};
+    BufferState _states[BUFFER_NUM_MAX] = {};
+    uint32_t _present_ids[BUFFER_NUM_MAX] = {};     // Value of `_present_count` when the buffer was presented
+    int _buffer_num = 0;
+    PresentMode _mode = PresentMode::FIFO;
+    volatile int _front_index = -1;
+    volatile int _queued_index = -1;
+    uint32_t _present_count = 0;
+    uint32_t _dropped_count = 0;
+};
+
+} // namespace esp_panel::drivers
@@ -0,0 +1,67 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include "esp_panel_lcd_tear_sync.hpp"
+
+namespace esp_panel::drivers {
+
+void LCD_TearSync::onWriteFinish(int pixels, int64_t duration_us)
+{
+    if ((pixels <= 0) || (duration_us <= 0)) {
+        return;
+    }
+
+    // Exponential moving average (1/4 weight), the first write is taken as is
+    int64_t speed_q4 = duration_us * 16000 / pixels;
+    _write_ns_per_pixel_q4 = (_write_ns_per_pixel_q4 == 0) ? speed_q4 :
+                             (_write_ns_per_pixel_q4 + (speed_q4 - _write_ns_per_pixel_q4) / 4);
+}
+
+int64_t LCD_TearSync::getWaitTime(int64_t now_us, int y_start, int height, int pixels) const
+{
+    if (!isLocked() || (_height <= 0)) {
+        return 0;
+    }
+
+    int64_t period = _period_q4 / 16;
+    int64_t phase = std::max<int64_t>(now_us - _edge_time_us, 0) % period;
+    // Time after TE when the scanline reaches the first row and leaves the last row
+    int64_t scan_start = static_cast<int64_t>(std::clamp(y_start, 0, _height)) * period / _height;
+    int64_t scan_end = static_cast<int64_t>(std::clamp(y_start + height, 0, _height)) * period / _height;
+    int64_t write = getWriteTimeUs(pixels);
+
+    if (isSafeStart(phase, scan_start, scan_end, write)) {
+        return 0;
+    }
+
+    // Pick the earlier safe one of the two candidates
+    int64_t wait_edge = period - phase;
+    int64_t wait_scan_end = (scan_end - phase + period) % period;
+    bool is_edge_safe = isSafeStart(0, scan_start, scan_end, write);
+    bool is_scan_end_safe = isSafeStart(scan_end % period, scan_start, scan_end, write);
+    if (is_scan_end_safe && (!is_edge_safe || (wait_scan_end < wait_edge))) {
+        return wait_scan_end;
+    }
+
+    return wait_edge;
+}
+
+bool LCD_TearSync::isSafeStart(int64_t phase_us, int64_t scan_start_us, int64_t scan_end_us, int64_t write_us) const
+{
+    // The scanline is inside the rows, the upper part is already shown while the lower part is not
+    if ((phase_us > scan_start_us) && (phase_us < scan_end_us)) {
+        return false;
+    }
+
+    // Both the write pointer and the scanline move down linearly, so checking the last row is enough: it must be
+    // written before the scanline reaches it, in this frame or in the next one if the scanline has passed the rows
+    int64_t scan_last_us = (phase_us < scan_start_us) ? scan_end_us : (scan_end_us + _period_q4 / 16);
+
+    return phase_us + write_us <= scan_last_us;
+}
+
+} // namespace esp_panel::drivers
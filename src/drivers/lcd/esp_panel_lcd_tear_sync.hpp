@@ -0,0 +1,170 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace esp_panel::drivers {
+
+/**
+ * @brief Tearing effect (TE) synchronization for panels with internal GRAM (SPI/QSPI/I80)
+ *
+ * The panel pulses the TE pin when it starts scanning a new frame out of its GRAM. From the timestamps of the pulses,
+ * this class estimates the refresh period and the current scanline, then schedules each write so that it never
+ * crosses the scanline: either racing ahead of it (started right after TE) or trailing behind it. The timestamps are
+ * passed in by the caller, so it runs on the host with a simulated TE source as well.
+ *
+ * This class doesn't lock, the caller should protect it against the TE interrupt.
+ */
+class LCD_TearSync {
+public:
+    static constexpr int LOCK_EDGE_NUM = 4;             /*!< Number of valid periods before the estimate is used */
+    static constexpr int PERIOD_MIN_US = 4000;          /*!< Minimum period of the TE pulses, 250 Hz */
+    static constexpr int PERIOD_MAX_US = 100000;        /*!< Maximum period of the TE pulses, 10 Hz */
+
+    /**
+     * @brief Reset the estimate, configure the number of the scanned rows
+     *
+     * @param[in] height Height of the panel (number of the scanned rows)
+     */
+    void configure(int height)
+    {
+        *this = LCD_TearSync();
+        _height = height;
+    }
+
+    /**
+     * @brief Record a TE pulse, it should be called from the TE interrupt
+     *
+     * Once the period is known, the pulses within half a period after the last one are dropped as glitches and the
+     * intervals of missed pulses are divided by the number of periods. The intervals outside [`PERIOD_MIN_US`,
+     * `PERIOD_MAX_US`] are not measured.
+     *
+     * @param[in] time_us Timestamp of the pulse in microseconds
+     */
+    __attribute__((always_inline)) inline void onTearingEffect(int64_t time_us)
+    {
+        int64_t interval = time_us - _edge_time_us;
+        if (_edge_count == 0) {
+            _edge_time_us = time_us;
+            _edge_count++;
+            return;
+        }
+
+        if (_period_q4 > 0) {
+            int periods = static_cast<int>((interval * 16 + _period_q4 / 2) / _period_q4);
+            // A glitch shortly after the last pulse, ignore it completely
+            if (periods <= 0) {
+                return;
+            }
+            interval /= periods;
+        }
+        _edge_time_us = time_us;
+        _edge_count++;
+        if ((interval < PERIOD_MIN_US) || (interval > PERIOD_MAX_US)) {
+            return;
+        }
+
+        // Exponential moving average (1/8 weight) in Q4 fixed point, the first period is taken as is
+        int64_t interval_q4 = interval * 16;
+        _period_q4 = (_period_q4 == 0) ? interval_q4 : (_period_q4 + (interval_q4 - _period_q4) / 8);
+        if (_period_count < LOCK_EDGE_NUM) {
+            _period_count++;
+        }
+    }
+
+    /**
+     * @brief Record the duration of a finished write, used to estimate the write speed
+     *
+     * @param[in] pixels Number of the written pixels
+     * @param[in] duration_us Duration of the write in microseconds
+     */
+    void onWriteFinish(int pixels, int64_t duration_us);
+
+    /**
+     * @brief Check if the refresh period is known
+     */
+    bool isLocked() const
+    {
+        return _period_count >= LOCK_EDGE_NUM;
+    }
+
+    /**
+     * @brief Get the estimated refresh period
+     *
+     * @return Period in microseconds, `0` if not locked
+     */
+    int getPeriodUs() const
+    {
+        return isLocked() ? static_cast<int>(_period_q4 / 16) : 0;
+    }
+
+    /**
+     * @brief Get the measured refresh rate of the panel
+     *
+     * @return Refresh rate in Hz, `0` if not locked
+     */
+    float getRefreshRate() const
+    {
+        return isLocked() ? (16e6f / _period_q4) : 0;
+    }
+
+    /**
+     * @brief Get the timestamp of the last TE pulse
+     */
+    int64_t getEdgeTime() const
+    {
+        return _edge_time_us;
+    }
+
+    /**
+     * @brief Get the number of TE pulses since configured
+     */
+    uint32_t getEdgeCount() const
+    {
+        return _edge_count;
+    }
+
+    /**
+     * @brief Get the estimated duration of a write
+     *
+     * @param[in] pixels Number of the pixels
+     * @return Duration in microseconds, `0` if the write speed is unknown
+     */
+    int64_t getWriteTimeUs(int pixels) const
+    {
+        return static_cast<int64_t>(pixels) * _write_ns_per_pixel_q4 / 16000;
+    }
+
+    /**
+     * @brief Get the time to wait before writing rows without tearing
+     *
+     * A start time is safe if the scanline is outside the rows and won't catch up with (or be caught by) the write
+     * pointer before the write finishes. If now is not safe, the earliest safe start among "right after the next TE"
+     * and "right after the scanline leaves the rows" is chosen. If neither is safe (the write is slower than a whole
+     * frame), it starts right after the next TE.
+     *
+     * @param[in] now_us Current time in microseconds
+     * @param[in] y_start Start row of the write
+     * @param[in] height Number of the rows
+     * @param[in] pixels Number of the pixels, used to estimate the write duration
+     * @return Wait time in microseconds, `0` to start now (or if not locked)
+     */
+    int64_t getWaitTime(int64_t now_us, int y_start, int height, int pixels) const;
+
+private:
+    bool isSafeStart(int64_t phase_us, int64_t scan_start_us, int64_t scan_end_us, int64_t write_us) const;
+
+    int _height = 0;
+    int64_t _edge_time_us = 0;
+    uint32_t _edge_count = 0;
+    int _period_count = 0;
+    int64_t _period_q4 = 0;                 // Period in 1/16 microseconds
+    int64_t _write_ns_per_pixel_q4 = 0;     // Write speed in 1/16 nanoseconds per pixel
+};
+
+} // namespace esp_panel::drivers
@@ -0,0 +1,225 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include "esp_panel_lcd_transform.hpp"
+
+namespace esp_panel::drivers {
+
+namespace {
+
+struct Pixel24 {
+    uint8_t bytes[3];
+};
+
+void mapPoint(const LCD_Transform::Operation &operation, int width, int height, int x, int y, int &out_x, int &out_y)
+{
+    if (operation.mirror_x) {
+        x = width - 1 - x;
+    }
+    if (operation.mirror_y) {
+        y = height - 1 - y;
+    }
+
+    switch (operation.rotation) {
+    case LCD_Transform::Rotation::ROTATE_90:
+        out_x = y;
+        out_y = width - 1 - x;
+        break;
+    case LCD_Transform::Rotation::ROTATE_180:
+        out_x = width - 1 - x;
+        out_y = height - 1 - y;
+        break;
+    case LCD_Transform::Rotation::ROTATE_270:
+        out_x = height - 1 - y;
+        out_y = x;
+        break;
+    default:
+        out_x = x;
+        out_y = y;
+        break;
+    }
+}
+
+/**
+ * Copy the source pixels one by one to the destination, `step_x`/`step_y` are the destination byte offsets for the
+ * next source column/row. The source is walked block by block, so the destination lines written by a block stay in
+ * cache when rotating by 90/270 degrees.
+ */
+template <typename T>
+void copyBlocked(
+    const uint8_t *src, int width, int height, int src_stride, uint8_t *dst, ptrdiff_t step_x, ptrdiff_t step_y,
+    int block_width, int block_height
+)
+{
+    for (int block_y = 0; block_y < height; block_y += block_height) {
+        int block_y_end = std::min(block_y + block_height, height);
+        for (int block_x = 0; block_x < width; block_x += block_width) {
+            int block_x_end = std::min(block_x + block_width, width);
+            for (int y = block_y; y < block_y_end; y++) {
+                const T *from = reinterpret_cast<const T *>(src + y * src_stride) + block_x;
+                uint8_t *to = dst + y * step_y + block_x * step_x;
+                int x = block_x;
+                for (; x + 4 <= block_x_end; x += 4) {
+                    T p0 = from[0];
+                    T p1 = from[1];
+                    T p2 = from[2];
+                    T p3 = from[3];
+                    from += 4;
+                    *reinterpret_cast<T *>(to) = p0;
+                    *reinterpret_cast<T *>(to + step_x) = p1;
+                    *reinterpret_cast<T *>(to + 2 * step_x) = p2;
+                    *reinterpret_cast<T *>(to + 3 * step_x) = p3;
+                    to += 4 * step_x;
+                }
+                for (; x < block_x_end; x++) {
+                    *reinterpret_cast<T *>(to) = *from++;
+                    to += step_x;
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+LCD_Transform::Rect LCD_Transform::mapRect(
+    const Operation &operation, int image_width, int image_height, const Rect &rect
+)
+{
+    if ((rect.width <= 0) || (rect.height <= 0)) {
+        return {};
+    }
+
+    int x1 = 0;
+    int y1 = 0;
+    int x2 = 0;
+    int y2 = 0;
+    mapPoint(operation, image_width, image_height, rect.x, rect.y, x1, y1);
+    mapPoint(operation, image_width, image_height, rect.x + rect.width - 1, rect.y + rect.height - 1, x2, y2);
+
+    return {
+        .x = std::min(x1, x2),
+        .y = std::min(y1, y2),
+        .width = std::abs(x2 - x1) + 1,
+        .height = std::abs(y2 - y1) + 1,
+    };
+}
+
+bool LCD_Transform::transform(
+    const Operation &operation, int bits_per_pixel, const uint8_t *src, int src_width, int src_height,
+    int src_stride, uint8_t *dst, int dst_stride, const BlockSize &block
+)
+{
+    int bytes_per_pixel = getBytesPerPixel(bits_per_pixel);
+    if ((bytes_per_pixel == 0) || (src == nullptr) || (dst == nullptr) || (src_width < 0) || (src_height < 0)) {
+        return false;
+    }
+    if ((src_width == 0) || (src_height == 0)) {
+        return true;
+    }
+
+    int dst_width = operation.isSwapXY() ? src_height : src_width;
+    src_stride = (src_stride > 0) ? src_stride : src_width * bytes_per_pixel;
+    dst_stride = (dst_stride > 0) ? dst_stride : dst_width * bytes_per_pixel;
+
+    // The transformation is affine, so the destination offset is `origin + x * step_x + y * step_y`
+    int origin_x = 0;
+    int origin_y = 0;
+    int next_x_x = 0;
+    int next_x_y = 0;
+    int next_y_x = 0;
+    int next_y_y = 0;
+    mapPoint(operation, src_width, src_height, 0, 0, origin_x, origin_y);
+    mapPoint(operation, src_width, src_height, 1, 0, next_x_x, next_x_y);
+    mapPoint(operation, src_width, src_height, 0, 1, next_y_x, next_y_y);
+    ptrdiff_t pitch = dst_stride;
+    ptrdiff_t step_x = (next_x_x - origin_x) * bytes_per_pixel + (next_x_y - origin_y) * pitch;
+    ptrdiff_t step_y = (next_y_x - origin_x) * bytes_per_pixel + (next_y_y - origin_y) * pitch;
+    uint8_t *dst_origin = dst + origin_y * pitch + origin_x * bytes_per_pixel;
+
+    // Lines are kept in order, copy them directly
+    if (step_x == bytes_per_pixel) {
+        for (int y = 0; y < src_height; y++) {
+            memcpy(dst_origin + y * step_y, src + y * src_stride, src_width * bytes_per_pixel);
+        }
+        return true;
+    }
+
+    int block_width = (block.width > 0) ? block.width : BLOCK_WIDTH_DEFAULT;
+    int block_height = (block.height > 0) ? block.height : BLOCK_HEIGHT_DEFAULT;
+    switch (bytes_per_pixel) {
+    case 1:
+        copyBlocked<uint8_t>(
+            src, src_width, src_height, src_stride, dst_origin, step_x, step_y, block_width, block_height
+        );
+        break;
+    case 2:
+        copyBlocked<uint16_t>(
+            src, src_width, src_height, src_stride, dst_origin, step_x, step_y, block_width, block_height
+        );
+        break;
+    case 3:
+        copyBlocked<Pixel24>(
+            src, src_width, src_height, src_stride, dst_origin, step_x, step_y, block_width, block_height
+        );
+        break;
+    default:
+        copyBlocked<uint32_t>(
+            src, src_width, src_height, src_stride, dst_origin, step_x, step_y, block_width, block_height
+        );
+        break;
+    }
+
+    return true;
+}
+
+bool LCD_Transform::transformRect(
+    const Operation &operation, int bits_per_pixel, const uint8_t *src, int src_width, int src_height,
+    int src_stride, const Rect &rect, uint8_t *dst, int dst_stride, const BlockSize &block
+)
+{
+    int bytes_per_pixel = getBytesPerPixel(bits_per_pixel);
+    if ((bytes_per_pixel == 0) || (src == nullptr) || (dst == nullptr)) {
+        return false;
+    }
+    if ((rect.x < 0) || (rect.y < 0) || (rect.x + rect.width > src_width) || (rect.y + rect.height > src_height)) {
+        return false;
+    }
+
+    int dst_width = operation.isSwapXY() ? src_height : src_width;
+    src_stride = (src_stride > 0) ? src_stride : src_width * bytes_per_pixel;
+    dst_stride = (dst_stride > 0) ? dst_stride : dst_width * bytes_per_pixel;
+
+    // A sub-rectangle keeps its orientation, so transform it as a standalone image at its mapped position
+    Rect dst_rect = mapRect(operation, src_width, src_height, rect);
+
+    return transform(
+               operation, bits_per_pixel, src + rect.y * src_stride + rect.x * bytes_per_pixel, rect.width,
+               rect.height, src_stride, dst + dst_rect.y * dst_stride + dst_rect.x * bytes_per_pixel, dst_stride, block
+           );
+}
+
+int LCD_Transform::getBytesPerPixel(int bits_per_pixel)
+{
+    switch (bits_per_pixel) {
+    case 8:
+        return 1;
+    case 16:
+        return 2;
+    case 18:
+    case 24:
+        return 3;
+    case 32:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+} // namespace esp_panel::drivers
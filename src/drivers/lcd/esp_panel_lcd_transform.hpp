@@ -0,0 +1,174 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esp_panel::drivers {
+
+/**
+ * @brief Software pixel transformation (rotation and mirroring) for LCD bitmaps
+ *
+ * This class provides cache-blocked kernels to rotate and mirror bitmaps of 8/16/24/32 bits per pixel.
+ */
+class LCD_Transform {
+public:
+    /**
+     * @brief Rotation enumeration, consistent with the LVGL port
+     *
+     * For an image of width `W` and height `H`, the pixel `(x, y)` is moved to:
+     *  - `ROTATE_90`: `(y, W - 1 - x)`, the result is `H` x `W`
+     *  - `ROTATE_180`: `(W - 1 - x, H - 1 - y)`, the result is `W` x `H`
+     *  - `ROTATE_270`: `(H - 1 - y, x)`, the result is `H` x `W`
+     */
+    enum class Rotation : uint8_t {
+        ROTATE_0 = 0,
+        ROTATE_90,
+        ROTATE_180,
+        ROTATE_270,
+    };
+
+    /**
+     * @brief Transformation operation structure
+     *
+     * Mirroring is applied to the source image before the rotation
+     */
+    struct Operation {
+        /**
+         * @brief Check if the operation doesn't change the image
+         *
+         * @return `true` if identity, `false` otherwise
+         */
+        bool isIdentity() const
+        {
+            return (rotation == Rotation::ROTATE_0) && !mirror_x && !mirror_y;
+        }
+
+        /**
+         * @brief Check if the operation swaps the width and height of the image
+         *
+         * @return `true` if swapped, `false` otherwise
+         */
+        bool isSwapXY() const
+        {
+            return (rotation == Rotation::ROTATE_90) || (rotation == Rotation::ROTATE_270);
+        }
+
+        Rotation rotation = Rotation::ROTATE_0; /*!< Rotation */
+        bool mirror_x = false;                  /*!< Mirror the source image horizontally */
+        bool mirror_y = false;                  /*!< Mirror the source image vertically */
+    };
+
+    /**
+     * @brief Rectangle structure
+     */
+    struct Rect {
+        int x = 0;          /*!< X coordinate of the top left point */
+        int y = 0;          /*!< Y coordinate of the top left point */
+        int width = 0;      /*!< Width */
+        int height = 0;     /*!< Height */
+    };
+
+    static constexpr int BLOCK_WIDTH_DEFAULT = 32;   /*!< Default number of source columns per block */
+    static constexpr int BLOCK_HEIGHT_DEFAULT = 256; /*!< Default number of source rows per block */
+
+    /**
+     * @brief Block size structure for cache blocking, in source pixels
+     */
+    struct BlockSize {
+        int width = BLOCK_WIDTH_DEFAULT;    /*!< Number of source columns per block */
+        int height = BLOCK_HEIGHT_DEFAULT;  /*!< Number of source rows per block */
+    };
+
+    /**
+     * @brief Map a rectangle of the source image to the transformed image
+     *
+     * @param[in] operation Transformation operation
+     * @param[in] image_width Width of the source image
+     * @param[in] image_height Height of the source image
+     * @param[in] rect Rectangle in the source image
+     * @return Rectangle in the transformed image
+     */
+    static Rect mapRect(const Operation &operation, int image_width, int image_height, const Rect &rect);
+
+    /**
+     * @brief Transform a whole image
+     *
+     * @param[in] operation Transformation operation
+     * @param[in] bits_per_pixel Bits per pixel, supports 8/16/24/32 (18 is treated as 24)
+     * @param[in] src Pointer of the source image
+     * @param[in] src_width Width of the source image
+     * @param[in] src_height Height of the source image
+     * @param[in] src_stride Bytes per line of the source image, `0` means packed
+     * @param[out] dst Pointer of the destination image, should not overlap with the source
+     * @param[in] dst_stride Bytes per line of the destination image, `0` means packed
+     * @param[in] block Block size used to keep the destination lines in cache
+     * @return `true` if successful, `false` if the parameters are invalid
+     * @note For 16/32 bits per pixel, the buffers and strides should be aligned to the pixel size
+     */
+    static bool transform(
+        const Operation &operation, int bits_per_pixel, const uint8_t *src, int src_width, int src_height,
+        int src_stride, uint8_t *dst, int dst_stride, const BlockSize &block
+    );
+
+    /**
+     * @brief Transform a whole image with the default block size
+     */
+    static bool transform(
+        const Operation &operation, int bits_per_pixel, const uint8_t *src, int src_width, int src_height,
+        int src_stride, uint8_t *dst, int dst_stride
+    )
+    {
+        return transform(operation, bits_per_pixel, src, src_width, src_height, src_stride, dst, dst_stride, {});
+    }
+
+    /**
+     * @brief Transform a rectangle of the source image into its position in the destination image
+     *
+     * This is typically used to update the dirty area of a rotated frame buffer
+     *
+     * @param[in] operation Transformation operation
+     * @param[in] bits_per_pixel Bits per pixel, supports 8/16/24/32 (18 is treated as 24)
+     * @param[in] src Pointer of the source image
+     * @param[in] src_width Width of the source image
+     * @param[in] src_height Height of the source image
+     * @param[in] src_stride Bytes per line of the source image, `0` means packed
+     * @param[in] rect Rectangle to transform in the source image
+     * @param[out] dst Pointer of the destination image (the whole transformed image)
+     * @param[in] dst_stride Bytes per line of the destination image, `0` means packed
+     * @param[in] block Block size used to keep the destination lines in cache
+     * @return `true` if successful, `false` if the parameters are invalid
+     */
+    static bool transformRect(
+        const Operation &operation, int bits_per_pixel, const uint8_t *src, int src_width, int src_height,
+        int src_stride, const Rect &rect, uint8_t *dst, int dst_stride, const BlockSize &block
+    );
+
+    /**
+     * @brief Transform a rectangle of the source image with the default block size
+     */
+    static bool transformRect(
+        const Operation &operation, int bits_per_pixel, const uint8_t *src, int src_width, int src_height,
+        int src_stride, const Rect &rect, uint8_t *dst, int dst_stride
+    )
+    {
+        return transformRect(
+                   operation, bits_per_pixel, src, src_width, src_height, src_stride, rect, dst, dst_stride, {}
+               );
+    }
+
+    /**
+     * @brief Get the number of bytes used to store a pixel
+     *
+     * @param[in] bits_per_pixel Bits per pixel
+     * @return Bytes per pixel, `0` if not supported
+     */
+    static int getBytesPerPixel(int bits_per_pixel);
+};
+
+} // namespace esp_panel::drivers
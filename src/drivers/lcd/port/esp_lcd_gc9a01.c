@@ -25,6 +25,7 @@
 #include "utils/esp_panel_utils_log.h"
 #include "esp_utils_helpers.h"
 #include "esp_panel_lcd_vendor_types.h"
+#include "esp_panel_lcd_dcs_window.h"
 
 static const char *TAG = "gc9a01";
 
@@ -41,6 +42,7 @@ static esp_err_t panel_gc9a01_disp_on_off(esp_lcd_panel_t *panel, bool off);
 typedef struct {
     esp_lcd_panel_t base;
     esp_lcd_panel_io_handle_t io;
+    esp_panel_lcd_dcs_window_t window; // save the last address window to skip the redundant commands
     int reset_gpio_num;
     bool reset_level;
     int x_gap;
@@ -112,6 +114,7 @@ esp_err_t esp_lcd_new_panel_gc9a01(const esp_lcd_panel_io_handle_t io, const esp
     }
 
     gc9a01->io = io;
+    esp_panel_lcd_dcs_window_init(&gc9a01->window, esp_panel_lcd_dcs_io_tx_param, esp_panel_lcd_dcs_io_tx_color, io, true);
     gc9a01->reset_gpio_num = panel_dev_config->reset_gpio_num;
     gc9a01->reset_level = panel_dev_config->flags.reset_active_high;
     if (panel_dev_config->vendor_config) {
@@ -162,6 +165,7 @@ static esp_err_t panel_gc9a01_reset(esp_lcd_panel_t *panel)
 {
     gc9a01_panel_t *gc9a01 = __containerof(panel, gc9a01_panel_t, base);
     esp_lcd_panel_io_handle_t io = gc9a01->io;
+    esp_panel_lcd_dcs_window_invalidate(&gc9a01->window);
 
     // perform hardware reset
     if (gc9a01->reset_gpio_num >= 0) {
@@ -229,6 +233,7 @@ static esp_err_t panel_gc9a01_init(esp_lcd_panel_t *panel)
 {
     gc9a01_panel_t *gc9a01 = __containerof(panel, gc9a01_panel_t, base);
     esp_lcd_panel_io_handle_t io = gc9a01->io;
+    esp_panel_lcd_dcs_window_invalidate(&gc9a01->window);
 
     // LCD goes into sleep mode and display will be turned off after power on reset, exit sleep mode first
     ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_SLPOUT, NULL, 0), TAG, "send command failed");
@@ -283,29 +288,15 @@ static esp_err_t panel_gc9a01_draw_bitmap(esp_lcd_panel_t *panel, int x_start, i
 {
     gc9a01_panel_t *gc9a01 = __containerof(panel, gc9a01_panel_t, base);
     assert((x_start < x_end) && (y_start < y_end) && "start position must be smaller than end position");
-    esp_lcd_panel_io_handle_t io = gc9a01->io;
 
     x_start += gc9a01->x_gap;
     x_end += gc9a01->x_gap;
     y_start += gc9a01->y_gap;
     y_end += gc9a01->y_gap;
 
-    // define an area of frame memory where MCU can access
-    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_CASET, (uint8_t[]) {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_RASET, (uint8_t[]) {
-        (y_start >> 8) & 0xFF,
-        y_start & 0xFF,
-        ((y_end - 1) >> 8) & 0xFF,
-        (y_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    // transfer frame buffer
+    // define an area of frame memory where MCU can access (only if changed) and transfer frame buffer
     size_t len = (x_end - x_start) * (y_end - y_start) * gc9a01->fb_bits_per_pixel / 8;
-    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_color(io, LCD_CMD_RAMWR, color_data, len), TAG, "send color failed");
+    ESP_RETURN_ON_ERROR(esp_panel_lcd_dcs_window_draw(&gc9a01->window, x_start, y_start, x_end, y_end, color_data, len), TAG, "send color failed");
 
     return ESP_OK;
 }
@@ -328,6 +319,7 @@ static esp_err_t panel_gc9a01_mirror(esp_lcd_panel_t *panel, bool mirror_x, bool
 {
     gc9a01_panel_t *gc9a01 = __containerof(panel, gc9a01_panel_t, base);
     esp_lcd_panel_io_handle_t io = gc9a01->io;
+    esp_panel_lcd_dcs_window_invalidate(&gc9a01->window);
     if (mirror_x) {
         gc9a01->madctl_val |= LCD_CMD_MX_BIT;
     } else {
@@ -348,6 +340,7 @@ static esp_err_t panel_gc9a01_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
 {
     gc9a01_panel_t *gc9a01 = __containerof(panel, gc9a01_panel_t, base);
     esp_lcd_panel_io_handle_t io = gc9a01->io;
+    esp_panel_lcd_dcs_window_invalidate(&gc9a01->window);
     if (swap_axes) {
         gc9a01->madctl_val |= LCD_CMD_MV_BIT;
     } else {
@@ -26,6 +26,7 @@
 #include "utils/esp_panel_utils_log.h"
 #include "esp_utils_helpers.h"
 #include "esp_panel_lcd_vendor_types.h"
+#include "esp_panel_lcd_dcs_window.h"
 
 #define LCD_OPCODE_WRITE_CMD        (0x02ULL)
 #define LCD_OPCODE_READ_CMD         (0x03ULL)
@@ -42,10 +43,13 @@ static esp_err_t panel_gc9b71_mirror(esp_lcd_panel_t *panel, bool mirror_x, bool
 static esp_err_t panel_gc9b71_swap_xy(esp_lcd_panel_t *panel, bool swap_axes);
 static esp_err_t panel_gc9b71_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_gap);
 static esp_err_t panel_gc9b71_disp_on_off(esp_lcd_panel_t *panel, bool off);
+static esp_err_t window_tx_param(void *user_ctx, int lcd_cmd, const void *param, size_t param_size);
+static esp_err_t window_tx_color(void *user_ctx, int lcd_cmd, const void *param, size_t param_size);
 
 typedef struct {
     esp_lcd_panel_t base;
     esp_lcd_panel_io_handle_t io;
+    esp_panel_lcd_dcs_window_t window; // save the last address window to skip the redundant commands
     int reset_gpio_num;
     int x_gap;
     int y_gap;
@@ -111,6 +115,7 @@ esp_err_t esp_lcd_new_panel_gc9b71(const esp_lcd_panel_io_handle_t io, const esp
     }
 
     gc9b71->io = io;
+    esp_panel_lcd_dcs_window_init(&gc9b71->window, window_tx_param, window_tx_color, gc9b71, true);
     gc9b71->reset_gpio_num = panel_dev_config->reset_gpio_num;
     gc9b71->fb_bits_per_pixel = fb_bits_per_pixel;
     esp_panel_lcd_vendor_config_t *vendor_config = (esp_panel_lcd_vendor_config_t *)panel_dev_config->vendor_config;
@@ -168,6 +173,18 @@ static esp_err_t tx_color(gc9b71_panel_t *gc9b71, esp_lcd_panel_io_handle_t io,
     return esp_lcd_panel_io_tx_color(io, lcd_cmd, param, param_size);
 }
 
+static esp_err_t window_tx_param(void *user_ctx, int lcd_cmd, const void *param, size_t param_size)
+{
+    gc9b71_panel_t *gc9b71 = (gc9b71_panel_t *)user_ctx;
+    return tx_param(gc9b71, gc9b71->io, lcd_cmd, param, param_size);
+}
+
+static esp_err_t window_tx_color(void *user_ctx, int lcd_cmd, const void *param, size_t param_size)
+{
+    gc9b71_panel_t *gc9b71 = (gc9b71_panel_t *)user_ctx;
+    return tx_color(gc9b71, gc9b71->io, lcd_cmd, param, param_size);
+}
+
 static esp_err_t panel_gc9b71_del(esp_lcd_panel_t *panel)
 {
     gc9b71_panel_t *gc9b71 = __containerof(panel, gc9b71_panel_t, base);
@@ -184,6 +201,7 @@ static esp_err_t panel_gc9b71_reset(esp_lcd_panel_t *panel)
 {
     gc9b71_panel_t *gc9b71 = __containerof(panel, gc9b71_panel_t, base);
     esp_lcd_panel_io_handle_t io = gc9b71->io;
+    esp_panel_lcd_dcs_window_invalidate(&gc9b71->window);
 
     // Perform hardware reset
     if (gc9b71->reset_gpio_num >= 0) {
@@ -262,6 +280,7 @@ static esp_err_t panel_gc9b71_init(esp_lcd_panel_t *panel)
 {
     gc9b71_panel_t *gc9b71 = __containerof(panel, gc9b71_panel_t, base);
     esp_lcd_panel_io_handle_t io = gc9b71->io;
+    esp_panel_lcd_dcs_window_invalidate(&gc9b71->window);
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds = NULL;
     uint16_t init_cmds_size = 0;
     bool is_cmd_overwritten = false;
@@ -316,29 +335,15 @@ static esp_err_t panel_gc9b71_draw_bitmap(esp_lcd_panel_t *panel, int x_start, i
 {
     gc9b71_panel_t *gc9b71 = __containerof(panel, gc9b71_panel_t, base);
     assert((x_start < x_end) && (y_start < y_end) && "start position must be smaller than end position");
-    esp_lcd_panel_io_handle_t io = gc9b71->io;
 
     x_start += gc9b71->x_gap;
     x_end += gc9b71->x_gap;
     y_start += gc9b71->y_gap;
     y_end += gc9b71->y_gap;
 
-    // define an area of frame memory where MCU can access
-    ESP_RETURN_ON_ERROR(tx_param(gc9b71, io, LCD_CMD_CASET, (uint8_t[]) {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    ESP_RETURN_ON_ERROR(tx_param(gc9b71, io, LCD_CMD_RASET, (uint8_t[]) {
-        (y_start >> 8) & 0xFF,
-        y_start & 0xFF,
-        ((y_end - 1) >> 8) & 0xFF,
-        (y_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    // transfer frame buffer
+    // define an area of frame memory where MCU can access (only if changed) and transfer frame buffer
     size_t len = (x_end - x_start) * (y_end - y_start) * gc9b71->fb_bits_per_pixel / 8;
-    ESP_RETURN_ON_ERROR(tx_color(gc9b71, io, LCD_CMD_RAMWR, color_data, len), TAG, "send color failed");
+    ESP_RETURN_ON_ERROR(esp_panel_lcd_dcs_window_draw(&gc9b71->window, x_start, y_start, x_end, y_end, color_data, len), TAG, "send color failed");
 
     return ESP_OK;
 }
@@ -361,6 +366,7 @@ static esp_err_t panel_gc9b71_mirror(esp_lcd_panel_t *panel, bool mirror_x, bool
 {
     gc9b71_panel_t *gc9b71 = __containerof(panel, gc9b71_panel_t, base);
     esp_lcd_panel_io_handle_t io = gc9b71->io;
+    esp_panel_lcd_dcs_window_invalidate(&gc9b71->window);
     if (mirror_x) {
         gc9b71->madctl_val |= LCD_CMD_MX_BIT;
     } else {
@@ -381,6 +387,7 @@ static esp_err_t panel_gc9b71_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
 {
     gc9b71_panel_t *gc9b71 = __containerof(panel, gc9b71_panel_t, base);
     esp_lcd_panel_io_handle_t io = gc9b71->io;
+    esp_panel_lcd_dcs_window_invalidate(&gc9b71->window);
     if (swap_axes) {
         gc9b71->madctl_val |= LCD_CMD_MV_BIT;
     } else {
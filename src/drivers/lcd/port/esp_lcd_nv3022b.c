@@ -25,6 +25,7 @@
 #include "utils/esp_panel_utils_log.h"
 #include "esp_utils_helpers.h"
 #include "esp_panel_lcd_vendor_types.h"
+#include "esp_panel_lcd_dcs_window.h"
 
 static const char *TAG = "lcd_panel.nv3022b";
 
@@ -41,6 +42,7 @@ static esp_err_t panel_nv3022b_disp_on_off(esp_lcd_panel_t *panel, bool off);
 typedef struct {
     esp_lcd_panel_t base;
     esp_lcd_panel_io_handle_t io;
+    esp_panel_lcd_dcs_window_t window; // save the last address window to skip the redundant commands
     int reset_gpio_num;
     bool reset_level;
     int x_gap;
@@ -115,6 +117,7 @@ esp_err_t esp_lcd_new_panel_nv3022b(const esp_lcd_panel_io_handle_t io, const es
     }
 
     nv3022b->io = io;
+    esp_panel_lcd_dcs_window_init(&nv3022b->window, esp_panel_lcd_dcs_io_tx_param, esp_panel_lcd_dcs_io_tx_color, io, false);
     nv3022b->reset_gpio_num = panel_dev_config->reset_gpio_num;
     nv3022b->reset_level = panel_dev_config->flags.reset_active_high;
     if (panel_dev_config->vendor_config) {
@@ -165,6 +168,7 @@ static esp_err_t panel_nv3022b_reset(esp_lcd_panel_t *panel)
 {
     nv3022b_panel_t *nv3022b = __containerof(panel, nv3022b_panel_t, base);
     esp_lcd_panel_io_handle_t io = nv3022b->io;
+    esp_panel_lcd_dcs_window_invalidate(&nv3022b->window);
 
     // perform hardware reset
     if (nv3022b->reset_gpio_num >= 0) {
@@ -221,6 +225,7 @@ static esp_err_t panel_nv3022b_init(esp_lcd_panel_t *panel)
 {
     nv3022b_panel_t *nv3022b = __containerof(panel, nv3022b_panel_t, base);
     esp_lcd_panel_io_handle_t io = nv3022b->io;
+    esp_panel_lcd_dcs_window_invalidate(&nv3022b->window);
 
     // LCD goes into sleep mode and display will be turned off after power on reset, exit sleep mode first
     ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_SLPOUT, NULL, 0), TAG, "send command failed");
@@ -275,29 +280,15 @@ static esp_err_t panel_nv3022b_draw_bitmap(esp_lcd_panel_t *panel, int x_start,
 {
     nv3022b_panel_t *nv3022b = __containerof(panel, nv3022b_panel_t, base);
     assert((x_start < x_end) && (y_start < y_end) && "start position must be smaller than end position");
-    esp_lcd_panel_io_handle_t io = nv3022b->io;
 
     x_start += nv3022b->x_gap;
     x_end += nv3022b->x_gap;
     y_start += nv3022b->y_gap;
     y_end += nv3022b->y_gap;
 
-    // define an area of frame memory where MCU can access
-    esp_lcd_panel_io_tx_param(io, LCD_CMD_CASET, (uint8_t[]) {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
-    }, 4);
-    esp_lcd_panel_io_tx_param(io, LCD_CMD_RASET, (uint8_t[]) {
-        (y_start >> 8) & 0xFF,
-        y_start & 0xFF,
-        ((y_end - 1) >> 8) & 0xFF,
-        (y_end - 1) & 0xFF,
-    }, 4);
-    // transfer frame buffer
+    // define an area of frame memory where MCU can access (only if changed) and transfer frame buffer
     size_t len = (x_end - x_start) * (y_end - y_start) * nv3022b->fb_bits_per_pixel / 8;
-    esp_lcd_panel_io_tx_color(io, LCD_CMD_RAMWR, color_data, len);
+    ESP_RETURN_ON_ERROR(esp_panel_lcd_dcs_window_draw(&nv3022b->window, x_start, y_start, x_end, y_end, color_data, len), TAG, "send color failed");
 
     return ESP_OK;
 }
@@ -320,6 +311,7 @@ static esp_err_t panel_nv3022b_mirror(esp_lcd_panel_t *panel, bool mirror_x, boo
 {
     nv3022b_panel_t *nv3022b = __containerof(panel, nv3022b_panel_t, base);
     esp_lcd_panel_io_handle_t io = nv3022b->io;
+    esp_panel_lcd_dcs_window_invalidate(&nv3022b->window);
     if (mirror_x) {
         nv3022b->madctl_val |= LCD_CMD_MX_BIT;
     } else {
@@ -340,6 +332,7 @@ static esp_err_t panel_nv3022b_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
 {
     nv3022b_panel_t *nv3022b = __containerof(panel, nv3022b_panel_t, base);
     esp_lcd_panel_io_handle_t io = nv3022b->io;
+    esp_panel_lcd_dcs_window_invalidate(&nv3022b->window);
     if (swap_axes) {
         nv3022b->madctl_val |= LCD_CMD_MV_BIT;
     } else {
@@ -26,6 +26,7 @@
 #include "utils/esp_panel_utils_log.h"
 #include "esp_utils_helpers.h"
 #include "esp_panel_lcd_vendor_types.h"
+#include "esp_panel_lcd_dcs_window.h"
 
 #define LCD_OPCODE_WRITE_CMD        (0x02ULL)
 #define LCD_OPCODE_READ_CMD         (0x03ULL)
@@ -42,10 +43,13 @@ static esp_err_t panel_sh8601_mirror(esp_lcd_panel_t *panel, bool mirror_x, bool
 static esp_err_t panel_sh8601_swap_xy(esp_lcd_panel_t *panel, bool swap_axes);
 static esp_err_t panel_sh8601_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_gap);
 static esp_err_t panel_sh8601_disp_on_off(esp_lcd_panel_t *panel, bool off);
+static esp_err_t window_tx_param(void *user_ctx, int lcd_cmd, const void *param, size_t param_size);
+static esp_err_t window_tx_color(void *user_ctx, int lcd_cmd, const void *param, size_t param_size);
 
 typedef struct {
     esp_lcd_panel_t base;
     esp_lcd_panel_io_handle_t io;
+    esp_panel_lcd_dcs_window_t window; // save the last address window to skip the redundant commands
     int reset_gpio_num;
     int x_gap;
     int y_gap;
@@ -112,6 +116,7 @@ esp_err_t esp_lcd_new_panel_sh8601(const esp_lcd_panel_io_handle_t io, const esp
     }
 
     sh8601->io = io;
+    esp_panel_lcd_dcs_window_init(&sh8601->window, window_tx_param, window_tx_color, sh8601, true);
     sh8601->reset_gpio_num = panel_dev_config->reset_gpio_num;
     sh8601->fb_bits_per_pixel = fb_bits_per_pixel;
     esp_panel_lcd_vendor_config_t *vendor_config = (esp_panel_lcd_vendor_config_t *)panel_dev_config->vendor_config;
@@ -165,6 +170,18 @@ static esp_err_t tx_color(sh8601_panel_t *sh8601, esp_lcd_panel_io_handle_t io,
     return esp_lcd_panel_io_tx_color(io, lcd_cmd, param, param_size);
 }
 
+static esp_err_t window_tx_param(void *user_ctx, int lcd_cmd, const void *param, size_t param_size)
+{
+    sh8601_panel_t *sh8601 = (sh8601_panel_t *)user_ctx;
+    return tx_param(sh8601, sh8601->io, lcd_cmd, param, param_size);
+}
+
+static esp_err_t window_tx_color(void *user_ctx, int lcd_cmd, const void *param, size_t param_size)
+{
+    sh8601_panel_t *sh8601 = (sh8601_panel_t *)user_ctx;
+    return tx_color(sh8601, sh8601->io, lcd_cmd, param, param_size);
+}
+
 static esp_err_t panel_sh8601_del(esp_lcd_panel_t *panel)
 {
     sh8601_panel_t *sh8601 = __containerof(panel, sh8601_panel_t, base);
@@ -181,6 +198,7 @@ static esp_err_t panel_sh8601_reset(esp_lcd_panel_t *panel)
 {
     sh8601_panel_t *sh8601 = __containerof(panel, sh8601_panel_t, base);
     esp_lcd_panel_io_handle_t io = sh8601->io;
+    esp_panel_lcd_dcs_window_invalidate(&sh8601->window);
 
     // Perform hardware reset
     if (sh8601->reset_gpio_num >= 0) {
@@ -207,6 +225,7 @@ static esp_err_t panel_sh8601_init(esp_lcd_panel_t *panel)
 {
     sh8601_panel_t *sh8601 = __containerof(panel, sh8601_panel_t, base);
     esp_lcd_panel_io_handle_t io = sh8601->io;
+    esp_panel_lcd_dcs_window_invalidate(&sh8601->window);
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds = NULL;
     uint16_t init_cmds_size = 0;
     bool is_cmd_overwritten = false;
@@ -261,29 +280,15 @@ static esp_err_t panel_sh8601_draw_bitmap(esp_lcd_panel_t *panel, int x_start, i
 {
     sh8601_panel_t *sh8601 = __containerof(panel, sh8601_panel_t, base);
     assert((x_start < x_end) && (y_start < y_end) && "start position must be smaller than end position");
-    esp_lcd_panel_io_handle_t io = sh8601->io;
 
     x_start += sh8601->x_gap;
     x_end += sh8601->x_gap;
     y_start += sh8601->y_gap;
     y_end += sh8601->y_gap;
 
-    // define an area of frame memory where MCU can access
-    ESP_RETURN_ON_ERROR(tx_param(sh8601, io, LCD_CMD_CASET, (uint8_t[]) {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    ESP_RETURN_ON_ERROR(tx_param(sh8601, io, LCD_CMD_RASET, (uint8_t[]) {
-        (y_start >> 8) & 0xFF,
-        y_start & 0xFF,
-        ((y_end - 1) >> 8) & 0xFF,
-        (y_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    // transfer frame buffer
+    // define an area of frame memory where MCU can access (only if changed) and transfer frame buffer
     size_t len = (x_end - x_start) * (y_end - y_start) * sh8601->fb_bits_per_pixel / 8;
-    tx_color(sh8601, io, LCD_CMD_RAMWR, color_data, len);
+    ESP_RETURN_ON_ERROR(esp_panel_lcd_dcs_window_draw(&sh8601->window, x_start, y_start, x_end, y_end, color_data, len), TAG, "send color failed");
 
     return ESP_OK;
 }
@@ -306,6 +311,7 @@ static esp_err_t panel_sh8601_mirror(esp_lcd_panel_t *panel, bool mirror_x, bool
 {
     sh8601_panel_t *sh8601 = __containerof(panel, sh8601_panel_t, base);
     esp_lcd_panel_io_handle_t io = sh8601->io;
+    esp_panel_lcd_dcs_window_invalidate(&sh8601->window);
     esp_err_t ret = ESP_OK;
 
     if (mirror_x) {
@@ -26,6 +26,7 @@
 #include "utils/esp_panel_utils_log.h"
 #include "esp_utils_helpers.h"
 #include "esp_panel_lcd_vendor_types.h"
+#include "esp_panel_lcd_dcs_window.h"
 
 #define LCD_OPCODE_WRITE_CMD        (0x02ULL)
 #define LCD_OPCODE_READ_CMD         (0x0BULL)
@@ -47,10 +48,13 @@ static esp_err_t panel_spd2010_mirror(esp_lcd_panel_t *panel, bool mirror_x, boo
 static esp_err_t panel_spd2010_swap_xy(esp_lcd_panel_t *panel, bool swap_axes);
 static esp_err_t panel_spd2010_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_gap);
 static esp_err_t panel_spd2010_disp_on_off(esp_lcd_panel_t *panel, bool off);
+static esp_err_t window_tx_param(void *user_ctx, int lcd_cmd, const void *param, size_t param_size);
+static esp_err_t window_tx_color(void *user_ctx, int lcd_cmd, const void *param, size_t param_size);
 
 typedef struct {
     esp_lcd_panel_t base;
     esp_lcd_panel_io_handle_t io;
+    esp_panel_lcd_dcs_window_t window; // save the last address window to skip the redundant commands
     int reset_gpio_num;
     int x_gap;
     int y_gap;
@@ -116,6 +120,7 @@ esp_err_t esp_lcd_new_panel_spd2010(const esp_lcd_panel_io_handle_t io, const es
     }
 
     spd2010->io = io;
+    esp_panel_lcd_dcs_window_init(&spd2010->window, window_tx_param, window_tx_color, spd2010, false);
     spd2010->reset_gpio_num = panel_dev_config->reset_gpio_num;
     spd2010->fb_bits_per_pixel = fb_bits_per_pixel;
     esp_panel_lcd_vendor_config_t *vendor_config = (esp_panel_lcd_vendor_config_t *)panel_dev_config->vendor_config;
@@ -169,6 +174,18 @@ static esp_err_t tx_color(spd2010_panel_t *spd2010, esp_lcd_panel_io_handle_t io
     return esp_lcd_panel_io_tx_color(io, lcd_cmd, param, param_size);
 }
 
+static esp_err_t window_tx_param(void *user_ctx, int lcd_cmd, const void *param, size_t param_size)
+{
+    spd2010_panel_t *spd2010 = (spd2010_panel_t *)user_ctx;
+    return tx_param(spd2010, spd2010->io, lcd_cmd, param, param_size);
+}
+
+static esp_err_t window_tx_color(void *user_ctx, int lcd_cmd, const void *param, size_t param_size)
+{
+    spd2010_panel_t *spd2010 = (spd2010_panel_t *)user_ctx;
+    return tx_color(spd2010, spd2010->io, lcd_cmd, param, param_size);
+}
+
 static esp_err_t panel_spd2010_del(esp_lcd_panel_t *panel)
 {
     spd2010_panel_t *spd2010 = __containerof(panel, spd2010_panel_t, base);
@@ -185,6 +202,7 @@ static esp_err_t panel_spd2010_reset(esp_lcd_panel_t *panel)
 {
     spd2010_panel_t *spd2010 = __containerof(panel, spd2010_panel_t, base);
     esp_lcd_panel_io_handle_t io = spd2010->io;
+    esp_panel_lcd_dcs_window_invalidate(&spd2010->window);
 
     // Perform hardware reset
     if (spd2010->reset_gpio_num >= 0) {
@@ -610,6 +628,7 @@ static esp_err_t panel_spd2010_init(esp_lcd_panel_t *panel)
 {
     spd2010_panel_t *spd2010 = __containerof(panel, spd2010_panel_t, base);
     esp_lcd_panel_io_handle_t io = spd2010->io;
+    esp_panel_lcd_dcs_window_invalidate(&spd2010->window);
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds = NULL;
     uint16_t init_cmds_size = 0;
     bool is_user_set = true;
@@ -678,29 +697,15 @@ static esp_err_t panel_spd2010_draw_bitmap(esp_lcd_panel_t *panel, int x_start,
 {
     spd2010_panel_t *spd2010 = __containerof(panel, spd2010_panel_t, base);
     assert((x_start < x_end) && (y_start < y_end) && "start position must be smaller than end position");
-    esp_lcd_panel_io_handle_t io = spd2010->io;
 
     x_start += spd2010->x_gap;
     x_end += spd2010->x_gap;
     y_start += spd2010->y_gap;
     y_end += spd2010->y_gap;
 
-    // define an area of frame memory where MCU can access
-    ESP_RETURN_ON_ERROR(tx_param(spd2010, io, LCD_CMD_CASET, (uint8_t[]) {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    ESP_RETURN_ON_ERROR(tx_param(spd2010, io, LCD_CMD_RASET, (uint8_t[]) {
-        (y_start >> 8) & 0xFF,
-        y_start & 0xFF,
-        ((y_end - 1) >> 8) & 0xFF,
-        (y_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    // transfer frame buffer
+    // define an area of frame memory where MCU can access (only if changed) and transfer frame buffer
     size_t len = (x_end - x_start) * (y_end - y_start) * spd2010->fb_bits_per_pixel / 8;
-    ESP_RETURN_ON_ERROR(tx_color(spd2010, io, LCD_CMD_RAMWR, color_data, len), TAG, "send color failed");
+    ESP_RETURN_ON_ERROR(esp_panel_lcd_dcs_window_draw(&spd2010->window, x_start, y_start, x_end, y_end, color_data, len), TAG, "send color failed");
 
     return ESP_OK;
 }
@@ -723,6 +728,7 @@ static esp_err_t panel_spd2010_mirror(esp_lcd_panel_t *panel, bool mirror_x, boo
 {
     spd2010_panel_t *spd2010 = __containerof(panel, spd2010_panel_t, base);
     esp_lcd_panel_io_handle_t io = spd2010->io;
+    esp_panel_lcd_dcs_window_invalidate(&spd2010->window);
     if (mirror_x) {
         spd2010->madctl_val |= BIT(1);
     } else {
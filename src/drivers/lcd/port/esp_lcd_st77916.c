@@ -26,6 +26,7 @@
 #include "utils/esp_panel_utils_log.h"
 #include "esp_utils_helpers.h"
 #include "esp_panel_lcd_vendor_types.h"
+#include "esp_panel_lcd_dcs_window.h"
 
 #define LCD_OPCODE_WRITE_CMD        (0x02ULL)
 #define LCD_OPCODE_READ_CMD         (0x0BULL)
@@ -45,10 +46,13 @@ static esp_err_t panel_st77916_mirror(esp_lcd_panel_t *panel, bool mirror_x, boo
 static esp_err_t panel_st77916_swap_xy(esp_lcd_panel_t *panel, bool swap_axes);
 static esp_err_t panel_st77916_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_gap);
 static esp_err_t panel_st77916_disp_on_off(esp_lcd_panel_t *panel, bool off);
+static esp_err_t window_tx_param(void *user_ctx, int lcd_cmd, const void *param, size_t param_size);
+static esp_err_t window_tx_color(void *user_ctx, int lcd_cmd, const void *param, size_t param_size);
 
 typedef struct {
     esp_lcd_panel_t base;
     esp_lcd_panel_io_handle_t io;
+    esp_panel_lcd_dcs_window_t window; // save the last address window to skip the redundant commands
     int reset_gpio_num;
     int x_gap;
     int y_gap;
@@ -109,6 +113,7 @@ esp_err_t esp_lcd_new_panel_st77916(const esp_lcd_panel_io_handle_t io, const es
     }
 
     st77916->io = io;
+    esp_panel_lcd_dcs_window_init(&st77916->window, window_tx_param, window_tx_color, st77916, true);
     st77916->reset_gpio_num = panel_dev_config->reset_gpio_num;
     st77916->flags.reset_level = panel_dev_config->flags.reset_active_high;
     esp_panel_lcd_vendor_config_t *vendor_config = (esp_panel_lcd_vendor_config_t *)panel_dev_config->vendor_config;
@@ -161,6 +166,18 @@ static esp_err_t tx_color(st77916_panel_t *st77916, esp_lcd_panel_io_handle_t io
     return esp_lcd_panel_io_tx_color(io, lcd_cmd, param, param_size);
 }
 
+static esp_err_t window_tx_param(void *user_ctx, int lcd_cmd, const void *param, size_t param_size)
+{
+    st77916_panel_t *st77916 = (st77916_panel_t *)user_ctx;
+    return tx_param(st77916, st77916->io, lcd_cmd, param, param_size);
+}
+
+static esp_err_t window_tx_color(void *user_ctx, int lcd_cmd, const void *param, size_t param_size)
+{
+    st77916_panel_t *st77916 = (st77916_panel_t *)user_ctx;
+    return tx_color(st77916, st77916->io, lcd_cmd, param, param_size);
+}
+
 static esp_err_t panel_st77916_del(esp_lcd_panel_t *panel)
 {
     st77916_panel_t *st77916 = __containerof(panel, st77916_panel_t, base);
@@ -177,6 +194,7 @@ static esp_err_t panel_st77916_reset(esp_lcd_panel_t *panel)
 {
     st77916_panel_t *st77916 = __containerof(panel, st77916_panel_t, base);
     esp_lcd_panel_io_handle_t io = st77916->io;
+    esp_panel_lcd_dcs_window_invalidate(&st77916->window);
 
     // Perform hardware reset
     if (st77916->reset_gpio_num >= 0) {
@@ -415,6 +433,7 @@ static esp_err_t panel_st77916_init(esp_lcd_panel_t *panel)
 {
     st77916_panel_t *st77916 = __containerof(panel, st77916_panel_t, base);
     esp_lcd_panel_io_handle_t io = st77916->io;
+    esp_panel_lcd_dcs_window_invalidate(&st77916->window);
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds = NULL;
     uint16_t init_cmds_size = 0;
     bool is_user_set = true;
@@ -478,29 +497,15 @@ static esp_err_t panel_st77916_draw_bitmap(esp_lcd_panel_t *panel, int x_start,
 {
     st77916_panel_t *st77916 = __containerof(panel, st77916_panel_t, base);
     assert((x_start < x_end) && (y_start < y_end) && "start position must be smaller than end position");
-    esp_lcd_panel_io_handle_t io = st77916->io;
 
     x_start += st77916->x_gap;
     x_end += st77916->x_gap;
     y_start += st77916->y_gap;
     y_end += st77916->y_gap;
 
-    // define an area of frame memory where MCU can access
-    ESP_RETURN_ON_ERROR(tx_param(st77916, io, LCD_CMD_CASET, (uint8_t[]) {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    ESP_RETURN_ON_ERROR(tx_param(st77916, io, LCD_CMD_RASET, (uint8_t[]) {
-        (y_start >> 8) & 0xFF,
-        y_start & 0xFF,
-        ((y_end - 1) >> 8) & 0xFF,
-        (y_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    // transfer frame buffer
+    // define an area of frame memory where MCU can access (only if changed) and transfer frame buffer
     size_t len = (x_end - x_start) * (y_end - y_start) * st77916->fb_bits_per_pixel / 8;
-    tx_color(st77916, io, LCD_CMD_RAMWR, color_data, len);
+    ESP_RETURN_ON_ERROR(esp_panel_lcd_dcs_window_draw(&st77916->window, x_start, y_start, x_end, y_end, color_data, len), TAG, "send color failed");
 
     return ESP_OK;
 }
@@ -523,6 +528,7 @@ static esp_err_t panel_st77916_mirror(esp_lcd_panel_t *panel, bool mirror_x, boo
 {
     st77916_panel_t *st77916 = __containerof(panel, st77916_panel_t, base);
     esp_lcd_panel_io_handle_t io = st77916->io;
+    esp_panel_lcd_dcs_window_invalidate(&st77916->window);
     esp_err_t ret = ESP_OK;
 
     if (mirror_x) {
@@ -545,6 +551,7 @@ static esp_err_t panel_st77916_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
 {
     st77916_panel_t *st77916 = __containerof(panel, st77916_panel_t, base);
     esp_lcd_panel_io_handle_t io = st77916->io;
+    esp_panel_lcd_dcs_window_invalidate(&st77916->window);
     if (swap_axes) {
         st77916->madctl_val |= LCD_CMD_MV_BIT;
     } else {
@@ -26,6 +26,7 @@
 #include "utils/esp_panel_utils_log.h"
 #include "esp_utils_helpers.h"
 #include "esp_panel_lcd_vendor_types.h"
+#include "esp_panel_lcd_dcs_window.h"
 
 static const char *TAG = "st77922_general";
 
@@ -38,10 +39,13 @@ static esp_err_t panel_st77922_mirror(esp_lcd_panel_t *panel, bool mirror_x, boo
 static esp_err_t panel_st77922_swap_xy(esp_lcd_panel_t *panel, bool swap_axes);
 static esp_err_t panel_st77922_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_gap);
 static esp_err_t panel_st77922_disp_on_off(esp_lcd_panel_t *panel, bool off);
+static esp_err_t window_tx_param(void *user_ctx, int lcd_cmd, const void *param, size_t param_size);
+static esp_err_t window_tx_color(void *user_ctx, int lcd_cmd, const void *param, size_t param_size);
 
 typedef struct {
     esp_lcd_panel_t base;
     esp_lcd_panel_io_handle_t io;
+    esp_panel_lcd_dcs_window_t window; // save the last address window to skip the redundant commands
     int reset_gpio_num;
     int x_gap;
     int y_gap;
@@ -105,6 +109,7 @@ esp_err_t esp_lcd_new_panel_st77922_general(const esp_lcd_panel_io_handle_t io,
     }
 
     st77922->io = io;
+    esp_panel_lcd_dcs_window_init(&st77922->window, window_tx_param, window_tx_color, st77922, true);
     st77922->reset_gpio_num = panel_dev_config->reset_gpio_num;
     st77922->flags.reset_level = panel_dev_config->flags.reset_active_high;
     esp_panel_lcd_vendor_config_t *vendor_config = (esp_panel_lcd_vendor_config_t *)panel_dev_config->vendor_config;
@@ -157,6 +162,18 @@ static esp_err_t tx_color(st77922_panel_t *st77922, esp_lcd_panel_io_handle_t io
     return esp_lcd_panel_io_tx_color(io, lcd_cmd, param, param_size);
 }
 
+static esp_err_t window_tx_param(void *user_ctx, int lcd_cmd, const void *param, size_t param_size)
+{
+    st77922_panel_t *st77922 = (st77922_panel_t *)user_ctx;
+    return tx_param(st77922, st77922->io, lcd_cmd, param, param_size);
+}
+
+static esp_err_t window_tx_color(void *user_ctx, int lcd_cmd, const void *param, size_t param_size)
+{
+    st77922_panel_t *st77922 = (st77922_panel_t *)user_ctx;
+    return tx_color(st77922, st77922->io, lcd_cmd, param, param_size);
+}
+
 static esp_err_t panel_st77922_del(esp_lcd_panel_t *panel)
 {
     st77922_panel_t *st77922 = __containerof(panel, st77922_panel_t, base);
@@ -173,6 +190,7 @@ static esp_err_t panel_st77922_reset(esp_lcd_panel_t *panel)
 {
     st77922_panel_t *st77922 = __containerof(panel, st77922_panel_t, base);
     esp_lcd_panel_io_handle_t io = st77922->io;
+    esp_panel_lcd_dcs_window_invalidate(&st77922->window);
 
     // Perform hardware reset
     if (st77922->reset_gpio_num >= 0) {
@@ -258,6 +276,7 @@ static esp_err_t panel_st77922_init(esp_lcd_panel_t *panel)
 {
     st77922_panel_t *st77922 = __containerof(panel, st77922_panel_t, base);
     esp_lcd_panel_io_handle_t io = st77922->io;
+    esp_panel_lcd_dcs_window_invalidate(&st77922->window);
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds = NULL;
     uint16_t init_cmds_size = 0;
     bool is_command1_enable = true;
@@ -323,29 +342,15 @@ static esp_err_t panel_st77922_draw_bitmap(esp_lcd_panel_t *panel, int x_start,
 {
     st77922_panel_t *st77922 = __containerof(panel, st77922_panel_t, base);
     assert((x_start < x_end) && (y_start < y_end) && "start position must be smaller than end position");
-    esp_lcd_panel_io_handle_t io = st77922->io;
 
     x_start += st77922->x_gap;
     x_end += st77922->x_gap;
     y_start += st77922->y_gap;
     y_end += st77922->y_gap;
 
-    // define an area of frame memory where MCU can access
-    ESP_RETURN_ON_ERROR(tx_param(st77922, io, LCD_CMD_CASET, (uint8_t[]) {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    ESP_RETURN_ON_ERROR(tx_param(st77922, io, LCD_CMD_RASET, (uint8_t[]) {
-        (y_start >> 8) & 0xFF,
-        y_start & 0xFF,
-        ((y_end - 1) >> 8) & 0xFF,
-        (y_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    // transfer frame buffer
+    // define an area of frame memory where MCU can access (only if changed) and transfer frame buffer
     size_t len = (x_end - x_start) * (y_end - y_start) * st77922->fb_bits_per_pixel / 8;
-    tx_color(st77922, io, LCD_CMD_RAMWR, color_data, len);
+    ESP_RETURN_ON_ERROR(esp_panel_lcd_dcs_window_draw(&st77922->window, x_start, y_start, x_end, y_end, color_data, len), TAG, "send color failed");
 
     return ESP_OK;
 }
@@ -368,6 +373,7 @@ static esp_err_t panel_st77922_mirror(esp_lcd_panel_t *panel, bool mirror_x, boo
 {
     st77922_panel_t *st77922 = __containerof(panel, st77922_panel_t, base);
     esp_lcd_panel_io_handle_t io = st77922->io;
+    esp_panel_lcd_dcs_window_invalidate(&st77922->window);
     esp_err_t ret = ESP_OK;
 
     if (mirror_x) {
@@ -26,6 +26,7 @@
 #include "utils/esp_panel_utils_log.h"
 #include "esp_utils_helpers.h"
 #include "esp_panel_lcd_vendor_types.h"
+#include "esp_panel_lcd_dcs_window.h"
 
 static const char *TAG = "st7796_general";
 
@@ -42,6 +43,7 @@ static esp_err_t panel_st7796_disp_on_off(esp_lcd_panel_t *panel, bool off);
 typedef struct {
     esp_lcd_panel_t base;
     esp_lcd_panel_io_handle_t io;
+    esp_panel_lcd_dcs_window_t window; // save the last address window to skip the redundant commands
     int reset_gpio_num;
     bool reset_level;
     int x_gap;
@@ -115,6 +117,7 @@ esp_err_t esp_lcd_new_panel_st7796_general(const esp_lcd_panel_io_handle_t io, c
     }
 
     st7796->io = io;
+    esp_panel_lcd_dcs_window_init(&st7796->window, esp_panel_lcd_dcs_io_tx_param, esp_panel_lcd_dcs_io_tx_color, io, true);
     st7796->reset_gpio_num = panel_dev_config->reset_gpio_num;
     st7796->reset_level = panel_dev_config->flags.reset_active_high;
     if (panel_dev_config->vendor_config) {
@@ -165,6 +168,7 @@ static esp_err_t panel_st7796_reset(esp_lcd_panel_t *panel)
 {
     st7796_panel_t *st7796 = __containerof(panel, st7796_panel_t, base);
     esp_lcd_panel_io_handle_t io = st7796->io;
+    esp_panel_lcd_dcs_window_invalidate(&st7796->window);
 
     // perform hardware reset
     if (st7796->reset_gpio_num >= 0) {
@@ -200,6 +204,7 @@ static esp_err_t panel_st7796_init(esp_lcd_panel_t *panel)
 {
     st7796_panel_t *st7796 = __containerof(panel, st7796_panel_t, base);
     esp_lcd_panel_io_handle_t io = st7796->io;
+    esp_panel_lcd_dcs_window_invalidate(&st7796->window);
 
     // LCD goes into sleep mode and display will be turned off after power on reset, exit sleep mode first
     ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_SLPOUT, NULL, 0), TAG, "send command failed");
@@ -254,29 +259,15 @@ static esp_err_t panel_st7796_draw_bitmap(esp_lcd_panel_t *panel, int x_start, i
 {
     st7796_panel_t *st7796 = __containerof(panel, st7796_panel_t, base);
     assert((x_start < x_end) && (y_start < y_end) && "start position must be smaller than end position");
-    esp_lcd_panel_io_handle_t io = st7796->io;
 
     x_start += st7796->x_gap;
     x_end += st7796->x_gap;
     y_start += st7796->y_gap;
     y_end += st7796->y_gap;
 
-    // define an area of frame memory where MCU can access
-    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_CASET, (uint8_t[]) {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_RASET, (uint8_t[]) {
-        (y_start >> 8) & 0xFF,
-        y_start & 0xFF,
-        ((y_end - 1) >> 8) & 0xFF,
-        (y_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    // transfer frame buffer
+    // define an area of frame memory where MCU can access (only if changed) and transfer frame buffer
     size_t len = (x_end - x_start) * (y_end - y_start) * st7796->fb_bits_per_pixel / 8;
-    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_color(io, LCD_CMD_RAMWR, color_data, len), TAG, "send command failed");
+    ESP_RETURN_ON_ERROR(esp_panel_lcd_dcs_window_draw(&st7796->window, x_start, y_start, x_end, y_end, color_data, len), TAG, "send color failed");
 
     return ESP_OK;
 }
@@ -299,6 +290,7 @@ static esp_err_t panel_st7796_mirror(esp_lcd_panel_t *panel, bool mirror_x, bool
 {
     st7796_panel_t *st7796 = __containerof(panel, st7796_panel_t, base);
     esp_lcd_panel_io_handle_t io = st7796->io;
+    esp_panel_lcd_dcs_window_invalidate(&st7796->window);
     if (mirror_x) {
         st7796->madctl_val |= LCD_CMD_MX_BIT;
     } else {
@@ -319,6 +311,7 @@ static esp_err_t panel_st7796_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
 {
     st7796_panel_t *st7796 = __containerof(panel, st7796_panel_t, base);
     esp_lcd_panel_io_handle_t io = st7796->io;
+    esp_panel_lcd_dcs_window_invalidate(&st7796->window);
     if (swap_axes) {
         st7796->madctl_val |= LCD_CMD_MV_BIT;
     } else {
@@ -0,0 +1,112 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_panel_commands.h"
+
+#include "esp_panel_lcd_dcs_window.h"
+
+#ifndef LCD_CMD_RAMWRC
+#define LCD_CMD_RAMWRC  (0x3C)
+#endif
+
+void esp_panel_lcd_dcs_window_init(esp_panel_lcd_dcs_window_t *window, esp_panel_lcd_dcs_tx_cb_t tx_param,
+                                   esp_panel_lcd_dcs_tx_cb_t tx_color, void *user_ctx, bool use_ramwrc)
+{
+    *window = (esp_panel_lcd_dcs_window_t) {
+        .tx_param = tx_param,
+        .tx_color = tx_color,
+        .user_ctx = user_ctx,
+        .flags = {
+            .use_ramwrc = use_ramwrc,
+        },
+    };
+    esp_panel_lcd_dcs_window_invalidate(window);
+}
+
+void esp_panel_lcd_dcs_window_invalidate(esp_panel_lcd_dcs_window_t *window)
+{
+    window->flags.is_valid = 0;
+    window->y_next = -1;
+    window->y_limit = 0;
+}
+
+static esp_err_t tx_address(esp_panel_lcd_dcs_window_t *window, int lcd_cmd, int start, int end)
+{
+    return window->tx_param(window->user_ctx, lcd_cmd, (uint8_t[]) {
+        (start >> 8) & 0xFF,
+        start & 0xFF,
+        ((end - 1) >> 8) & 0xFF,
+        (end - 1) & 0xFF,
+    }, 4);
+}
+
+esp_err_t esp_panel_lcd_dcs_window_draw(esp_panel_lcd_dcs_window_t *window, int x_start, int y_start, int x_end,
+                                        int y_end, const void *color_data, size_t len)
+{
+    esp_err_t ret = ESP_OK;
+    bool is_valid = window->flags.is_valid;
+    bool is_same_columns = is_valid && (x_start == window->x_start) && (x_end == window->x_end);
+
+    // The strip continues right below the last one and fits in the row window, just go on writing
+    if (is_same_columns && (y_start == window->y_next) && (y_end <= window->y_end)) {
+        ret = window->tx_color(window->user_ctx, LCD_CMD_RAMWRC, color_data, len);
+        if (ret != ESP_OK) {
+            goto err;
+        }
+        window->y_next = (y_end < window->y_end) ? y_end : -1;
+
+        return ESP_OK;
+    }
+
+    window->flags.is_valid = 0;
+    if (!is_same_columns) {
+        ret = tx_address(window, LCD_CMD_CASET, x_start, x_end);
+        if (ret != ESP_OK) {
+            goto err;
+        }
+        window->x_start = x_start;
+        window->x_end = x_end;
+    }
+
+    // Extend the row window down to the lowest drawn row, so the strips below can be continued with `RAMWRC`
+    if (y_end > window->y_limit) {
+        window->y_limit = y_end;
+    }
+    int window_y_end = window->flags.use_ramwrc ? window->y_limit : y_end;
+    if (!is_valid || (y_start != window->y_start) || (window_y_end != window->y_end)) {
+        ret = tx_address(window, LCD_CMD_RASET, y_start, window_y_end);
+        if (ret != ESP_OK) {
+            goto err;
+        }
+        window->y_start = y_start;
+        window->y_end = window_y_end;
+    }
+
+    ret = window->tx_color(window->user_ctx, LCD_CMD_RAMWR, color_data, len);
+    if (ret != ESP_OK) {
+        goto err;
+    }
+    window->flags.is_valid = 1;
+    window->y_next = (window->flags.use_ramwrc && (y_end < window_y_end)) ? y_end : -1;
+
+    return ESP_OK;
+
+err:
+    esp_panel_lcd_dcs_window_invalidate(window);
+
+    return ret;
+}
+
+esp_err_t esp_panel_lcd_dcs_io_tx_param(void *user_ctx, int lcd_cmd, const void *data, size_t size)
+{
+    return esp_lcd_panel_io_tx_param((esp_lcd_panel_io_handle_t)user_ctx, lcd_cmd, data, size);
+}
+
+esp_err_t esp_panel_lcd_dcs_io_tx_color(void *user_ctx, int lcd_cmd, const void *data, size_t size)
+{
+    return esp_lcd_panel_io_tx_color((esp_lcd_panel_io_handle_t)user_ctx, lcd_cmd, data, size);
+}
@@ -0,0 +1,117 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Function to send a command (with parameters or color data) to the panel.
+ *
+ * @param[in] user_ctx User context, passed to `esp_panel_lcd_dcs_window_init()`
+ * @param[in] lcd_cmd DCS command, without any bus specific encoding
+ * @param[in] data Parameters or color data of the command
+ * @param[in] size Size of `data` in bytes
+ *
+ * @return
+ *      - ESP_OK: Success
+ *      - Otherwise: Fail
+ */
+typedef esp_err_t (*esp_panel_lcd_dcs_tx_cb_t)(void *user_ctx, int lcd_cmd, const void *data, size_t size);
+
+/**
+ * @brief Address window cache of the MIPI-DCS style panels (with internal GRAM).
+ *
+ * It remembers the column/row window set by the last draw, so `CASET`/`RASET` are only sent when they change. If
+ * `use_ramwrc` is set, a strip which starts right below the previous one (same columns) is sent with `RAMWRC` (write
+ * memory continue) only, the panel keeps writing from where the last write stopped. To make this possible, the
+ * row window is extended down to the lowest row ever drawn, which doesn't affect the normal `RAMWR` writes.
+ *
+ * @note  Call `esp_panel_lcd_dcs_window_invalidate()` whenever the panel's address state may change behind the cache,
+ *        such as after reset, initialization, mirror, swap_xy or any command sent directly.
+ *
+ */
+typedef struct {
+    esp_panel_lcd_dcs_tx_cb_t tx_param;     /*!< Function to send a command with parameters */
+    esp_panel_lcd_dcs_tx_cb_t tx_color;     /*!< Function to send a command with color data */
+    void *user_ctx;                         /*!< User context of the functions */
+    int x_start;                            /*!< Start column of the cached window */
+    int x_end;                              /*!< End column (exclusive) of the cached window */
+    int y_start;                            /*!< Start row of the cached window */
+    int y_end;                              /*!< End row (exclusive) of the cached window */
+    int y_next;                             /*!< Row where the next `RAMWRC` continues, `-1` if unknown */
+    int y_limit;                            /*!< End row (exclusive) of the lowest draw since invalidated */
+    struct {
+        uint32_t use_ramwrc: 1;             /*!< Use `RAMWRC` for vertically contiguous strips */
+        uint32_t is_valid: 1;               /*!< Whether the cached window matches the panel */
+    } flags;
+} esp_panel_lcd_dcs_window_t;
+
+/**
+ * @brief Initialize the window cache, it starts invalidated.
+ *
+ * @param[out] window Window cache
+ * @param[in] tx_param Function to send a command with parameters
+ * @param[in] tx_color Function to send a command with color data
+ * @param[in] user_ctx User context of the functions
+ * @param[in] use_ramwrc Whether to use `RAMWRC`, only enable it for the panels which support the command
+ *
+ */
+void esp_panel_lcd_dcs_window_init(esp_panel_lcd_dcs_window_t *window, esp_panel_lcd_dcs_tx_cb_t tx_param,
+                                   esp_panel_lcd_dcs_tx_cb_t tx_color, void *user_ctx, bool use_ramwrc);
+
+/**
+ * @brief Invalidate the window cache, the next draw sends `CASET`, `RASET` and `RAMWR`.
+ *
+ * @param[in] window Window cache
+ *
+ */
+void esp_panel_lcd_dcs_window_invalidate(esp_panel_lcd_dcs_window_t *window);
+
+/**
+ * @brief Draw a bitmap, only sending the address commands which are needed.
+ *
+ * @param[in] window Window cache
+ * @param[in] x_start Start column, the gap should be already added
+ * @param[in] y_start Start row, the gap should be already added
+ * @param[in] x_end End column (exclusive)
+ * @param[in] y_end End row (exclusive)
+ * @param[in] color_data Color data
+ * @param[in] len Size of `color_data` in bytes
+ *
+ * @return
+ *      - ESP_OK: Success, the cache is invalidated on any failure
+ *      - Otherwise: Fail
+ */
+esp_err_t esp_panel_lcd_dcs_window_draw(esp_panel_lcd_dcs_window_t *window, int x_start, int y_start, int x_end,
+                                        int y_end, const void *color_data, size_t len);
+
+/**
+ * @brief Send a command with parameters through `esp_lcd_panel_io_tx_param()`, the `user_ctx` is the IO handle.
+ *
+ * @note  It can be used as `tx_param` by the panels which don't encode the commands.
+ *
+ */
+esp_err_t esp_panel_lcd_dcs_io_tx_param(void *user_ctx, int lcd_cmd, const void *data, size_t size);
+
+/**
+ * @brief Send a command with color data through `esp_lcd_panel_io_tx_color()`, the `user_ctx` is the IO handle.
+ *
+ * @note  It can be used as `tx_color` by the panels which don't encode the commands.
+ *
+ */
+esp_err_t esp_panel_lcd_dcs_io_tx_color(void *user_ctx, int lcd_cmd, const void *data, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include "esp_timer.h"
+#include "freertos/task.h"
 #include "utils/esp_panel_utils_log.h"
 #include "esp_panel_touch.hpp"
 
@@ -13,7 +15,7 @@ constexpr int THREAD_CHECK_STOP_INTERVAL_MS = 100;
 
 void TouchPoint::print() const
 {
-    ESP_UTILS_LOGI("x(%d), y(%d), strength(%d)", x, y, strength);
+    ESP_UTILS_LOGI("x(%d), y(%d), strength(%d), id(%d)", x, y, strength, id);
 }
 
 void Touch::BasicAttributes::print() const
@@ -148,6 +150,70 @@ void Touch::configInterruptActiveLevel(int level)
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 }
 
+bool Touch::configFrameRingSize(size_t size)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+
+    ESP_UTILS_LOGD("Param: size(%d)", static_cast<int>(size));
+    _frame_ring_size = size;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool Touch::configFilter(const TouchFilter::Config &config)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+
+    ESP_UTILS_LOGD(
+        "Param: median_size(%d), iir_weight_percent(%d), one_euro_min_cutoff_mhz(%d), one_euro_beta_micro(%d), "
+        "one_euro_d_cutoff_mhz(%d), dead_zone(%d)", config.median_size, config.iir_weight_percent,
+        static_cast<int>(config.one_euro_min_cutoff_mhz), static_cast<int>(config.one_euro_beta_micro),
+        static_cast<int>(config.one_euro_d_cutoff_mhz), config.dead_zone
+    );
+    ESP_UTILS_CHECK_FALSE_RETURN(_filter.configure(config), false, "Invalid filter config");
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool Touch::configTracker(const TouchTracker::Config &config)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+
+    ESP_UTILS_LOGD("Param: distance_max(%d)", config.distance_max);
+    ESP_UTILS_CHECK_FALSE_RETURN(_tracker.configure(config), false, "Invalid tracker config");
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool Touch::configPredictor(const TouchPredictor::Config &config)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+
+    ESP_UTILS_LOGD(
+        "Param: horizon_ms(%d), smoothing_percent(%d), acceleration_percent(%d), distance_max(%d)", config.horizon_ms,
+        config.smoothing_percent, config.acceleration_percent, config.distance_max
+    );
+    ESP_UTILS_CHECK_FALSE_RETURN(_predictor.configure(config), false, "Invalid predictor config");
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
 bool Touch::init()
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
@@ -188,6 +254,17 @@ bool Touch::init()
         ESP_UTILS_LOGD("Disable interruption");
     }
 
+    if (_frame_ring_size > 0) {
+        ESP_UTILS_LOGD("Enable frame ring buffer");
+
+        std::shared_ptr<TouchFrameRing> frame_ring = nullptr;
+        ESP_UTILS_CHECK_EXCEPTION_RETURN(
+            frame_ring = utils::make_shared<TouchFrameRing>(_frame_ring_size), false, "Create frame ring failed"
+        );
+        ESP_UTILS_CHECK_FALSE_RETURN(frame_ring->isValid(), false, "Allocate frame ring buffer failed");
+        _frame_ring = frame_ring;
+    }
+
     setState(State::INIT);
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
@@ -199,6 +276,9 @@ bool Touch::del()
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
 
+    // The task reads the panel, stop it first
+    ESP_UTILS_CHECK_FALSE_RETURN(stopSampling(), false, "Stop sampling failed");
+
     if (touch_panel != nullptr) {
         ESP_UTILS_CHECK_ERROR_RETURN(
             esp_lcd_touch_del(touch_panel), false, "Delete touch panel(@%p) failed", touch_panel
@@ -208,9 +288,13 @@ bool Touch::del()
     }
 
     _transformation = {};
-    _points.clear();
-    _buttons.clear();
+    resetPoints();
+    resetButtons();
+    _filter.reset();
+    _tracker.reset();
+    _predictor.reset();
     _interruption = nullptr;
+    _frame_ring = nullptr;
 
     setState(State::DEINIT);
 
@@ -235,6 +319,84 @@ bool Touch::attachInterruptCallback(FunctionInterruptCallback callback, void *us
     return true;
 }
 
+bool Touch::startSampling(const TouchSampler::Config &config)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
+    ESP_UTILS_CHECK_FALSE_RETURN(_sampling == nullptr, false, "Already sampling");
+
+    ESP_UTILS_LOGD(
+        "Param: burst_period_ms(%d), idle_period_ms(%d), use_interrupt(%d), task_priority(%d), task_stack_size(%d), "
+        "task_core_id(%d)", config.burst_period_ms, config.idle_period_ms, config.use_interrupt, config.task_priority,
+        config.task_stack_size, config.task_core_id
+    );
+
+    std::shared_ptr<Sampling> sampling = nullptr;
+    ESP_UTILS_CHECK_EXCEPTION_RETURN(
+        sampling = utils::make_shared<Sampling>(), false, "Create sampling failed"
+    );
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        sampling->sampler.configure(config, isInterruptEnabled()), false, "Invalid sampling config"
+    );
+    sampling->sampler.reset(esp_timer_get_time());
+    sampling->stopped_sem = xSemaphoreCreateBinaryStatic(&sampling->stopped_sem_buffer);
+
+    // The task gets the sampling from `_sampling`, set it before the task starts
+    {
+        std::lock_guard lock(_resource_mutex);
+        _sampling = sampling;
+    }
+    BaseType_t ret = pdFAIL;
+    if (config.task_core_id < 0) {
+        ret = xTaskCreate(
+                  samplingTask, "touch_sampling", config.task_stack_size, this, config.task_priority, nullptr
+              );
+    } else {
+        ret = xTaskCreatePinnedToCore(
+                  samplingTask, "touch_sampling", config.task_stack_size, this, config.task_priority, nullptr,
+                  config.task_core_id
+              );
+    }
+    if (ret != pdPASS) {
+        std::lock_guard lock(_resource_mutex);
+        _sampling = nullptr;
+        ESP_UTILS_CHECK_FALSE_RETURN(false, false, "Create sampling task failed");
+    }
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool Touch::stopSampling()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    std::shared_ptr<Sampling> sampling = nullptr;
+    {
+        std::lock_guard lock(_resource_mutex);
+        sampling = _sampling;
+    }
+    if (sampling == nullptr) {
+        return true;
+    }
+
+    // The task checks the request at least every `THREAD_CHECK_STOP_INTERVAL_MS`, and locks the resource while it
+    // reads, so don't hold the lock while waiting
+    sampling->is_stopping = true;
+    xSemaphoreTake(sampling->stopped_sem, portMAX_DELAY);
+    {
+        std::lock_guard lock(_resource_mutex);
+        _sampling = nullptr;
+    }
+    ESP_UTILS_LOGD("Sampling task stopped");
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
 bool Touch::swapXY(bool en)
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
@@ -288,6 +450,12 @@ bool Touch::readRawData(int points_num, int buttons_num, int timeout_ms)
 
     ESP_UTILS_LOGD("Param: points_num(%d), buttons_num(%d), timeout_ms(%d)", points_num, buttons_num, timeout_ms);
 
+    // The sampling task owns the controller and the interrupt, keep the data of its latest read
+    if (isSampling()) {
+        ESP_UTILS_LOGD("Sampling, skip read");
+        return true;
+    }
+
     // Wait for the interruption if it is enabled, then read the raw data
     if (isInterruptEnabled()  && (timeout_ms != 0)) {
         ESP_UTILS_LOGD("Wait for interruption");
@@ -298,16 +466,8 @@ bool Touch::readRawData(int points_num, int buttons_num, int timeout_ms)
         }
     }
 
-    // Read the raw data
-    ESP_UTILS_CHECK_ERROR_RETURN(esp_lcd_touch_read_data(touch_panel), false, "Read data failed");
-
-    // Get the points
-    ESP_UTILS_CHECK_FALSE_RETURN(readRawDataPoints(points_num), false, "Read points failed");
-
-#if CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS > 0
-    // Get the buttons
-    ESP_UTILS_CHECK_FALSE_RETURN(readRawDataButtons(buttons_num), false, "Read buttons failed");
-#endif
+    int64_t bus_time_us = 0;
+    ESP_UTILS_CHECK_FALSE_RETURN(readRawDataNoWait(points_num, buttons_num, bus_time_us), false, "Read failed");
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -323,13 +483,10 @@ int Touch::getPoints(TouchPoint points[], uint8_t num)
     ESP_UTILS_LOGD("Param: points(@%p), num(%d)", points, num);
     ESP_UTILS_CHECK_FALSE_RETURN((num == 0) || (points != nullptr), -1, "Invalid points or num");
 
-    int i = 0;
     std::unique_lock lock(_resource_mutex);
-    for (auto &point : _points) {
-        if (i >= num) {
-            break;
-        }
-        points[i++] = point;
+    int i = 0;
+    for (; (i < num) && (i < _frame.points_num); i++) {
+        points[i] = _frame.points[i];
     }
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
@@ -344,8 +501,9 @@ bool Touch::getPoints(utils::vector<TouchPoint> &points)
     ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
 
     ESP_UTILS_LOGD("Param: points(@%p)", &points);
+    // Reuse the storage of the vector, it only allocates when growing
     std::unique_lock lock(_resource_mutex);
-    points = _points;
+    points.assign(_frame.points.begin(), _frame.points.begin() + _frame.points_num);
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -360,7 +518,7 @@ bool Touch::getPoints(std::vector<TouchPoint> &points)
 
     ESP_UTILS_LOGD("Param: points(@%p)", &points);
     std::unique_lock lock(_resource_mutex);
-    points = std::vector<TouchPoint>(_points.begin(), _points.end());
+    points.assign(_frame.points.begin(), _frame.points.begin() + _frame.points_num);
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -378,11 +536,8 @@ int Touch::getButtons(TouchButton buttons[], uint8_t num)
 
     std::unique_lock lock(_resource_mutex);
     int i = 0;
-    for (auto &button : _buttons) {
-        if (i >= num) {
-            break;
-        }
-        buttons[i++] = button;
+    for (; (i < num) && (i < _frame.buttons_num); i++) {
+        buttons[i] = _frame.buttons[i];
     }
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
@@ -397,8 +552,9 @@ bool Touch::getButtons(utils::vector<TouchButton> &buttons)
     ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
 
     ESP_UTILS_LOGD("Param: buttons(%p)", &buttons);
+    // Reuse the storage of the vector, it only allocates when growing
     std::unique_lock lock(_resource_mutex);
-    buttons = _buttons;
+    buttons.assign(_frame.buttons.begin(), _frame.buttons.begin() + _frame.buttons_num);
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -413,7 +569,7 @@ bool Touch::getButtons(std::vector<TouchButton> &buttons)
 
     ESP_UTILS_LOGD("Param: buttons(@%p)", &buttons);
     std::unique_lock lock(_resource_mutex);
-    buttons = std::vector<TouchButton>(_buttons.begin(), _buttons.end());
+    buttons.assign(_frame.buttons.begin(), _frame.buttons.begin() + _frame.buttons_num);
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -431,10 +587,10 @@ int Touch::getButtonState(int index)
     TouchButton ret_button = {};
 
     std::unique_lock lock(_resource_mutex);
-    for (auto &button : _buttons) {
-        if (button.first == index) {
+    for (int i = 0; i < _frame.buttons_num; i++) {
+        if (_frame.buttons[i].first == index) {
             is_found = true;
-            ret_button = button;
+            ret_button = _frame.buttons[i];
             break;
         }
     }
@@ -446,6 +602,38 @@ int Touch::getButtonState(int index)
     return ret_button.second;
 }
 
+int Touch::getContacts(TouchContact contacts[], uint8_t num)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), -1, "Not begun");
+
+    ESP_UTILS_LOGD("Param: contacts(@%p), num(%d)", contacts, num);
+    ESP_UTILS_CHECK_FALSE_RETURN((num == 0) || (contacts != nullptr), -1, "Invalid contacts or num");
+
+    std::unique_lock lock(_resource_mutex);
+    int ret_num = _tracker.getContacts(contacts, num);
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return ret_num;
+}
+
+TouchSampler::Stats Touch::getSamplingStats()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    std::lock_guard lock(_resource_mutex);
+    if (_sampling == nullptr) {
+        return {};
+    }
+    TouchSampler::Stats stats = _sampling->sampler.getStats(esp_timer_get_time());
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return stats;
+}
+
 int Touch::readPoints(TouchPoint points[], int num, int timeout_ms)
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
@@ -546,7 +734,39 @@ Touch::DeviceFullConfig &Touch::getDeviceFullConfig()
     return std::get<DeviceFullConfig>(_config.device);
 }
 
-bool Touch::readRawDataPoints(int points_num)
+bool Touch::readRawDataNoWait(int points_num, int buttons_num, int64_t &bus_time_us)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    // Read the raw data
+    int64_t read_time_us = esp_timer_get_time();
+    ESP_UTILS_CHECK_ERROR_RETURN(esp_lcd_touch_read_data(touch_panel), false, "Read data failed");
+    bus_time_us = esp_timer_get_time() - read_time_us;
+
+    // Get the points
+    ESP_UTILS_CHECK_FALSE_RETURN(readRawDataPoints(points_num, read_time_us), false, "Read points failed");
+
+#if CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS > 0
+    // Get the buttons
+    ESP_UTILS_CHECK_FALSE_RETURN(readRawDataButtons(buttons_num), false, "Read buttons failed");
+#else
+    (void)buttons_num;
+#endif
+
+    // Publish the frame, the consumers read it without the resource mutex
+    std::unique_lock lock(_resource_mutex);
+    _frame.timestamp_us = read_time_us;
+    if (_frame_ring != nullptr) {
+        _frame_ring->push(_frame);
+    }
+    lock.unlock();
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool Touch::readRawDataPoints(int points_num, int64_t time_us)
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
 
@@ -569,31 +789,47 @@ bool Touch::readRawDataPoints(int points_num)
     }
     ESP_UTILS_LOGD("Try to read %d points", points_num);
 
-    utils::vector<uint16_t> x(points_num);
-    utils::vector<uint16_t> y(points_num);
-    utils::vector<uint16_t> strength(points_num);
-    auto x_buf = x.data();
-    auto y_buf = y.data();
-    auto strength_buf = strength.data();
+    // Fixed size buffers on the stack, the read path doesn't allocate
+    std::array<uint16_t, POINTS_MAX_NUM> x = {};
+    std::array<uint16_t, POINTS_MAX_NUM> y = {};
+    std::array<uint16_t, POINTS_MAX_NUM> strength = {};
     uint8_t ret_points_num = 0;
 
     // Get the point coordinates from the raw data
-    esp_lcd_touch_get_coordinates(touch_panel, x_buf, y_buf, strength_buf, &ret_points_num, points_num);
+    esp_lcd_touch_get_coordinates(
+        touch_panel, x.data(), y.data(), strength.data(), &ret_points_num, points_num
+    );
     ESP_UTILS_LOGD("Get %d points number", ret_points_num);
+    if (ret_points_num > points_num) {
+        ret_points_num = points_num;
+    }
 
     // Update the points
     std::unique_lock lock(_resource_mutex);
-    _points.clear();
     for (int i = 0; i < ret_points_num; i++) {
-        _points.emplace_back(static_cast<int>(x_buf[i]), static_cast<int>(y_buf[i]), static_cast<int>(strength_buf[i]));
+        _frame.points[i] = TouchPoint(static_cast<int>(x[i]), static_cast<int>(y[i]), static_cast<int>(strength[i]));
+    }
+    _frame.points_num = ret_points_num;
+    // Track before filtering, so the filter state follows the contacts
+    _tracker.process(_frame.points.data(), ret_points_num);
+    if (_filter.isEnabled()) {
+        _filter.process(_frame.points.data(), ret_points_num, time_us);
+    }
+    if (_predictor.isEnabled()) {
+        // The points are in the range of the panel after the swap of the axes
+        const auto &panel_config = touch_panel->config;
+        bool is_swapped = panel_config.flags.swap_xy;
+        _predictor.setBounds(
+            is_swapped ? panel_config.y_max : panel_config.x_max, is_swapped ? panel_config.x_max : panel_config.y_max
+        );
+        _predictor.process(_frame.points.data(), ret_points_num, time_us);
     }
-    lock.unlock();
-
 #if ESP_UTILS_CONF_LOG_LEVEL == ESP_UTILS_LOG_LEVEL_DEBUG
-    for (auto &point : _points) {
-        point.print();
+    for (int i = 0; i < _frame.points_num; i++) {
+        _frame.points[i].print();
     }
 #endif // ESP_UTILS_LOG_LEVEL_DEBUG
+    lock.unlock();
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -623,8 +859,9 @@ bool Touch::readRawDataButtons(int buttons_num)
     }
     ESP_UTILS_LOGD("Try to read %d buttons", buttons_num);
 
-    // Get the buttons state from the raw data
-    utils::vector<TouchButton> buttons;
+    // Get the buttons state from the raw data, into a fixed size buffer on the stack
+    std::array<TouchButton, BUTTONS_MAX_NUM> buttons = {};
+    int ret_buttons_num = 0;
     uint8_t button_state = 0;
 
     for (int i = 0; i < buttons_num; i++) {
@@ -637,18 +874,20 @@ bool Touch::readRawDataButtons(int buttons_num)
         }
         ESP_UTILS_CHECK_ERROR_RETURN(ret, false, "Get button(%d) state failed", i);
 #endif
-        buttons.emplace_back(i, button_state);
+        buttons[ret_buttons_num++] = TouchButton(i, button_state);
     }
 
     std::unique_lock lock(_resource_mutex);
-    _buttons = std::move(buttons);
-    lock.unlock();
-
+    for (int i = 0; i < ret_buttons_num; i++) {
+        _frame.buttons[i] = buttons[i];
+    }
+    _frame.buttons_num = ret_buttons_num;
 #if ESP_UTILS_CONF_LOG_LEVEL == ESP_UTILS_LOG_LEVEL_DEBUG
-    for (auto &button : _buttons) {
-        ESP_UTILS_LOGD("Button(%d): %d", button.first, button.second);
+    for (int i = 0; i < _frame.buttons_num; i++) {
+        ESP_UTILS_LOGD("Button(%d): %d", _frame.buttons[i].first, _frame.buttons[i].second);
     }
 #endif // ESP_UTILS_LOG_LEVEL_DEBUG
+    lock.unlock();
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -683,4 +922,73 @@ void Touch::onInterruptActive(PanelHandle panel)
     }
 }
 
+void Touch::samplingTask(void *arg)
+{
+    Touch *touch = static_cast<Touch *>(arg);
+    ESP_UTILS_LOGD("Sampling task start");
+
+    {
+        // Keep the sampling alive until the task ends, `stopSampling()` releases it after the task finishes
+        std::shared_ptr<Sampling> sampling = nullptr;
+        {
+            std::lock_guard lock(touch->_resource_mutex);
+            sampling = touch->_sampling;
+        }
+        std::shared_ptr<Interruption> interruption = touch->_interruption;
+        auto &sampler = sampling->sampler;
+        while (!sampling->is_stopping) {
+            std::unique_lock lock(touch->_resource_mutex);
+            int64_t next_read_time_us = sampler.getNextReadTimeUs();
+            bool is_waiting_interrupt = (sampler.getMode() == TouchSampler::Mode::INTERRUPT) &&
+                                        (interruption != nullptr);
+            lock.unlock();
+
+            // Wait for the time of the next read or the interrupt, and check the stop request meanwhile
+            bool is_woken = false;
+            int64_t wait_us = next_read_time_us - esp_timer_get_time();
+            while (!sampling->is_stopping && (wait_us > 0)) {
+                int wait_ms = static_cast<int>((wait_us + 999) / 1000);
+                wait_ms = (wait_ms < THREAD_CHECK_STOP_INTERVAL_MS) ? wait_ms : THREAD_CHECK_STOP_INTERVAL_MS;
+                TickType_t wait_ticks = pdMS_TO_TICKS(wait_ms);
+                wait_ticks = (wait_ticks > 0) ? wait_ticks : 1;
+                if (is_waiting_interrupt) {
+                    if (xSemaphoreTake(interruption->on_active_sem, wait_ticks) == pdTRUE) {
+                        is_woken = true;
+                        break;
+                    }
+                } else {
+                    vTaskDelay(wait_ticks);
+                }
+                wait_us = next_read_time_us - esp_timer_get_time();
+            }
+            if (sampling->is_stopping) {
+                break;
+            }
+
+            int64_t read_time_us = esp_timer_get_time();
+            int64_t bus_time_us = 0;
+            if (!touch->readRawDataNoWait(-1, -1, bus_time_us)) {
+                ESP_UTILS_LOGE("Sampling read failed");
+            }
+            // The interrupts raised by this read are already served
+            if (interruption != nullptr) {
+                xSemaphoreTake(interruption->on_active_sem, 0);
+            }
+
+            lock.lock();
+            bool is_pressed = (touch->_frame.points_num > 0);
+            for (int i = 0; !is_pressed && (i < touch->_frame.buttons_num); i++) {
+                is_pressed = (touch->_frame.buttons[i].second != 0);
+            }
+            sampler.onRead(read_time_us, bus_time_us, is_pressed, is_woken);
+            lock.unlock();
+        }
+
+        ESP_UTILS_LOGD("Sampling task stop");
+        xSemaphoreGive(sampling->stopped_sem);
+    }
+
+    vTaskDelete(NULL);
+}
+
 } // namespace esp_panel::drivers
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <thread>
 #include <variant>
 #include <vector>
@@ -17,55 +18,15 @@
 #include "drivers/bus/esp_panel_bus_factory.hpp"
 #include "port/esp_lcd_touch.h"
 #include "esp_panel_touch_conf_internal.h"
+#include "esp_panel_touch_filter.hpp"
+#include "esp_panel_touch_predictor.hpp"
+#include "esp_panel_touch_sampler.hpp"
+#include "esp_panel_touch_tracker.hpp"
+#include "esp_panel_touch_frame_ring.hpp"
+#include "esp_panel_touch_point.hpp"
 
 namespace esp_panel::drivers {
 
-/**
- * @brief Touch point data structure
- *
- * Contains x/y coordinates and touch strength information for a single touch point
- */
-struct TouchPoint {
-    TouchPoint() = default;
-    TouchPoint(int x, int y, int strength) : x(x), y(y), strength(strength) {}
-
-    /**
-     * @brief Compare if two touch points are equal
-     *
-     * @param[in] p Touch point to compare with
-     * @return `true` if points are equal, `false` otherwise
-     */
-    bool operator==(TouchPoint p)
-    {
-        return ((p.x == x) && (p.y == y));
-    }
-
-    /**
-     * @brief Compare if two touch points are not equal
-     *
-     * @param[in] p Touch point to compare with
-     * @return `true` if points are not equal, `false` otherwise
-     */
-    bool operator!=(TouchPoint p)
-    {
-        return ((p.x != x) || (p.y != y));
-    }
-
-    /**
-     * @brief Print touch point information to debug log
-     */
-    void print() const;
-
-    int x = -1;          /*!< X coordinate of touch point in pixels */
-    int y = -1;          /*!< Y coordinate of touch point in pixels */
-    int strength = -1;   /*!< Strength/pressure of touch point */
-};
-
-/**
- * @brief The touch button type, which is a pair of button index and state
- */
-using TouchButton = std::pair<int, uint8_t>;
-
 /**
  * @brief Base class for all touch screen devices
  *
@@ -240,6 +201,59 @@ public:
      */
     void configInterruptActiveLevel(int level);
 
+    /**
+     * @brief Configure the ring buffer of the timestamped frames, which keeps every read of the controller
+     *
+     * Each successful `readRawData()` (and the functions calling it) publishes the points and buttons as a
+     * `TouchFrame` into the ring buffer, from which any number of consumers read every frame without locking, see
+     * `getFrameRing()`.
+     *
+     * @param[in] size Number of the frames, rounded up to a power of two. Set to `0` to disable (default)
+     * @return `true` if successful, `false` otherwise
+     *
+     * @note This function should be called before `init()`
+     */
+    bool configFrameRingSize(size_t size);
+
+    /**
+     * @brief Configure the jitter filter chain of the touch points (median, IIR, One-Euro and dead-zone)
+     *
+     * The points are filtered by `readRawData()` before they are stored, so the functions getting them and the frame
+     * ring buffer only see the filtered points. See `TouchFilter` for the stages.
+     *
+     * @param[in] config Filter configuration, all the stages are disabled by default
+     * @return `true` if successful, `false` otherwise
+     *
+     * @note This function should be called before `init()`
+     */
+    bool configFilter(const TouchFilter::Config &config);
+
+    /**
+     * @brief Configure the contact tracker, which gives each point an ID stable while the contact is pressed
+     *
+     * The points are tracked by `readRawData()` before the filter, so the `id` of the points got or published in the
+     * frame ring buffer follows the fingers even if the controller reorders them. See `TouchTracker`.
+     *
+     * @param[in] config Tracker configuration
+     * @return `true` if successful, `false` otherwise
+     *
+     * @note This function should be called before `init()`
+     */
+    bool configTracker(const TouchTracker::Config &config);
+
+    /**
+     * @brief Configure the motion predictor of the touch points, which moves them ahead to hide a part of the latency
+     *        of the UI
+     *
+     * The points are predicted by `readRawData()` after the filter, and clamped to the panel. See `TouchPredictor`.
+     *
+     * @param[in] config Predictor configuration, disabled by default
+     * @return `true` if successful, `false` otherwise
+     *
+     * @note This function should be called before `init()`
+     */
+    bool configPredictor(const TouchPredictor::Config &config);
+
     /**
      * @brief Initialize the touch device
      *
@@ -276,6 +290,29 @@ public:
      */
     bool attachInterruptCallback(FunctionInterruptCallback callback, void *user_data = nullptr);
 
+    /**
+     * @brief Start the sampling task, which reads the controller in the background
+     *
+     * The task reads at a high rate while a contact is pressed, then backs off to a low rate or waits for the
+     * interrupt when none is, see `TouchSampler`. The latest points are got by `getPoints()`, and every read is in the
+     * frame ring buffer if it is enabled.
+     *
+     * @param[in] config Sampling configuration
+     * @return `true` if successful, `false` otherwise
+     *
+     * @note This function should be called after `begin()`
+     * @note While the task runs, `readRawData()` (and the functions calling it) doesn't read the controller
+     * @note The periods are rounded up to the FreeRTOS tick
+     */
+    bool startSampling(const TouchSampler::Config &config = {});
+
+    /**
+     * @brief Stop the sampling task, it returns after the task has finished its last read
+     *
+     * @return `true` if successful, `false` otherwise
+     */
+    bool stopSampling();
+
     /**
      * @brief Swap X and Y coordinates
      *
@@ -317,6 +354,7 @@ public:
      * @note This function should be called after `begin()`
      * @note If interrupt pin is set, this function blocks until interrupt occurs or timeout
      * @note Set timeout_ms to -1 for infinite wait
+     * @note While the sampling task runs, this function returns at once and the data of its latest read is got
      */
     bool readRawData(int points_num, int max_buttons_num, int timeout_ms);
 
@@ -399,6 +437,18 @@ public:
      */
     int getButtonState(int index);
 
+    /**
+     * @brief Get the tracked contacts of the latest read, with their phase (down, move or up)
+     *
+     * @param[out] contacts Buffer to store the contacts, in the order of their IDs
+     * @param[in] num Maximum number of contacts to get
+     * @return Number of contacts got if successful, -1 on failure
+     *
+     * @note This function should be called after `begin()`
+     * @note Call this function immediately after `readRawData()`, the released contacts are only in the next one
+     */
+    int getContacts(TouchContact contacts[], uint8_t num);
+
     /**
      * @brief Read touch points with timeout
      *
@@ -471,7 +521,8 @@ public:
      */
     void resetPoints()
     {
-        _points.clear();
+        std::lock_guard lock(_resource_mutex);
+        _frame.points_num = 0;
     }
 
     /**
@@ -479,7 +530,8 @@ public:
      */
     void resetButtons()
     {
-        _buttons.clear();
+        std::lock_guard lock(_resource_mutex);
+        _frame.buttons_num = 0;
     }
 
     /**
@@ -500,6 +552,24 @@ public:
      */
     bool isInterruptEnabled() const;
 
+    /**
+     * @brief Check if the sampling task is running
+     *
+     * @return `true` if running, `false` otherwise
+     */
+    bool isSampling() const
+    {
+        std::lock_guard lock(_resource_mutex);
+        return (_sampling != nullptr);
+    }
+
+    /**
+     * @brief Get a snapshot of the counters of the sampling task, with the achieved sample rate and the bus time
+     *
+     * @return Sampling counters, see `TouchSampler::Stats`. All counters are `0` if the task is not running
+     */
+    TouchSampler::Stats getSamplingStats();
+
     /**
      * @brief Get touch basic attributes
      *
@@ -530,6 +600,36 @@ public:
         return _config;
     }
 
+    /**
+     * @brief Get the configuration of the jitter filter chain
+     *
+     * @return Reference to the filter configuration
+     */
+    const TouchFilter::Config &getFilterConfig() const
+    {
+        return _filter.getConfig();
+    }
+
+    /**
+     * @brief Get the configuration of the contact tracker
+     *
+     * @return Reference to the tracker configuration
+     */
+    const TouchTracker::Config &getTrackerConfig() const
+    {
+        return _tracker.getConfig();
+    }
+
+    /**
+     * @brief Get the configuration of the motion predictor
+     *
+     * @return Reference to the predictor configuration
+     */
+    const TouchPredictor::Config &getPredictorConfig() const
+    {
+        return _predictor.getConfig();
+    }
+
     /**
      * @brief Get touch bus interface
      *
@@ -540,6 +640,18 @@ public:
         return _bus.get();
     }
 
+    /**
+     * @brief Get the ring buffer of the timestamped frames
+     *
+     * @return Pointer to the ring buffer, nullptr if not enabled by `configFrameRingSize()`
+     *
+     * @note This function should be called after `init()`, the pointer is invalid after `del()`
+     */
+    TouchFrameRing *getFrameRing()
+    {
+        return _frame_ring.get();
+    }
+
     /**
      * @brief Get panel handle of touch device
      *
@@ -703,10 +815,23 @@ private:
         StaticSemaphore_t on_active_sem_buffer = {};            /*!< Static buffer for semaphore */
     };
 
+    /**
+     * @brief Sampling task structure
+     */
+    struct Sampling {
+        TouchSampler sampler;                                   /*!< Scheduler of the reads, protected by the
+                                                                     resource mutex */
+        std::atomic<bool> is_stopping = false;                  /*!< Stop request to the task */
+        SemaphoreHandle_t stopped_sem = nullptr;                /*!< Semaphore given when the task finishes */
+        StaticSemaphore_t stopped_sem_buffer = {};              /*!< Static buffer for semaphore */
+    };
+
     DeviceFullConfig &getDeviceFullConfig();
-    bool readRawDataPoints(int points_num);
+    bool readRawDataNoWait(int points_num, int buttons_num, int64_t &bus_time_us);
+    bool readRawDataPoints(int points_num, int64_t time_us);
     bool readRawDataButtons(int max_buttons_num);
     static void onInterruptActive(PanelHandle handle);
+    static void samplingTask(void *arg);
 
     BasicAttributes _basic_attributes = {};                 /*!< Basic device attributes */
     std::shared_ptr<Bus> _bus = nullptr;                    /*!< Bus interface pointer */
@@ -714,10 +839,15 @@ private:
     State _state = State::DEINIT;                           /*!< Current driver state */
     Transformation _transformation = {};                    /*!< Coordinate transformation settings */
     // note: Use std::mutex instead of std::shared_mutex (IDF-12208)
-    std::mutex _resource_mutex;                             /*!< Resource access mutex */
-    utils::vector<TouchPoint> _points;                      /*!< Touch points buffer */
-    utils::vector<TouchButton> _buttons;                    /*!< Touch buttons buffer */
+    mutable std::mutex _resource_mutex;                     /*!< Resource access mutex */
+    TouchFrame _frame;                                      /*!< Points and buttons of the latest read */
+    TouchFilter _filter;                                    /*!< Jitter filter chain of the points */
+    TouchTracker _tracker;                                  /*!< Contact tracker of the points */
+    TouchPredictor _predictor;                              /*!< Motion predictor of the points */
     std::shared_ptr<Interruption> _interruption = nullptr;  /*!< Interrupt handling */
+    size_t _frame_ring_size = 0;                            /*!< Frame ring buffer size, `0` if disabled */
+    std::shared_ptr<TouchFrameRing> _frame_ring = nullptr;  /*!< Frame ring buffer */
+    std::shared_ptr<Sampling> _sampling = nullptr;          /*!< Sampling task, `nullptr` if not running */
 };
 
 } // namespace esp_panel::drivers
@@ -0,0 +1,233 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <climits>
+#include "utils/esp_panel_utils_math.hpp"
+#include "esp_panel_touch_filter.hpp"
+
+namespace esp_panel::drivers {
+
+constexpr int FRAC_BITS = 16;
+constexpr int32_t FIXED_ONE = 1 << FRAC_BITS;
+constexpr int64_t TWO_PI_FIXED = 411775;            // 2 * pi in Q16
+constexpr int64_t ONE_EURO_PERIOD_MAX_US = 1000 * 1000;
+constexpr int64_t ONE_EURO_CUTOFF_MAX_MHZ = 1000 * 1000;
+constexpr int64_t SPEED_MAX_FIXED = INT32_MAX;
+
+static inline int32_t to_fixed(int value)
+{
+    return static_cast<int32_t>(value * FIXED_ONE);
+}
+
+static inline int to_int(int32_t value)
+{
+    return static_cast<int>((static_cast<int64_t>(value) + (FIXED_ONE / 2)) >> FRAC_BITS);
+}
+
+static inline int32_t clamp_speed(int64_t value)
+{
+    return static_cast<int32_t>((value > SPEED_MAX_FIXED) ? SPEED_MAX_FIXED :
+                                ((value < -SPEED_MAX_FIXED) ? -SPEED_MAX_FIXED : value));
+}
+
+/**
+ * Smoothing factor of an exponential filter in Q16, `a = r / (1 + r)` with `r = 2 * pi * cutoff * period`
+ */
+static int32_t get_smoothing_factor(int64_t cutoff_mhz, int64_t period_us)
+{
+    int64_t r = cutoff_mhz * period_us * TWO_PI_FIXED / (1000LL * 1000 * 1000);
+    if (r < 1) {
+        r = 1;
+    }
+    return static_cast<int32_t>((r << FRAC_BITS) / (r + FIXED_ONE));
+}
+
+bool TouchFilter::Config::isValid() const
+{
+    if ((median_size < 0) || (median_size > MEDIAN_SIZE_MAX) || ((median_size > 1) && ((median_size & 1) == 0))) {
+        return false;
+    }
+    if ((iir_weight_percent < 1) || (iir_weight_percent > 100)) {
+        return false;
+    }
+    if ((one_euro_min_cutoff_mhz > ONE_EURO_CUTOFF_MAX_MHZ) || (one_euro_d_cutoff_mhz == 0) ||
+            (one_euro_d_cutoff_mhz > ONE_EURO_CUTOFF_MAX_MHZ)) {
+        return false;
+    }
+
+    return (dead_zone >= 0) && (dead_zone < (1 << 14));
+}
+
+bool TouchFilter::configure(const Config &config)
+{
+    if (!config.isValid()) {
+        return false;
+    }
+
+    _config = config;
+    reset();
+
+    return true;
+}
+
+void TouchFilter::reset()
+{
+    for (auto &contact : _contacts) {
+        contact.sample_num = 0;
+    }
+}
+
+void TouchFilter::process(TouchPoint points[], int num, int64_t time_us)
+{
+    if (points == nullptr) {
+        num = 0;
+    }
+
+    std::array<bool, CONTACTS_MAX_NUM> is_pressed = {};
+    for (int i = 0; (i < num) && (i < CONTACTS_MAX_NUM); i++) {
+        TouchPoint &point = points[i];
+        int index = ((point.id >= 0) && (point.id < CONTACTS_MAX_NUM)) ? point.id : i;
+        if (is_pressed[index]) {
+            // Tracked and untracked points mixed up, leave it unfiltered
+            continue;
+        }
+        is_pressed[index] = true;
+
+        Contact &contact = _contacts[index];
+        int32_t x = to_fixed(point.x);
+        int32_t y = to_fixed(point.y);
+        if (contact.sample_num == 0) {
+            startContact(contact, x, y, time_us);
+            continue;
+        }
+
+        int64_t period_us = time_us - contact.time_us;
+        x = filterMedian(contact.x, contact.sample_num, x);
+        y = filterMedian(contact.y, contact.sample_num, y);
+        x = filterIIR(contact.x, x);
+        y = filterIIR(contact.y, y);
+        x = filterOneEuro(contact.x, x, period_us);
+        y = filterOneEuro(contact.y, y, period_us);
+        filterDeadZone(contact, x, y);
+
+        contact.sample_num++;
+        contact.time_us = time_us;
+        point.x = to_int(contact.x.output);
+        point.y = to_int(contact.y.output);
+    }
+
+    // Lifted
+    for (int i = 0; i < CONTACTS_MAX_NUM; i++) {
+        if (!is_pressed[i]) {
+            _contacts[i].sample_num = 0;
+        }
+    }
+}
+
+int32_t TouchFilter::filterMedian(Axis &axis, uint32_t sample_num, int32_t value) const
+{
+    int size = _config.median_size;
+    if (size <= 1) {
+        return value;
+    }
+
+    axis.median[sample_num % size] = value;
+    int num = (sample_num + 1 < static_cast<uint32_t>(size)) ? static_cast<int>(sample_num + 1) : size;
+
+    // Insertion sort, the window is tiny
+    std::array<int32_t, MEDIAN_SIZE_MAX> sorted = {};
+    for (int i = 0; i < num; i++) {
+        int32_t sample = axis.median[i];
+        int j = i;
+        for (; (j > 0) && (sorted[j - 1] > sample); j--) {
+            sorted[j] = sorted[j - 1];
+        }
+        sorted[j] = sample;
+    }
+
+    return sorted[(num - 1) / 2];
+}
+
+int32_t TouchFilter::filterIIR(Axis &axis, int32_t value) const
+{
+    if (_config.iir_weight_percent >= 100) {
+        return value;
+    }
+
+    axis.iir += static_cast<int32_t>(static_cast<int64_t>(value - axis.iir) * _config.iir_weight_percent / 100);
+
+    return axis.iir;
+}
+
+int32_t TouchFilter::filterOneEuro(Axis &axis, int32_t value, int64_t period_us) const
+{
+    if (_config.one_euro_min_cutoff_mhz == 0) {
+        return value;
+    }
+    // Two reads with the same timestamp, nothing to learn from the second one
+    if (period_us <= 0) {
+        return axis.euro;
+    }
+    if (period_us > ONE_EURO_PERIOD_MAX_US) {
+        period_us = ONE_EURO_PERIOD_MAX_US;
+    }
+
+    // Smooth the speed with a fixed cutoff, then raise the cutoff of the position with it
+    int32_t speed = clamp_speed(static_cast<int64_t>(value - axis.euro) * 1000 * 1000 / period_us);
+    int32_t speed_factor = get_smoothing_factor(_config.one_euro_d_cutoff_mhz, period_us);
+    axis.euro_speed += static_cast<int32_t>(
+                           (static_cast<int64_t>(speed - axis.euro_speed) * speed_factor) >> FRAC_BITS
+                       );
+
+    int64_t abs_speed = (axis.euro_speed < 0) ? -static_cast<int64_t>(axis.euro_speed) : axis.euro_speed;
+    int64_t cutoff_mhz = _config.one_euro_min_cutoff_mhz +
+                         static_cast<int64_t>(_config.one_euro_beta_micro) * abs_speed / (1000LL * FIXED_ONE);
+    if (cutoff_mhz > ONE_EURO_CUTOFF_MAX_MHZ) {
+        cutoff_mhz = ONE_EURO_CUTOFF_MAX_MHZ;
+    }
+    int32_t factor = get_smoothing_factor(cutoff_mhz, period_us);
+    axis.euro += static_cast<int32_t>((static_cast<int64_t>(value - axis.euro) * factor) >> FRAC_BITS);
+
+    return axis.euro;
+}
+
+void TouchFilter::filterDeadZone(Contact &contact, int32_t x, int32_t y) const
+{
+    if (_config.dead_zone <= 0) {
+        contact.x.output = x;
+        contact.y.output = y;
+        return;
+    }
+
+    int64_t dx = static_cast<int64_t>(x) - contact.x.output;
+    int64_t dy = static_cast<int64_t>(y) - contact.y.output;
+    int64_t distance = utils::distance(dx, dy);
+    int64_t radius = static_cast<int64_t>(_config.dead_zone) * FIXED_ONE;
+    if (distance <= radius) {
+        return;
+    }
+
+    // Follow the point at the edge of the dead-zone
+    contact.x.output += static_cast<int32_t>(dx * (distance - radius) / distance);
+    contact.y.output += static_cast<int32_t>(dy * (distance - radius) / distance);
+}
+
+void TouchFilter::startContact(Contact &contact, int32_t x, int32_t y, int64_t time_us) const
+{
+    contact = Contact();
+    contact.sample_num = 1;
+    contact.time_us = time_us;
+    contact.x.median[0] = x;
+    contact.x.iir = x;
+    contact.x.euro = x;
+    contact.x.output = x;
+    contact.y.median[0] = y;
+    contact.y.iir = y;
+    contact.y.euro = y;
+    contact.y.output = y;
+}
+
+} // namespace esp_panel::drivers
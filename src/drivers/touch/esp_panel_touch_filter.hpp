@@ -0,0 +1,141 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "esp_panel_touch_conf_internal.h"
+#include "esp_panel_touch_point.hpp"
+
+namespace esp_panel::drivers {
+
+/**
+ * @brief Jitter filter chain of the touch points
+ *
+ * The stages run in this order, each one is optional:
+ *  1. Median of the last N samples, removes the spikes of the resistive controllers
+ *  2. Exponential (IIR) smoothing with a fixed weight
+ *  3. One-Euro filter, an exponential smoothing whose cutoff frequency rises with the speed, so a held finger is
+ *     steady while a fast drag has little lag
+ *  4. Movement dead-zone, the output doesn't move until the point leaves a circle around it, then is dragged along
+ *     at the edge of the circle. It stops the redraws caused by a finger at rest
+ *
+ * The state is kept per contact, by the `id` of the point from `TouchTracker`, or by its index in the read if it is
+ * untracked. A contact starts over when it is lifted (no point of the read has it), its first sample passes through
+ * unchanged. All the math is in fixed point and the state is a fixed size member, so filtering neither allocates nor
+ * uses the FPU.
+ *
+ * This class doesn't lock, the caller should protect it.
+ */
+class TouchFilter {
+public:
+    static constexpr int CONTACTS_MAX_NUM = ESP_PANEL_DRIVERS_TOUCH_MAX_POINTS;
+    static constexpr int MEDIAN_SIZE_MAX = 7;
+
+    /**
+     * @brief Filter configuration, a stage is disabled with its default value
+     */
+    struct Config {
+        /**
+         * @brief Check if any stage is enabled
+         *
+         * @return `true` if enabled, `false` otherwise
+         */
+        bool isEnabled() const
+        {
+            return (median_size > 1) || (iir_weight_percent < 100) || (one_euro_min_cutoff_mhz > 0) || (dead_zone > 0);
+        }
+
+        /**
+         * @brief Check if the parameters are in range
+         *
+         * @return `true` if valid, `false` otherwise
+         */
+        bool isValid() const;
+
+        int median_size = 0;                    /*!< Number of samples of the median, odd and up to `MEDIAN_SIZE_MAX`.
+                                                     `0` or `1` disables it */
+        int iir_weight_percent = 100;           /*!< Weight of a new sample in the exponential smoothing, in
+                                                     [1, 100]. `100` disables it */
+        uint32_t one_euro_min_cutoff_mhz = 0;   /*!< Cutoff frequency of the One-Euro filter at rest in mHz, `0`
+                                                     disables it */
+        uint32_t one_euro_beta_micro = 0;       /*!< Rise of the One-Euro cutoff frequency with the speed, in uHz per
+                                                     pixel/s */
+        uint32_t one_euro_d_cutoff_mhz = 1000;  /*!< Cutoff frequency of the One-Euro speed estimate in mHz */
+        int dead_zone = 0;                      /*!< Radius of the movement dead-zone in pixels, `0` disables it */
+    };
+
+    /**
+     * @brief Set the configuration and reset the state
+     *
+     * @param[in] config Filter configuration
+     * @return `true` if successful, `false` if the configuration is invalid
+     */
+    bool configure(const Config &config);
+
+    /**
+     * @brief Reset the state of all the contacts, as if they were lifted
+     */
+    void reset();
+
+    /**
+     * @brief Filter the points of a read in place
+     *
+     * @param[in,out] points Points of the read, the `id` of a point (or its index if untracked) is its contact
+     * @param[in] num Number of the points, the contacts without point are lifted
+     * @param[in] time_us Time of the read in microseconds, used by the One-Euro filter
+     */
+    void process(TouchPoint points[], int num, int64_t time_us);
+
+    /**
+     * @brief Check if any stage is enabled
+     *
+     * @return `true` if enabled, `false` otherwise
+     */
+    bool isEnabled() const
+    {
+        return _config.isEnabled();
+    }
+
+    /**
+     * @brief Get the configuration
+     *
+     * @return Configuration
+     */
+    const Config &getConfig() const
+    {
+        return _config;
+    }
+
+private:
+    /* Positions are in Q16 pixels, speeds in Q16 pixels per second */
+    struct Axis {
+        std::array<int32_t, MEDIAN_SIZE_MAX> median = {};
+        int32_t iir = 0;
+        int32_t euro = 0;
+        int32_t euro_speed = 0;
+        int32_t output = 0;
+    };
+
+    struct Contact {
+        uint32_t sample_num = 0;
+        int64_t time_us = 0;
+        Axis x;
+        Axis y;
+    };
+
+    int32_t filterMedian(Axis &axis, uint32_t sample_num, int32_t value) const;
+    int32_t filterIIR(Axis &axis, int32_t value) const;
+    int32_t filterOneEuro(Axis &axis, int32_t value, int64_t period_us) const;
+    void filterDeadZone(Contact &contact, int32_t x, int32_t y) const;
+    void startContact(Contact &contact, int32_t x, int32_t y, int64_t time_us) const;
+
+    Config _config = {};
+    std::array<Contact, CONTACTS_MAX_NUM> _contacts = {};
+};
+
+} // namespace esp_panel::drivers
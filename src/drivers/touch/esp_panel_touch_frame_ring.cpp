@@ -0,0 +1,138 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <new>
+#include "esp_panel_touch_frame_ring.hpp"
+
+namespace esp_panel::drivers {
+
+static void copy_frame(const TouchFrame &src, TouchFrame &dst)
+{
+    // Only copy the valid entries. The counts might be torn by the producer, which is detected by the caller
+    int points_num = src.points_num;
+    int buttons_num = src.buttons_num;
+    points_num = ((points_num >= 0) && (points_num <= TouchFrame::POINTS_MAX_NUM)) ? points_num : 0;
+    buttons_num = ((buttons_num >= 0) && (buttons_num <= TouchFrame::BUTTONS_MAX_NUM)) ? buttons_num : 0;
+
+    dst.sequence = src.sequence;
+    dst.timestamp_us = src.timestamp_us;
+    dst.points_num = points_num;
+    dst.buttons_num = buttons_num;
+    for (int i = 0; i < points_num; i++) {
+        dst.points[i] = src.points[i];
+    }
+    for (int i = 0; i < buttons_num; i++) {
+        dst.buttons[i] = src.buttons[i];
+    }
+}
+
+TouchFrameRing::TouchFrameRing(size_t capacity)
+{
+    if (capacity == 0) {
+        return;
+    }
+
+    // At least two slots, so that the latest frame is never the one being written
+    size_t size = 2;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    _slots.reset(new (std::nothrow) Slot[size]);
+    if (_slots != nullptr) {
+        _mask = size - 1;
+    }
+}
+
+uint32_t TouchFrameRing::push(TouchFrame &frame)
+{
+    if (!isValid()) {
+        return 0;
+    }
+
+    uint32_t sequence = _latest_sequence.load(std::memory_order_relaxed) + 1;
+    if (sequence == 0) {
+        sequence = 1;
+    }
+    frame.sequence = sequence;
+
+    // Mark the slot as being written before touching the frame, then publish it
+    Slot &slot = _slots[sequence & _mask];
+    slot.lock.store(2 * sequence - 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    copy_frame(frame, slot.frame);
+    slot.lock.store(2 * sequence, std::memory_order_release);
+    _latest_sequence.store(sequence, std::memory_order_release);
+
+    return sequence;
+}
+
+bool TouchFrameRing::read(uint32_t &cursor, TouchFrame &frame, uint32_t *lost_num) const
+{
+    uint32_t lost = 0;
+    bool ret = false;
+
+    while (isValid()) {
+        uint32_t latest = _latest_sequence.load(std::memory_order_acquire);
+        uint32_t behind = latest - cursor;
+        if ((latest == 0) || (behind == 0) || (behind > (1U << 31))) {
+            // Nothing new, or the cursor is ahead (e.g. from another buffer)
+            break;
+        }
+        // Skip the frames which are already overwritten
+        if (behind > getCapacity()) {
+            uint32_t skip = behind - getCapacity();
+            lost += skip;
+            cursor += skip;
+        }
+
+        uint32_t sequence = (cursor + 1 == 0) ? 1 : (cursor + 1);
+        if (readSlot(sequence, frame)) {
+            cursor = sequence;
+            ret = true;
+            break;
+        }
+        // Overwritten by a newer frame, which may still be in writing if the producer is preempted. Skip it instead
+        // of waiting for the producer, the next slots are not touched until the latest sequence moves again
+        lost++;
+        cursor = sequence;
+    }
+
+    if (lost_num != nullptr) {
+        *lost_num = lost;
+    }
+
+    return ret;
+}
+
+bool TouchFrameRing::readLatest(TouchFrame &frame) const
+{
+    while (isValid()) {
+        uint32_t latest = _latest_sequence.load(std::memory_order_acquire);
+        if (latest == 0) {
+            break;
+        }
+        if (readSlot(latest, frame)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool TouchFrameRing::readSlot(uint32_t sequence, TouchFrame &frame) const
+{
+    const Slot &slot = _slots[sequence & _mask];
+    uint32_t lock = slot.lock.load(std::memory_order_acquire);
+    if (lock != 2 * sequence) {
+        return false;
+    }
+    copy_frame(slot.frame, frame);
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    return (slot.lock.load(std::memory_order_relaxed) == lock);
+}
+
+} // namespace esp_panel::drivers
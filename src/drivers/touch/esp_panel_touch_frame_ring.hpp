@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "esp_panel_touch_conf_internal.h"
+#include "esp_panel_touch_point.hpp"
+
+namespace esp_panel::drivers {
+
+/**
+ * @brief A timestamped sample of all the touch points and buttons from one read of the controller
+ */
+struct TouchFrame {
+    static constexpr int POINTS_MAX_NUM = ESP_PANEL_DRIVERS_TOUCH_MAX_POINTS;
+    static constexpr int BUTTONS_MAX_NUM = ESP_PANEL_DRIVERS_TOUCH_MAX_BUTTONS;
+
+    uint32_t sequence = 0;                                  /*!< Sequence number, set by `TouchFrameRing::push()` */
+    int64_t timestamp_us = 0;                               /*!< Time of the read in microseconds */
+    int points_num = 0;                                     /*!< Number of the valid points */
+    int buttons_num = 0;                                    /*!< Number of the valid buttons */
+    std::array<TouchPoint, POINTS_MAX_NUM> points = {};     /*!< Touch points */
+    std::array<TouchButton, BUTTONS_MAX_NUM> buttons = {};  /*!< Touch buttons */
+};
+
+/**
+ * @brief Single-producer/multi-consumer ring buffer of touch frames
+ *
+ * The producer (the touch read path) never waits for the consumers, and the consumers never lock: each slot is
+ * guarded by a sequence counter (a seqlock), so a consumer copies a frame and retries if the producer overwrote it in
+ * the meantime. Each consumer keeps its own cursor, the sequence number of the last frame it read, so any number of
+ * consumers can process every frame at the controller rate. A consumer which falls more than `getCapacity()` frames
+ * behind skips the oldest ones and is told how many were lost.
+ *
+ * Sequence numbers start from 1 and wrap around, they are compared by their difference.
+ *
+ * @note Only one task may call `push()`. `read()` and `readLatest()` may be called from any task, but not from an
+ *       interrupt since they may retry
+ */
+class TouchFrameRing {
+public:
+    /**
+     * @brief Construct a ring buffer
+     *
+     * @param[in] capacity Number of the frames, rounded up to a power of two (at least 2). The buffer is invalid if
+     *                     `0` or the allocation fails, see `isValid()`
+     */
+    explicit TouchFrameRing(size_t capacity);
+
+    /**
+     * @brief Check if the buffer is allocated
+     *
+     * @return `true` if valid, `false` otherwise
+     */
+    bool isValid() const
+    {
+        return (_slots != nullptr);
+    }
+
+    /**
+     * @brief Get the number of the frames which can be kept
+     *
+     * @return Number of frames
+     */
+    size_t getCapacity() const
+    {
+        return _mask + 1;
+    }
+
+    /**
+     * @brief Publish a frame, overwriting the oldest one if the buffer is full
+     *
+     * @param[in,out] frame Frame to publish, its `sequence` is set to the assigned sequence number
+     * @return Sequence number of the frame, `0` if the buffer is invalid
+     */
+    uint32_t push(TouchFrame &frame);
+
+    /**
+     * @brief Read the frame after a cursor, then move the cursor to it
+     *
+     * Start with the cursor `0` to read from the oldest frame kept, or `getLatestSequence()` to read only the new ones.
+     *
+     * @param[in,out] cursor Sequence number of the last read frame
+     * @param[out] frame Frame read
+     * @param[out] lost_num Number of the frames overwritten before they could be read, optional
+     * @return `true` if a frame is read, `false` if there is no new frame
+     */
+    bool read(uint32_t &cursor, TouchFrame &frame, uint32_t *lost_num = nullptr) const;
+
+    /**
+     * @brief Read the latest frame
+     *
+     * @param[out] frame Frame read
+     * @return `true` if successful, `false` if no frame is published yet
+     */
+    bool readLatest(TouchFrame &frame) const;
+
+    /**
+     * @brief Get the sequence number of the latest frame
+     *
+     * @return Sequence number, `0` if no frame is published yet
+     */
+    uint32_t getLatestSequence() const
+    {
+        return _latest_sequence.load(std::memory_order_acquire);
+    }
+
+private:
+    struct Slot {
+        std::atomic<uint32_t> lock{0};  /*!< `2 * sequence - 1` while being written, `2 * sequence` when published */
+        TouchFrame frame;
+    };
+
+    bool readSlot(uint32_t sequence, TouchFrame &frame) const;
+
+    std::unique_ptr<Slot[]> _slots;
+    size_t _mask = static_cast<size_t>(-1);
+    std::atomic<uint32_t> _latest_sequence{0};
+};
+
+} // namespace esp_panel::drivers
@@ -0,0 +1,247 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "utils/esp_panel_utils_math.hpp"
+#include "esp_panel_touch_gesture.hpp"
+
+namespace esp_panel::drivers {
+
+static int32_t wrap_angle(int32_t angle)
+{
+    while (angle > 18000) {
+        angle -= 36000;
+    }
+    while (angle <= -18000) {
+        angle += 36000;
+    }
+    return angle;
+}
+
+int TouchGesture::process(const TouchFrame &frame)
+{
+    _events_num = 0;
+
+    int points_num = (frame.points_num < CONTACTS_MAX_NUM) ? frame.points_num : CONTACTS_MAX_NUM;
+    std::array<bool, CONTACTS_MAX_NUM> is_pressed = {};
+    int down_num = 0;
+    for (int i = 0; i < points_num; i++) {
+        const TouchPoint &point = frame.points[i];
+        int index = ((point.id >= 0) && (point.id < CONTACTS_MAX_NUM)) ? point.id : i;
+        if (is_pressed[index]) {
+            continue;
+        }
+        is_pressed[index] = true;
+        processPress(_contacts[index], point, frame.timestamp_us);
+        down_num++;
+    }
+    // The first two pressed contacts, for the long press and the multi-touch
+    int first_index = -1;
+    int second_index = -1;
+    for (int i = 0; i < CONTACTS_MAX_NUM; i++) {
+        if (is_pressed[i]) {
+            if (first_index < 0) {
+                first_index = i;
+            } else if (second_index < 0) {
+                second_index = i;
+            }
+        } else if (_contacts[i].is_down) {
+            processRelease(_contacts[i], frame.timestamp_us);
+        }
+    }
+
+    if (down_num > _gesture_points_max) {
+        _gesture_points_max = down_num;
+    }
+
+    // Long press, only when a single contact is held in place
+    if ((_gesture_points_max == 1) && (first_index >= 0)) {
+        const Contact &first = _contacts[first_index];
+        if (!first.is_moved && !_is_long_pressed &&
+                (frame.timestamp_us - first.down_time_us >= static_cast<int64_t>(_config.long_press_time_ms) * 1000)) {
+            _is_long_pressed = true;
+            TouchGestureEvent event;
+            event.type = TouchGestureEvent::Type::LONG_PRESS;
+            event.timestamp_us = frame.timestamp_us;
+            event.points_num = 1;
+            event.x = first.x;
+            event.y = first.y;
+            emit(event);
+        }
+    }
+
+    if (down_num >= 2) {
+        if ((down_num != _multi_points_num) || (first_index != _multi_first_index) ||
+                (second_index != _multi_second_index)) {
+            // Start over from the current positions, the contacts of the gesture have changed
+            const Contact &first = _contacts[first_index];
+            const Contact &second = _contacts[second_index];
+            _multi_points_num = down_num;
+            _multi_first_index = first_index;
+            _multi_second_index = second_index;
+            _multi_distance_start = utils::distance(second.x - first.x, second.y - first.y);
+            _multi_angle_start = utils::atan2_centidegrees(second.y - first.y, second.x - first.x);
+            _pinch_scale_emitted = 1000;
+            _rotate_angle_emitted = 0;
+        } else {
+            processMultiTouch(frame.timestamp_us);
+        }
+    } else {
+        _multi_points_num = down_num;
+    }
+
+    if (down_num == 0) {
+        _gesture_points_max = 0;
+        _is_long_pressed = false;
+    }
+
+    return _events_num;
+}
+
+int TouchGesture::process(const TouchFrameRing &ring)
+{
+    int events_num = 0;
+    TouchFrame frame;
+    while (ring.read(_ring_cursor, frame)) {
+        events_num += process(frame);
+    }
+
+    return events_num;
+}
+
+void TouchGesture::reset()
+{
+    for (auto &contact : _contacts) {
+        contact = Contact();
+    }
+    _gesture_points_max = 0;
+    _is_long_pressed = false;
+    _multi_points_num = 0;
+    _has_tap = false;
+}
+
+void TouchGesture::processPress(Contact &contact, const TouchPoint &point, int64_t time_us)
+{
+    if (!contact.is_down) {
+        contact.is_down = true;
+        contact.is_moved = false;
+        contact.down_time_us = time_us;
+        contact.start_x = point.x;
+        contact.start_y = point.y;
+    }
+    contact.x = point.x;
+    contact.y = point.y;
+    if (!contact.is_moved &&
+            (utils::distance(contact.x - contact.start_x, contact.y - contact.start_y) > _config.tap_distance_max)) {
+        contact.is_moved = true;
+    }
+}
+
+void TouchGesture::processRelease(Contact &contact, int64_t time_us)
+{
+    contact.is_down = false;
+    // Only the gestures of a single contact end with a release
+    if (_gesture_points_max != 1) {
+        return;
+    }
+
+    int64_t duration_us = time_us - contact.down_time_us;
+    TouchGestureEvent event;
+    event.timestamp_us = time_us;
+    event.points_num = 1;
+    event.x = contact.x;
+    event.y = contact.y;
+
+    if (!contact.is_moved) {
+        if (_is_long_pressed || (duration_us > static_cast<int64_t>(_config.tap_time_max_ms) * 1000)) {
+            _has_tap = false;
+            return;
+        }
+
+        event.type = TouchGestureEvent::Type::TAP;
+        emit(event);
+
+        // The interval is from the release of the first tap to the press of the second one
+        int64_t interval_us = contact.down_time_us - _tap_time_us;
+        bool is_double = _has_tap && (interval_us <= static_cast<int64_t>(_config.double_tap_interval_ms) * 1000) &&
+                         (utils::distance(contact.x - _tap_x, contact.y - _tap_y) <= _config.tap_distance_max);
+        if (is_double) {
+            event.type = TouchGestureEvent::Type::DOUBLE_TAP;
+            emit(event);
+            _has_tap = false;
+        } else {
+            _has_tap = true;
+            _tap_time_us = time_us;
+            _tap_x = contact.x;
+            _tap_y = contact.y;
+        }
+        return;
+    }
+
+    _has_tap = false;
+    int dx = contact.x - contact.start_x;
+    int dy = contact.y - contact.start_y;
+    int64_t distance = utils::distance(dx, dy);
+    int64_t speed = (duration_us > 0) ? (distance * 1000 * 1000 / duration_us) : 0;
+    if ((distance < _config.swipe_distance_min) || (speed < _config.swipe_speed_min)) {
+        return;
+    }
+
+    event.type = TouchGestureEvent::Type::SWIPE;
+    event.dx = dx;
+    event.dy = dy;
+    event.speed = static_cast<int>(speed);
+    if (((dx < 0) ? -dx : dx) >= ((dy < 0) ? -dy : dy)) {
+        event.direction = (dx < 0) ? TouchGestureEvent::Direction::LEFT : TouchGestureEvent::Direction::RIGHT;
+    } else {
+        event.direction = (dy < 0) ? TouchGestureEvent::Direction::UP : TouchGestureEvent::Direction::DOWN;
+    }
+    emit(event);
+}
+
+void TouchGesture::processMultiTouch(int64_t time_us)
+{
+    const Contact &first = _contacts[_multi_first_index];
+    const Contact &second = _contacts[_multi_second_index];
+    int dx = second.x - first.x;
+    int dy = second.y - first.y;
+
+    TouchGestureEvent event;
+    event.timestamp_us = time_us;
+    event.points_num = _multi_points_num;
+    event.x = (first.x + second.x) / 2;
+    event.y = (first.y + second.y) / 2;
+
+    if (_multi_distance_start > 0) {
+        int scale = static_cast<int>(utils::distance(dx, dy) * 1000 / _multi_distance_start);
+        int step = scale - _pinch_scale_emitted;
+        if (((step < 0) ? -step : step) >= _config.pinch_step_permille) {
+            _pinch_scale_emitted = scale;
+            event.type = TouchGestureEvent::Type::PINCH;
+            event.scale_permille = scale;
+            emit(event);
+        }
+    }
+
+    int32_t angle = wrap_angle(utils::atan2_centidegrees(dy, dx) - _multi_angle_start);
+    int32_t step = wrap_angle(angle - _rotate_angle_emitted);
+    if (((step < 0) ? -step : step) >= _config.rotate_step_centidegrees) {
+        _rotate_angle_emitted = angle;
+        event.type = TouchGestureEvent::Type::ROTATE;
+        event.scale_permille = _pinch_scale_emitted;
+        event.angle_centidegrees = angle;
+        emit(event);
+    }
+}
+
+void TouchGesture::emit(TouchGestureEvent &event)
+{
+    _events_num++;
+    if (_callback != nullptr) {
+        _callback(event, _callback_user_data);
+    }
+}
+
+} // namespace esp_panel::drivers
@@ -0,0 +1,190 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "esp_panel_touch_conf_internal.h"
+#include "esp_panel_touch_frame_ring.hpp"
+
+namespace esp_panel::drivers {
+
+/**
+ * @brief Gesture event, emitted by `TouchGesture`
+ */
+struct TouchGestureEvent {
+    /**
+     * @brief Gesture type
+     */
+    enum class Type : uint8_t {
+        TAP = 0,        /*!< A single contact pressed and released in place */
+        DOUBLE_TAP,     /*!< A second tap close to the first one in time and position, follows its `TAP` */
+        LONG_PRESS,     /*!< A single contact held in place, emitted once while it is still pressed */
+        SWIPE,          /*!< A single contact released after a fast enough move */
+        PINCH,          /*!< Two contacts moved apart or together, emitted at each step of the scale */
+        ROTATE,         /*!< Two contacts turned around each other, emitted at each step of the angle */
+    };
+
+    /**
+     * @brief Swipe direction, the axis of the larger move
+     */
+    enum class Direction : uint8_t {
+        NONE = 0,
+        LEFT,
+        RIGHT,
+        UP,
+        DOWN,
+    };
+
+    Type type = Type::TAP;                  /*!< Gesture type */
+    int64_t timestamp_us = 0;               /*!< Time of the frame which completed the gesture */
+    int points_num = 0;                     /*!< Number of the contacts of the gesture */
+    int x = 0;                              /*!< X of the contact, or of the center of two contacts */
+    int y = 0;                              /*!< Y of the contact, or of the center of two contacts */
+    Direction direction = Direction::NONE;  /*!< Swipe: direction */
+    int dx = 0;                             /*!< Swipe: move along X in pixels */
+    int dy = 0;                             /*!< Swipe: move along Y in pixels */
+    int speed = 0;                          /*!< Swipe: average speed in pixels/s */
+    int scale_permille = 1000;              /*!< Pinch, rotate: distance of the contacts relative to the start, in
+                                                 1/1000 */
+    int angle_centidegrees = 0;             /*!< Rotate: angle since the start, in 1/100 degree, clockwise with the Y
+                                                 axis pointing down */
+};
+
+/**
+ * @brief Gesture recognizer over the timestamped touch frames
+ *
+ * It consumes the frames of a read (e.g. from `Touch::getFrameRing()` with its own cursor, so it sees every read
+ * even if the UI polls slower) and emits `TouchGestureEvent` through a callback. Taps, double taps, long presses and
+ * swipes come from a single contact, pinch and rotate from the first two contacts of a multi-touch gesture. A
+ * contact is identified by the `id` of its point from `TouchTracker`, or by its index in the frame if it is untracked.
+ *
+ * The state is a fixed size member, and the math is in integers, so recognizing neither allocates nor uses the FPU.
+ *
+ * This class doesn't lock, the callback runs in the task calling `process()`.
+ */
+class TouchGesture {
+public:
+    static constexpr int CONTACTS_MAX_NUM = ESP_PANEL_DRIVERS_TOUCH_MAX_POINTS;
+
+    /**
+     * @brief Function pointer type for the event callback
+     *
+     * @param[in] event Gesture event
+     * @param[in] user_data User provided data pointer that will be passed to the callback
+     */
+    using FunctionEventCallback = void (*)(const TouchGestureEvent &event, void *user_data);
+
+    /**
+     * @brief Recognizer thresholds
+     */
+    struct Config {
+        int tap_time_max_ms = 300;              /*!< Longest press of a tap */
+        int double_tap_interval_ms = 300;       /*!< Longest time from the release of a tap to the next press */
+        int long_press_time_ms = 600;           /*!< Shortest press of a long press */
+        int tap_distance_max = 10;              /*!< Largest move of a tap or a long press, in pixels */
+        int swipe_distance_min = 50;            /*!< Shortest move of a swipe, in pixels */
+        int swipe_speed_min = 200;              /*!< Lowest average speed of a swipe, in pixels/s */
+        int pinch_step_permille = 50;           /*!< Change of the scale between two pinch events, in 1/1000 */
+        int rotate_step_centidegrees = 500;     /*!< Change of the angle between two rotate events, in 1/100 degree */
+    };
+
+    TouchGesture() = default;
+
+    /**
+     * @brief Construct a recognizer with the thresholds
+     *
+     * @param[in] config Recognizer thresholds
+     */
+    explicit TouchGesture(const Config &config): _config(config) {}
+
+    /**
+     * @brief Attach the event callback
+     *
+     * @param[in] callback Function to be called for each event, `nullptr` to detach
+     * @param[in] user_data User data to pass to callback function
+     */
+    void attachEventCallback(FunctionEventCallback callback, void *user_data = nullptr)
+    {
+        _callback = callback;
+        _callback_user_data = user_data;
+    }
+
+    /**
+     * @brief Process a frame, the frames should be processed in time order
+     *
+     * @param[in] frame Frame of a read
+     * @return Number of the events emitted
+     */
+    int process(const TouchFrame &frame);
+
+    /**
+     * @brief Process the frames of a ring buffer published since the last call
+     *
+     * The frames lost by overrun are skipped, as if the contacts didn't change in the meantime.
+     *
+     * @param[in] ring Frame ring buffer
+     * @return Number of the events emitted
+     */
+    int process(const TouchFrameRing &ring);
+
+    /**
+     * @brief Reset the state, as if all the contacts were released without gesture
+     */
+    void reset();
+
+    /**
+     * @brief Get the thresholds
+     *
+     * @return Recognizer thresholds
+     */
+    const Config &getConfig() const
+    {
+        return _config;
+    }
+
+private:
+    struct Contact {
+        bool is_down = false;
+        bool is_moved = false;          /*!< Moved beyond `tap_distance_max` since it was pressed */
+        int64_t down_time_us = 0;
+        int start_x = 0;
+        int start_y = 0;
+        int x = 0;
+        int y = 0;
+    };
+
+    void processPress(Contact &contact, const TouchPoint &point, int64_t time_us);
+    void processRelease(Contact &contact, int64_t time_us);
+    void processMultiTouch(int64_t time_us);
+    void emit(TouchGestureEvent &event);
+
+    Config _config = {};
+    FunctionEventCallback _callback = nullptr;
+    void *_callback_user_data = nullptr;
+    std::array<Contact, CONTACTS_MAX_NUM> _contacts = {};
+    uint32_t _ring_cursor = 0;
+    int _events_num = 0;
+    // Gesture from the first press to the release of all the contacts
+    int _gesture_points_max = 0;
+    bool _is_long_pressed = false;
+    // Multi-touch, reset when the number of the contacts or the first two of them change
+    int _multi_points_num = 0;
+    int _multi_first_index = 0;
+    int _multi_second_index = 1;
+    int64_t _multi_distance_start = 0;
+    int32_t _multi_angle_start = 0;
+    int _pinch_scale_emitted = 1000;
+    int32_t _rotate_angle_emitted = 0;
+    // Last tap, for the double tap
+    bool _has_tap = false;
+    int64_t _tap_time_us = 0;
+    int _tap_x = 0;
+    int _tap_y = 0;
+};
+
+} // namespace esp_panel::drivers
@@ -0,0 +1,61 @@
+/*
+ * SPDX-FileCopyrightText: 2023-2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+
+namespace esp_panel::drivers {
+
+/**
+ * @brief Touch point data structure
+ *
+ * Contains x/y coordinates and touch strength information for a single touch point
+ */
+struct TouchPoint {
+    TouchPoint() = default;
+    TouchPoint(int x, int y, int strength) : x(x), y(y), strength(strength) {}
+
+    /**
+     * @brief Compare if two touch points are equal
+     *
+     * @param[in] p Touch point to compare with
+     * @return `true` if points are equal, `false` otherwise
+     */
+    bool operator==(TouchPoint p)
+    {
+        return ((p.x == x) && (p.y == y));
+    }
+
+    /**
+     * @brief Compare if two touch points are not equal
+     *
+     * @param[in] p Touch point to compare with
+     * @return `true` if points are not equal, `false` otherwise
+     */
+    bool operator!=(TouchPoint p)
+    {
+        return ((p.x != x) || (p.y != y));
+    }
+
+    /**
+     * @brief Print touch point information to debug log
+     */
+    void print() const;
+
+    int x = -1;          /*!< X coordinate of touch point in pixels */
+    int y = -1;          /*!< Y coordinate of touch point in pixels */
+    int strength = -1;   /*!< Strength/pressure of touch point */
+    int id = -1;         /*!< Contact ID from `TouchTracker`, stable while the contact is pressed. `-1` if untracked */
+};
+
+/**
+ * @brief The touch button type, which is a pair of button index and state
+ */
+using TouchButton = std::pair<int, uint8_t>;
+
+} // namespace esp_panel::drivers
@@ -0,0 +1,132 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "utils/esp_panel_utils_math.hpp"
+#include "esp_panel_touch_predictor.hpp"
+
+namespace esp_panel::drivers {
+
+constexpr int FRAC_BITS = 8;
+constexpr int64_t US_PER_S = 1000 * 1000;
+constexpr int64_t VELOCITY_MAX = 100000LL << FRAC_BITS;         // 100000 pixels/s
+constexpr int64_t ACCELERATION_MAX = 10000000LL << FRAC_BITS;   // 10000000 pixels/s^2
+
+static inline int64_t clamp(int64_t value, int64_t min, int64_t max)
+{
+    return (value < min) ? min : ((value > max) ? max : value);
+}
+
+bool TouchPredictor::configure(const Config &config)
+{
+    if (!config.isValid()) {
+        return false;
+    }
+
+    _config = config;
+    reset();
+
+    return true;
+}
+
+void TouchPredictor::reset()
+{
+    for (auto &contact : _contacts) {
+        contact.sample_num = 0;
+    }
+}
+
+void TouchPredictor::process(TouchPoint points[], int num, int64_t time_us)
+{
+    if (points == nullptr) {
+        num = 0;
+    }
+
+    std::array<bool, CONTACTS_MAX_NUM> is_pressed = {};
+    for (int i = 0; (i < num) && (i < CONTACTS_MAX_NUM); i++) {
+        TouchPoint &point = points[i];
+        int index = ((point.id >= 0) && (point.id < CONTACTS_MAX_NUM)) ? point.id : i;
+        if (is_pressed[index]) {
+            // Tracked and untracked points mixed up, leave it unpredicted
+            continue;
+        }
+        is_pressed[index] = true;
+
+        Contact &contact = _contacts[index];
+        int64_t period_us = time_us - contact.time_us;
+        if ((contact.sample_num == 0) || (period_us > static_cast<int64_t>(PERIOD_MAX_MS) * 1000)) {
+            // Start over, the velocity is unknown
+            contact = Contact();
+            contact.sample_num = 1;
+            contact.time_us = time_us;
+            contact.x.position = point.x;
+            contact.y.position = point.y;
+            continue;
+        }
+        // Read twice in the same time, keep the estimates
+        if (period_us > 0) {
+            updateAxis(contact.x, contact.sample_num, point.x, period_us);
+            updateAxis(contact.y, contact.sample_num, point.y, period_us);
+            contact.sample_num++;
+            contact.time_us = time_us;
+        }
+
+        int64_t dx = extrapolate(contact.x);
+        int64_t dy = extrapolate(contact.y);
+        if (_config.distance_max > 0) {
+            int64_t distance = utils::distance(dx, dy);
+            int64_t distance_max = static_cast<int64_t>(_config.distance_max) << FRAC_BITS;
+            if (distance > distance_max) {
+                dx = dx * distance_max / distance;
+                dy = dy * distance_max / distance;
+            }
+        }
+        int64_t x = point.x + ((dx + (1 << (FRAC_BITS - 1))) >> FRAC_BITS);
+        int64_t y = point.y + ((dy + (1 << (FRAC_BITS - 1))) >> FRAC_BITS);
+        point.x = static_cast<int>((_x_max > 0) ? clamp(x, 0, _x_max) : x);
+        point.y = static_cast<int>((_y_max > 0) ? clamp(y, 0, _y_max) : y);
+    }
+
+    // Lifted
+    for (int i = 0; i < CONTACTS_MAX_NUM; i++) {
+        if (!is_pressed[i]) {
+            _contacts[i].sample_num = 0;
+        }
+    }
+}
+
+void TouchPredictor::updateAxis(Axis &axis, uint32_t sample_num, int position, int64_t period_us) const
+{
+    int64_t velocity = (static_cast<int64_t>(position - axis.position) << FRAC_BITS) * US_PER_S / period_us;
+    velocity = clamp(velocity, -VELOCITY_MAX, VELOCITY_MAX);
+    axis.position = position;
+    if (sample_num == 1) {
+        // The first estimate of the velocity, the acceleration is still unknown
+        axis.velocity = velocity;
+        axis.acceleration = 0;
+        return;
+    }
+
+    int64_t velocity_last = axis.velocity;
+    axis.velocity += (velocity - axis.velocity) * _config.smoothing_percent / 100;
+    int64_t acceleration = (axis.velocity - velocity_last) * US_PER_S / period_us;
+    acceleration = clamp(acceleration, -ACCELERATION_MAX, ACCELERATION_MAX);
+    axis.acceleration += (acceleration - axis.acceleration) * _config.smoothing_percent / 100;
+}
+
+int64_t TouchPredictor::extrapolate(const Axis &axis) const
+{
+    // `v * t + a * t^2 / 2`, in two steps to stay in range
+    int64_t horizon_us = static_cast<int64_t>(_config.horizon_ms) * 1000;
+    int64_t offset = axis.velocity * horizon_us / US_PER_S;
+    if (_config.acceleration_percent > 0) {
+        int64_t velocity_change = axis.acceleration * horizon_us / US_PER_S;
+        offset += velocity_change * horizon_us / US_PER_S * _config.acceleration_percent / 200;
+    }
+
+    return offset;
+}
+
+} // namespace esp_panel::drivers
@@ -0,0 +1,150 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "esp_panel_touch_conf_internal.h"
+#include "esp_panel_touch_point.hpp"
+
+namespace esp_panel::drivers {
+
+/**
+ * @brief Motion predictor of the touch points
+ *
+ * The latency of a drag on the screen is the poll period of the touch plus the render and the flush of the UI. The
+ * predictor moves each point to where it is expected after a horizon, to hide a part of that latency. The velocity
+ * and the acceleration are estimated from the timestamped points by exponential smoothing, then the point is
+ * extrapolated by `v * t + a * t^2 / 2`, limited to a distance and clamped to the screen.
+ *
+ * The state is kept per contact, by the `id` of the point from `TouchTracker`, or by its index in the read if it is
+ * untracked. A contact starts over when it is lifted or not read for `PERIOD_MAX_MS`, its first point is not
+ * predicted. It should run after `TouchFilter`, since the noise is amplified by the extrapolation. All the math is in
+ * integers and the state is a fixed size member, so predicting neither allocates nor uses the FPU.
+ *
+ * This class doesn't lock, the caller should protect it.
+ */
+class TouchPredictor {
+public:
+    static constexpr int CONTACTS_MAX_NUM = ESP_PANEL_DRIVERS_TOUCH_MAX_POINTS;
+    static constexpr int HORIZON_MAX_MS = 200;
+    static constexpr int PERIOD_MAX_MS = 100;
+
+    /**
+     * @brief Predictor configuration
+     */
+    struct Config {
+        /**
+         * @brief Check if the prediction is enabled
+         *
+         * @return `true` if enabled, `false` otherwise
+         */
+        bool isEnabled() const
+        {
+            return (horizon_ms > 0);
+        }
+
+        /**
+         * @brief Check if the parameters are in range
+         *
+         * @return `true` if valid, `false` otherwise
+         */
+        bool isValid() const
+        {
+            return (horizon_ms >= 0) && (horizon_ms <= HORIZON_MAX_MS) && (smoothing_percent >= 1) &&
+                   (smoothing_percent <= 100) && (acceleration_percent >= 0) && (acceleration_percent <= 100) &&
+                   (distance_max >= 0);
+        }
+
+        int horizon_ms = 0;             /*!< Time to predict ahead in milliseconds, up to `HORIZON_MAX_MS`. `0`
+                                             disables it */
+        int smoothing_percent = 50;     /*!< Weight of a new estimate of the velocity and the acceleration, in
+                                             [1, 100]. `100` disables the smoothing */
+        int acceleration_percent = 0;   /*!< Weight of the acceleration in the extrapolation, in [0, 100]. `0` only
+                                             uses the velocity */
+        int distance_max = 0;           /*!< Longest move of a point by the prediction in pixels, `0` for no limit */
+    };
+
+    /**
+     * @brief Set the configuration and reset the state
+     *
+     * @param[in] config Predictor configuration
+     * @return `true` if successful, `false` if the configuration is invalid
+     */
+    bool configure(const Config &config);
+
+    /**
+     * @brief Set the bounds of the predicted points, which are clamped to [0, `x_max`] x [0, `y_max`]
+     *
+     * @param[in] x_max Maximum X coordinate, `0` for no bound
+     * @param[in] y_max Maximum Y coordinate, `0` for no bound
+     */
+    void setBounds(int x_max, int y_max)
+    {
+        _x_max = x_max;
+        _y_max = y_max;
+    }
+
+    /**
+     * @brief Reset the state of all the contacts, as if they were lifted
+     */
+    void reset();
+
+    /**
+     * @brief Predict the points of a read in place
+     *
+     * @param[in,out] points Points of the read, the `id` of a point (or its index if untracked) is its contact
+     * @param[in] num Number of the points, the contacts without point are lifted
+     * @param[in] time_us Time of the read in microseconds
+     */
+    void process(TouchPoint points[], int num, int64_t time_us);
+
+    /**
+     * @brief Check if the prediction is enabled
+     *
+     * @return `true` if enabled, `false` otherwise
+     */
+    bool isEnabled() const
+    {
+        return _config.isEnabled();
+    }
+
+    /**
+     * @brief Get the configuration
+     *
+     * @return Configuration
+     */
+    const Config &getConfig() const
+    {
+        return _config;
+    }
+
+private:
+    /* Velocities are in Q8 pixels per second, accelerations in Q8 pixels per second squared */
+    struct Axis {
+        int position = 0;
+        int64_t velocity = 0;
+        int64_t acceleration = 0;
+    };
+
+    struct Contact {
+        uint32_t sample_num = 0;
+        int64_t time_us = 0;
+        Axis x;
+        Axis y;
+    };
+
+    void updateAxis(Axis &axis, uint32_t sample_num, int position, int64_t period_us) const;
+    int64_t extrapolate(const Axis &axis) const;
+
+    Config _config = {};
+    int _x_max = 0;
+    int _y_max = 0;
+    std::array<Contact, CONTACTS_MAX_NUM> _contacts = {};
+};
+
+} // namespace esp_panel::drivers
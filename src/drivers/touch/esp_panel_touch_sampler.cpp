@@ -0,0 +1,71 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "esp_panel_touch_sampler.hpp"
+
+namespace esp_panel::drivers {
+
+bool TouchSampler::configure(const Config &config, bool has_interrupt)
+{
+    if (!config.isValid()) {
+        return false;
+    }
+
+    _config = config;
+    _has_interrupt = has_interrupt && config.use_interrupt;
+
+    return true;
+}
+
+void TouchSampler::reset(int64_t time_us)
+{
+    // Read right away, then go on from the result
+    _mode = getIdleMode();
+    _period_ms = 0;
+    _is_pressed = false;
+    _start_time_us = time_us;
+    _last_read_time_us = time_us;
+    _stats = {};
+}
+
+void TouchSampler::onRead(int64_t time_us, int64_t bus_time_us, bool is_pressed, bool is_woken)
+{
+    _stats.read_count++;
+    _stats.interrupt_count += is_woken ? 1 : 0;
+    _stats.bus_time_us += bus_time_us;
+    if (_is_pressed) {
+        _stats.burst_read_count++;
+        _stats.burst_time_us += time_us - _last_read_time_us;
+    }
+    _is_pressed = is_pressed;
+    _last_read_time_us = time_us;
+
+    if (is_pressed) {
+        _mode = Mode::BURST;
+        _period_ms = _config.burst_period_ms;
+    } else if (_has_interrupt) {
+        _mode = Mode::INTERRUPT;
+        _period_ms = _config.idle_period_ms;
+    } else {
+        // Double the period from the burst one, up to the idle one
+        _mode = Mode::BACKOFF;
+        int period_ms = _period_ms * 2;
+        _period_ms = (period_ms < _config.burst_period_ms) ? _config.burst_period_ms :
+                     ((period_ms > _config.idle_period_ms) ? _config.idle_period_ms : period_ms);
+    }
+}
+
+TouchSampler::Stats TouchSampler::getStats(int64_t time_us) const
+{
+    Stats stats = _stats;
+    stats.mode = _mode;
+    stats.period_ms = _period_ms;
+    stats.elapsed_us = time_us - _start_time_us;
+
+    return stats;
+}
+
+} // namespace esp_panel::drivers
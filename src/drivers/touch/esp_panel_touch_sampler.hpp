@@ -0,0 +1,186 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace esp_panel::drivers {
+
+/**
+ * @brief Scheduler of the reads of the touch sampling task, see `Touch::startSampling()`
+ *
+ * It picks the time of the next read from the result of the previous one:
+ *  1. Burst: while a contact is pressed, the controller is read every `burst_period_ms`
+ *  2. Back-off: after the release, the period doubles on each read without contact, up to `idle_period_ms`. A new
+ *     press is caught quickly at first, then the bus is left alone
+ *  3. Interrupt: after the release, if the touch has an interrupt pin, the task waits for it. It still reads every
+ *     `idle_period_ms` in case an edge is missed
+ *
+ * It also counts the reads and the time spent on the bus. This class doesn't lock, the caller should protect it.
+ */
+class TouchSampler {
+public:
+    static constexpr int PERIOD_MAX_MS = 10000;
+
+    /**
+     * @brief Sampling mode
+     */
+    enum class Mode : uint8_t {
+        INTERRUPT = 0,  /*!< Wait for the interrupt, no contact is pressed */
+        BURST,          /*!< Poll at the burst rate, a contact is pressed */
+        BACKOFF,        /*!< Poll slower and slower, no contact is pressed */
+    };
+
+    /**
+     * @brief Sampling configuration
+     */
+    struct Config {
+        /**
+         * @brief Check if the parameters are in range
+         *
+         * @return `true` if valid, `false` otherwise
+         */
+        bool isValid() const
+        {
+            return (burst_period_ms > 0) && (idle_period_ms >= burst_period_ms) && (idle_period_ms <= PERIOD_MAX_MS) &&
+                   (task_stack_size > 0);
+        }
+
+        int burst_period_ms = 10;       /*!< Period of the reads while a contact is pressed */
+        int idle_period_ms = 200;       /*!< Longest period of the reads while no contact is pressed */
+        bool use_interrupt = true;      /*!< Wait for the interrupt while no contact is pressed, if the touch has one */
+        int task_priority = 5;          /*!< Priority of the sampling task */
+        int task_stack_size = 4096;     /*!< Stack size of the sampling task in bytes */
+        int task_core_id = -1;          /*!< Core of the sampling task, `-1` for no affinity */
+    };
+
+    /**
+     * @brief Sampling counters
+     */
+    struct Stats {
+        /**
+         * @brief Get the average sample rate
+         *
+         * @return Reads per second, `0` if nothing was measured
+         */
+        int getSampleRateHz() const
+        {
+            return (elapsed_us > 0) ? static_cast<int>(static_cast<int64_t>(read_count) * 1000000 / elapsed_us) : 0;
+        }
+
+        /**
+         * @brief Get the sample rate while a contact is pressed
+         *
+         * @return Reads per second, `0` if nothing was measured
+         */
+        int getBurstSampleRateHz() const
+        {
+            return (burst_time_us > 0) ?
+                   static_cast<int>(static_cast<int64_t>(burst_read_count) * 1000000 / burst_time_us) : 0;
+        }
+
+        /**
+         * @brief Get the share of the time the bus is used by the reads
+         *
+         * @return Bus load in 1/1000
+         */
+        int getBusLoadPermille() const
+        {
+            return (elapsed_us > 0) ? static_cast<int>(bus_time_us * 1000 / elapsed_us) : 0;
+        }
+
+        Mode mode = Mode::BACKOFF;      /*!< Current mode */
+        int period_ms = 0;              /*!< Current period of the reads, the watchdog period in interrupt mode */
+        uint32_t read_count = 0;        /*!< Number of the reads */
+        uint32_t interrupt_count = 0;   /*!< Number of the reads woken by the interrupt */
+        uint32_t burst_read_count = 0;  /*!< Number of the reads which followed a read with a contact pressed */
+        int64_t burst_time_us = 0;      /*!< Time from a read with a contact pressed to the next read */
+        int64_t bus_time_us = 0;        /*!< Time spent reading the controller */
+        int64_t elapsed_us = 0;         /*!< Time since the start */
+    };
+
+    /**
+     * @brief Set the configuration
+     *
+     * @param[in] config Sampling configuration
+     * @param[in] has_interrupt Whether the touch has an interrupt pin
+     * @return `true` if successful, `false` if the configuration is invalid
+     */
+    bool configure(const Config &config, bool has_interrupt);
+
+    /**
+     * @brief Reset the mode and the counters
+     *
+     * @param[in] time_us Current time in microseconds
+     */
+    void reset(int64_t time_us);
+
+    /**
+     * @brief Record a read, then schedule the next one
+     *
+     * @param[in] time_us Start time of the read in microseconds
+     * @param[in] bus_time_us Duration of the read of the controller in microseconds
+     * @param[in] is_pressed Whether a contact (point or button) is pressed
+     * @param[in] is_woken Whether the read was woken by the interrupt
+     */
+    void onRead(int64_t time_us, int64_t bus_time_us, bool is_pressed, bool is_woken);
+
+    /**
+     * @brief Get the time of the next read, the interrupt may wake it earlier in interrupt mode
+     *
+     * @return Time in microseconds
+     */
+    int64_t getNextReadTimeUs() const
+    {
+        return _last_read_time_us + static_cast<int64_t>(_period_ms) * 1000;
+    }
+
+    /**
+     * @brief Get the current mode
+     *
+     * @return Sampling mode
+     */
+    Mode getMode() const
+    {
+        return _mode;
+    }
+
+    /**
+     * @brief Get a snapshot of the counters
+     *
+     * @param[in] time_us Current time in microseconds
+     * @return Sampling counters
+     */
+    Stats getStats(int64_t time_us) const;
+
+    /**
+     * @brief Get the configuration
+     *
+     * @return Configuration
+     */
+    const Config &getConfig() const
+    {
+        return _config;
+    }
+
+private:
+    Mode getIdleMode() const
+    {
+        return _has_interrupt ? Mode::INTERRUPT : Mode::BACKOFF;
+    }
+
+    Config _config = {};
+    bool _has_interrupt = false;
+    Mode _mode = Mode::BACKOFF;
+    int _period_ms = 0;
+    bool _is_pressed = false;
+    int64_t _start_time_us = 0;
+    int64_t _last_read_time_us = 0;
+    Stats _stats = {};
+};
+
+} // namespace esp_panel::drivers
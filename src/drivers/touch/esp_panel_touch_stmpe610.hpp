@@ -28,6 +28,16 @@ public:
         .max_points_num = 1,
     };
 
+    /**
+     * @brief Recommended jitter filter, not applied by default. Apply it with `configFilter()`
+     */
+    static constexpr TouchFilter::Config FILTER_CONFIG_RECOMMENDED = {
+        .median_size = 5,
+        .one_euro_min_cutoff_mhz = 1000,
+        .one_euro_beta_micro = 40000,
+        .dead_zone = 1,
+    };
+
     /**
      * @brief Construct a touch device instance with individual configuration parameters
      *
@@ -0,0 +1,137 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "esp_panel_touch_tracker.hpp"
+
+namespace esp_panel::drivers {
+
+using Phase = TouchContact::Phase;
+
+bool TouchTracker::configure(const Config &config)
+{
+    if (!config.isValid()) {
+        return false;
+    }
+
+    _config = config;
+    reset();
+
+    return true;
+}
+
+void TouchTracker::process(TouchPoint points[], int num)
+{
+    if ((points == nullptr) || (num < 0)) {
+        num = 0;
+    } else if (num > CONTACTS_MAX_NUM) {
+        num = CONTACTS_MAX_NUM;
+    }
+
+    // The contacts released in the previous read are gone
+    for (auto &contact : _contacts) {
+        if (contact.phase == Phase::UP) {
+            contact.phase = Phase::NONE;
+        }
+    }
+
+    // Greedy matching, the closest pair of a pressed contact and a point first. At most 10 x 10 pairs per round, so
+    // searching them again is cheaper than sorting them
+    std::array<bool, CONTACTS_MAX_NUM> is_contact_matched = {};
+    std::array<bool, CONTACTS_MAX_NUM> is_point_matched = {};
+    int64_t distance_max_sq = static_cast<int64_t>(_config.distance_max) * _config.distance_max;
+    while (true) {
+        int64_t best_distance_sq = -1;
+        int best_id = 0;
+        int best_index = 0;
+        for (int id = 0; id < CONTACTS_MAX_NUM; id++) {
+            const TouchContact &contact = _contacts[id];
+            if ((contact.phase == Phase::NONE) || is_contact_matched[id]) {
+                continue;
+            }
+            for (int i = 0; i < num; i++) {
+                if (is_point_matched[i]) {
+                    continue;
+                }
+                int64_t dx = points[i].x - contact.point.x;
+                int64_t dy = points[i].y - contact.point.y;
+                int64_t distance_sq = dx * dx + dy * dy;
+                if ((_config.distance_max > 0) && (distance_sq > distance_max_sq)) {
+                    continue;
+                }
+                if ((best_distance_sq < 0) || (distance_sq < best_distance_sq)) {
+                    best_distance_sq = distance_sq;
+                    best_id = id;
+                    best_index = i;
+                }
+            }
+        }
+        if (best_distance_sq < 0) {
+            break;
+        }
+
+        is_contact_matched[best_id] = true;
+        is_point_matched[best_index] = true;
+        points[best_index].id = best_id;
+        _contacts[best_id].phase = Phase::MOVE;
+        _contacts[best_id].point = points[best_index];
+    }
+
+    // The contacts without point are released, they keep their last position
+    for (int id = 0; id < CONTACTS_MAX_NUM; id++) {
+        if ((_contacts[id].phase != Phase::NONE) && !is_contact_matched[id]) {
+            _contacts[id].phase = Phase::UP;
+        }
+    }
+
+    // The points without contact are pressed, with the lowest free IDs. The IDs released in this read are only taken
+    // when no other is free, then their `UP` phase is lost
+    for (int i = 0; i < num; i++) {
+        if (is_point_matched[i]) {
+            continue;
+        }
+        int free_id = -1;
+        for (int id = 0; id < CONTACTS_MAX_NUM; id++) {
+            if (_contacts[id].phase == Phase::NONE) {
+                free_id = id;
+                break;
+            }
+            if ((free_id < 0) && (_contacts[id].phase == Phase::UP)) {
+                free_id = id;
+            }
+        }
+        if (free_id < 0) {
+            points[i].id = -1;
+            continue;
+        }
+        points[i].id = free_id;
+        _contacts[free_id].phase = Phase::DOWN;
+        _contacts[free_id].point = points[i];
+    }
+}
+
+void TouchTracker::reset()
+{
+    for (auto &contact : _contacts) {
+        contact = TouchContact();
+    }
+}
+
+int TouchTracker::getContacts(TouchContact contacts[], int num) const
+{
+    int contacts_num = 0;
+    for (const auto &contact : _contacts) {
+        if (contacts_num >= num) {
+            break;
+        }
+        if (contact.phase != Phase::NONE) {
+            contacts[contacts_num++] = contact;
+        }
+    }
+
+    return contacts_num;
+}
+
+} // namespace esp_panel::drivers
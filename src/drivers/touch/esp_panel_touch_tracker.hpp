@@ -0,0 +1,134 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "esp_panel_touch_conf_internal.h"
+#include "esp_panel_touch_point.hpp"
+
+namespace esp_panel::drivers {
+
+/**
+ * @brief A tracked contact, see `TouchTracker`
+ */
+struct TouchContact {
+    /**
+     * @brief Phase of the contact in the latest read
+     */
+    enum class Phase : uint8_t {
+        NONE = 0,   /*!< Not pressed */
+        DOWN,       /*!< Pressed in this read */
+        MOVE,       /*!< Still pressed, it may or may not have moved */
+        UP,         /*!< Released in this read, the point is its last position */
+    };
+
+    Phase phase = Phase::NONE;  /*!< Phase */
+    TouchPoint point;           /*!< Point, its `id` is the ID of the contact */
+};
+
+/**
+ * @brief Frame-to-frame tracker of the touch contacts
+ *
+ * Most controllers report the points in their own order, so the index of a finger changes when another one is
+ * pressed or released. The tracker matches the points of a read with the contacts of the previous one by the nearest
+ * neighbour (greedy, shortest distance first), and gives each contact an ID which is stable while it is pressed. The
+ * IDs are the lowest free ones in [0, `CONTACTS_MAX_NUM`), like the slots of the multi-touch protocol of Linux, so
+ * they can index an array.
+ *
+ * The state is a fixed size member, and the matching is in integers, so tracking neither allocates nor uses the FPU.
+ *
+ * This class doesn't lock, the caller should protect it.
+ */
+class TouchTracker {
+public:
+    static constexpr int CONTACTS_MAX_NUM = ESP_PANEL_DRIVERS_TOUCH_MAX_POINTS;
+
+    /**
+     * @brief Tracker configuration
+     */
+    struct Config {
+        /**
+         * @brief Check if the configuration is valid
+         *
+         * @return `true` if valid, `false` otherwise
+         */
+        bool isValid() const
+        {
+            return (distance_max >= 0);
+        }
+
+        int distance_max = 0;   /*!< Longest move of a contact between two reads in pixels, a farther point is a new
+                                     contact. `0` for no limit */
+    };
+
+    TouchTracker() = default;
+
+    /**
+     * @brief Construct a tracker with the configuration
+     *
+     * @param[in] config Tracker configuration
+     */
+    explicit TouchTracker(const Config &config): _config(config) {}
+
+    /**
+     * @brief Change the configuration, then reset the state
+     *
+     * @param[in] config Tracker configuration
+     * @return `true` if successful, `false` if the configuration is invalid
+     */
+    bool configure(const Config &config);
+
+    /**
+     * @brief Match the points of a read with the contacts, then set their `id`
+     *
+     * @param[in,out] points Points of the read
+     * @param[in] num Number of the points, the contacts without point are released
+     */
+    void process(TouchPoint points[], int num);
+
+    /**
+     * @brief Reset the state, as if all the contacts were released without `UP` phase
+     */
+    void reset();
+
+    /**
+     * @brief Get a contact by its ID
+     *
+     * @param[in] id Contact ID, in [0, `CONTACTS_MAX_NUM`)
+     * @return Contact
+     */
+    const TouchContact &getContact(int id) const
+    {
+        return _contacts[id];
+    }
+
+    /**
+     * @brief Get the contacts of the latest read which are not in the `NONE` phase, in the order of their IDs
+     *
+     * @param[out] contacts Buffer to store the contacts
+     * @param[in] num Maximum number of contacts to store
+     * @return Number of the contacts stored
+     */
+    int getContacts(TouchContact contacts[], int num) const;
+
+    /**
+     * @brief Get the configuration
+     *
+     * @return Configuration
+     */
+    const Config &getConfig() const
+    {
+        return _config;
+    }
+
+private:
+    Config _config = {};
+    std::array<TouchContact, CONTACTS_MAX_NUM> _contacts = {};
+};
+
+} // namespace esp_panel::drivers
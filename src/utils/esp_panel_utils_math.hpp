@@ -0,0 +1,91 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace esp_panel::utils {
+
+/**
+ * @brief Integer square root, rounded down
+ *
+ * @param[in] value Value
+ * @return Square root
+ */
+inline uint64_t isqrt(uint64_t value)
+{
+    uint64_t root = 0;
+    uint64_t bit = 1ULL << 62;
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return root;
+}
+
+/**
+ * @brief Integer distance between two points
+ *
+ * @param[in] dx Difference of the X coordinates
+ * @param[in] dy Difference of the Y coordinates
+ * @return Distance, rounded down
+ */
+inline int64_t distance(int64_t dx, int64_t dy)
+{
+    return static_cast<int64_t>(isqrt(static_cast<uint64_t>(dx * dx + dy * dy)));
+}
+
+/**
+ * @brief Angle of a vector without floating point, like `atan2()`
+ *
+ * A table of 33 entries on the first octant is interpolated, the error is below 0.1 degree.
+ *
+ * @param[in] y Y component
+ * @param[in] x X component
+ * @return Angle in hundredths of a degree, in (-18000, 18000]. `0` for the null vector
+ */
+inline int32_t atan2_centidegrees(int64_t y, int64_t x)
+{
+    static constexpr int32_t ATAN_TABLE[] = {
+        0, 179, 358, 536, 713, 888, 1062, 1234, 1404, 1571, 1735, 1897, 2056, 2211, 2363, 2511, 2657, 2798, 2936,
+        3070, 3201, 3327, 3451, 3571, 3687, 3800, 3909, 4016, 4119, 4218, 4315, 4409, 4500,
+    };
+
+    if ((x == 0) && (y == 0)) {
+        return 0;
+    }
+
+    // Reduce to the first octant, then interpolate the table with the ratio in 1/1024
+    int64_t ax = (x < 0) ? -x : x;
+    int64_t ay = (y < 0) ? -y : y;
+    bool is_swapped = (ay > ax);
+    int64_t ratio = is_swapped ? (ax * 1024 / ay) : (ay * 1024 / ax);
+    int index = static_cast<int>(ratio >> 5);
+    int32_t angle = ATAN_TABLE[index];
+    if (index < 32) {
+        angle += static_cast<int32_t>((ATAN_TABLE[index + 1] - ATAN_TABLE[index]) * (ratio & 31) / 32);
+    }
+
+    if (is_swapped) {
+        angle = 9000 - angle;
+    }
+    if (x < 0) {
+        angle = 18000 - angle;
+    }
+
+    return (y < 0) ? -angle : angle;
+}
+
+} // namespace esp_panel::utils
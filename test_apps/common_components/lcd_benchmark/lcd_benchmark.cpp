@@ -0,0 +1,460 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_panel_versions.h"
+#include "lcd_benchmark.hpp"
+
+using namespace esp_panel::drivers;
+
+static const char *TAG = "lcd_benchmark";
+
+static const int STRIP_LINES[] = {10, 20, 40, 80};
+static const int SMALL_RECT_SIZE_MIN = 8;
+
+namespace {
+
+class LatencyRecorder {
+public:
+    explicit LatencyRecorder(int num)
+    {
+        _latencies.reserve(num);
+    }
+
+    void add(int64_t latency_us)
+    {
+        _latencies.push_back(static_cast<uint32_t>(latency_us));
+    }
+
+    // Nearest rank percentiles over the sorted latencies
+    void fill(LCD_BenchmarkResult &result)
+    {
+        if (_latencies.empty()) {
+            return;
+        }
+        std::sort(_latencies.begin(), _latencies.end());
+        result.latency_p50_us = getPercentile(50);
+        result.latency_p90_us = getPercentile(90);
+        result.latency_p99_us = getPercentile(99);
+        result.latency_max_us = _latencies.back();
+    }
+
+private:
+    uint32_t getPercentile(int percent) const
+    {
+        size_t rank = (_latencies.size() * percent + 99) / 100;
+        return _latencies[(rank > 0) ? (rank - 1) : 0];
+    }
+
+    std::vector<uint32_t> _latencies;
+};
+
+struct BenchmarkContext {
+    LCD *lcd;
+    const LCD_BenchmarkConfig &config;
+    int width;
+    int height;
+    int bytes_per_pixel;
+    size_t frame_bytes;
+};
+
+} // namespace
+
+static uint32_t next_random(uint32_t &state)
+{
+    // Numerical Recipes LCG, good enough to spread the rectangles
+    state = state * 1664525U + 1013904223U;
+    return state >> 8;
+}
+
+static uint8_t *alloc_buffer(size_t size, bool prefer_internal)
+{
+    uint8_t *buffer = nullptr;
+    if (prefer_internal) {
+        buffer = static_cast<uint8_t *>(heap_caps_malloc(size, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL));
+    }
+    if (buffer == nullptr) {
+        buffer = static_cast<uint8_t *>(heap_caps_malloc(size, MALLOC_CAP_DEFAULT));
+    }
+    if (buffer != nullptr) {
+        // A non-uniform pattern so that nothing along the path can shortcut the pixels
+        for (size_t i = 0; i < size; i++) {
+            buffer[i] = static_cast<uint8_t>(i * 7 + (i >> 9));
+        }
+    }
+    return buffer;
+}
+
+static void finish_result(const BenchmarkContext &ctx, LCD_BenchmarkResult &result, int64_t start_us)
+{
+    result.time_us = esp_timer_get_time() - start_us;
+    if (result.milli_frames == 0) {
+        result.milli_frames = result.bytes * 1000 / ctx.frame_bytes;
+    }
+}
+
+static bool run_full_fill(const BenchmarkContext &ctx, std::vector<LCD_BenchmarkResult> &results)
+{
+    LCD_BenchmarkResult result;
+    result.test = "full_fill";
+    LatencyRecorder latencies(ctx.config.full_fill_num);
+
+    int64_t start_us = esp_timer_get_time();
+    for (int i = 0; i < ctx.config.full_fill_num; i++) {
+        int64_t call_us = esp_timer_get_time();
+        uint32_t color = (i & 1) ? 0xffffff : 0x3a5c7e;
+        if (!ctx.lcd->fillRect(0, 0, ctx.width, ctx.height, color, -1)) {
+            ESP_LOGE(TAG, "Fill the screen failed");
+            return false;
+        }
+        latencies.add(esp_timer_get_time() - call_us);
+        result.calls++;
+        result.bytes += ctx.frame_bytes;
+    }
+    finish_result(ctx, result, start_us);
+    latencies.fill(result);
+    results.push_back(result);
+
+    return true;
+}
+
+static bool run_strip_fill(const BenchmarkContext &ctx, int lines, std::vector<LCD_BenchmarkResult> &results)
+{
+    lines = std::min(lines, ctx.height);
+    size_t strip_size = static_cast<size_t>(ctx.width) * lines * ctx.bytes_per_pixel;
+    uint8_t *buffers[2] = {alloc_buffer(strip_size, true), alloc_buffer(strip_size, true)};
+    if ((buffers[0] == nullptr) || (buffers[1] == nullptr)) {
+        ESP_LOGW(TAG, "Skip the strips of %d lines, not enough memory", lines);
+        heap_caps_free(buffers[0]);
+        heap_caps_free(buffers[1]);
+        return true;
+    }
+
+    LCD_BenchmarkResult result;
+    result.test = "strip_fill";
+    result.param = lines;
+    int strip_num = (ctx.height + lines - 1) / lines;
+    LatencyRecorder latencies(ctx.config.strip_frame_num * strip_num);
+    // Double buffering, a buffer is filled again once its previous strip is finished
+    LCD::DrawBitmapToken tokens[2] = {};
+    int64_t submit_us[2] = {};
+    bool is_pending[2] = {};
+    bool ret = true;
+
+    int64_t start_us = esp_timer_get_time();
+    for (int frame = 0; (frame < ctx.config.strip_frame_num) && ret; frame++) {
+        for (int i = 0; i < strip_num; i++) {
+            int index = (frame * strip_num + i) & 1;
+            if (is_pending[index]) {
+                if (!ctx.lcd->waitDrawBitmapFinish(tokens[index])) {
+                    ESP_LOGE(TAG, "Wait for the strip failed");
+                    ret = false;
+                    break;
+                }
+                latencies.add(esp_timer_get_time() - submit_us[index]);
+                is_pending[index] = false;
+            }
+
+            int y_start = i * lines;
+            int height = std::min(lines, ctx.height - y_start);
+            submit_us[index] = esp_timer_get_time();
+            if (!ctx.lcd->drawBitmapAsync(0, y_start, ctx.width, height, buffers[index], &tokens[index])) {
+                ESP_LOGE(TAG, "Draw the strip failed");
+                ret = false;
+                break;
+            }
+            is_pending[index] = true;
+            result.calls++;
+            result.bytes += static_cast<size_t>(ctx.width) * height * ctx.bytes_per_pixel;
+        }
+    }
+    for (int index = 0; index < 2; index++) {
+        if (is_pending[index] && ctx.lcd->waitDrawBitmapFinish(tokens[index])) {
+            latencies.add(esp_timer_get_time() - submit_us[index]);
+        }
+    }
+    finish_result(ctx, result, start_us);
+    heap_caps_free(buffers[0]);
+    heap_caps_free(buffers[1]);
+    if (!ret) {
+        return false;
+    }
+    latencies.fill(result);
+    results.push_back(result);
+
+    return true;
+}
+
+static bool run_small_rect(const BenchmarkContext &ctx, std::vector<LCD_BenchmarkResult> &results)
+{
+    int size_max = std::max(std::min({ctx.config.small_rect_size_max, ctx.width, ctx.height}), SMALL_RECT_SIZE_MIN);
+    uint8_t *buffer = alloc_buffer(static_cast<size_t>(size_max) * size_max * ctx.bytes_per_pixel, true);
+    if (buffer == nullptr) {
+        ESP_LOGW(TAG, "Skip the small rectangles, not enough memory");
+        return true;
+    }
+
+    LCD_BenchmarkResult result;
+    result.test = "small_rect";
+    result.param = size_max;
+    LatencyRecorder latencies(ctx.config.small_rect_num);
+    uint32_t random = ctx.config.seed;
+    bool ret = true;
+
+    int64_t start_us = esp_timer_get_time();
+    for (int i = 0; i < ctx.config.small_rect_num; i++) {
+        int width = SMALL_RECT_SIZE_MIN + next_random(random) % (size_max - SMALL_RECT_SIZE_MIN + 1);
+        int height = SMALL_RECT_SIZE_MIN + next_random(random) % (size_max - SMALL_RECT_SIZE_MIN + 1);
+        int x_start = next_random(random) % (ctx.width - width + 1);
+        int y_start = next_random(random) % (ctx.height - height + 1);
+
+        int64_t call_us = esp_timer_get_time();
+        if (!ctx.lcd->drawBitmap(x_start, y_start, width, height, buffer, -1)) {
+            ESP_LOGE(TAG, "Draw the small rectangle failed");
+            ret = false;
+            break;
+        }
+        latencies.add(esp_timer_get_time() - call_us);
+        result.calls++;
+        result.bytes += static_cast<size_t>(width) * height * ctx.bytes_per_pixel;
+    }
+    finish_result(ctx, result, start_us);
+    heap_caps_free(buffer);
+    if (!ret) {
+        return false;
+    }
+    latencies.fill(result);
+    results.push_back(result);
+
+    return true;
+}
+
+static bool run_rotated_blit(const BenchmarkContext &ctx, std::vector<LCD_BenchmarkResult> &results)
+{
+    if (ctx.lcd->getStreamBufferSize() == 0) {
+        ESP_LOGW(TAG, "Skip the rotated blits, no stream buffer");
+        return true;
+    }
+    uint8_t *buffer = alloc_buffer(ctx.frame_bytes, false);
+    if (buffer == nullptr) {
+        ESP_LOGW(TAG, "Skip the rotated blits, not enough memory");
+        return true;
+    }
+
+    LCD_Transform::Operation origin = ctx.lcd->getDrawBitmapTransform();
+    LCD_Transform::Operation rotation = origin;
+    rotation.rotation = LCD_Transform::Rotation::ROTATE_90;
+    if (!ctx.lcd->setDrawBitmapTransform(rotation)) {
+        ESP_LOGW(TAG, "Skip the rotated blits, transformation not supported");
+        heap_caps_free(buffer);
+        return true;
+    }
+
+    LCD_BenchmarkResult result;
+    result.test = "rotated_blit";
+    result.param = 90;
+    LatencyRecorder latencies(ctx.config.rotated_frame_num);
+    bool ret = true;
+
+    int64_t start_us = esp_timer_get_time();
+    for (int i = 0; i < ctx.config.rotated_frame_num; i++) {
+        int64_t call_us = esp_timer_get_time();
+        // The coordinates are in the rotated space
+        if (!ctx.lcd->drawBitmap(0, 0, ctx.height, ctx.width, buffer, -1)) {
+            ESP_LOGE(TAG, "Draw the rotated frame failed");
+            ret = false;
+            break;
+        }
+        latencies.add(esp_timer_get_time() - call_us);
+        result.calls++;
+        result.bytes += ctx.frame_bytes;
+    }
+    finish_result(ctx, result, start_us);
+    ret = ctx.lcd->setDrawBitmapTransform(origin) && ret;
+    heap_caps_free(buffer);
+    if (!ret) {
+        return false;
+    }
+    latencies.fill(result);
+    results.push_back(result);
+
+    return true;
+}
+
+static bool run_fb_flip(const BenchmarkContext &ctx, std::vector<LCD_BenchmarkResult> &results)
+{
+    auto bus_type = ctx.lcd->getBus()->getBasicAttributes().type;
+    if ((bus_type != ESP_PANEL_BUS_TYPE_RGB) && (bus_type != ESP_PANEL_BUS_TYPE_MIPI_DSI)) {
+        return true;
+    }
+    void *frame_buffers[2] = {ctx.lcd->getFrameBufferByIndex(0), ctx.lcd->getFrameBufferByIndex(1)};
+    if ((frame_buffers[0] == nullptr) || (frame_buffers[1] == nullptr) || (frame_buffers[0] == frame_buffers[1])) {
+        ESP_LOGW(TAG, "Skip the frame buffer flips, at least two frame buffers are required");
+        return true;
+    }
+
+    LCD_BenchmarkResult result;
+    result.test = "fb_flip";
+    result.param = 2;
+    LatencyRecorder latencies(ctx.config.flip_num);
+    bool ret = true;
+
+    int64_t start_us = esp_timer_get_time();
+    for (int i = 0; i < ctx.config.flip_num; i++) {
+        int64_t call_us = esp_timer_get_time();
+        if (!ctx.lcd->switchFrameBufferTo(frame_buffers[(i + 1) & 1])) {
+            ESP_LOGE(TAG, "Switch the frame buffer failed");
+            ret = false;
+            break;
+        }
+        latencies.add(esp_timer_get_time() - call_us);
+        result.calls++;
+        result.milli_frames += 1000;
+    }
+    finish_result(ctx, result, start_us);
+    // Show the first frame buffer again, like before the test
+    if ((result.calls & 1) && !ctx.lcd->switchFrameBufferTo(frame_buffers[0])) {
+        ret = false;
+    }
+    if (!ret) {
+        return false;
+    }
+    latencies.fill(result);
+    results.push_back(result);
+
+    return true;
+}
+
+uint32_t LCD_BenchmarkResult::getMilliMBps() const
+{
+    // bytes / us = MB / s
+    return (time_us > 0) ? static_cast<uint32_t>(bytes * 1000 / time_us) : 0;
+}
+
+uint32_t LCD_BenchmarkResult::getCentiFps() const
+{
+    return (time_us > 0) ? static_cast<uint32_t>(milli_frames * 100000 / time_us) : 0;
+}
+
+const char *lcd_benchmark_get_bus_name(LCD *lcd)
+{
+    auto bus = lcd->getBus();
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_RGB
+    if ((bus->getBasicAttributes().type == ESP_PANEL_BUS_TYPE_RGB) &&
+            static_cast<BusRGB *>(bus)->isControlPanelUsed()) {
+        return "3WIRE_SPI+RGB";
+    }
+#endif
+
+    return bus->getBasicAttributes().name;
+}
+
+bool lcd_benchmark_run(LCD *lcd, const LCD_BenchmarkConfig &config, std::vector<LCD_BenchmarkResult> &results)
+{
+    if ((lcd == nullptr) || (lcd->getBus() == nullptr)) {
+        ESP_LOGE(TAG, "Invalid LCD");
+        return false;
+    }
+
+    BenchmarkContext ctx = {
+        .lcd = lcd,
+        .config = config,
+        .width = lcd->getFrameWidth(),
+        .height = lcd->getFrameHeight(),
+        .bytes_per_pixel = (lcd->getFrameColorBits() + 7) / 8,
+        .frame_bytes = 0,
+    };
+    ctx.frame_bytes = static_cast<size_t>(ctx.width) * ctx.height * ctx.bytes_per_pixel;
+    if (ctx.frame_bytes == 0) {
+        ESP_LOGE(TAG, "Invalid frame size");
+        return false;
+    }
+
+    ESP_LOGI(
+        TAG, "Run benchmark on %s bus, %dx%d, %d-bit", lcd_benchmark_get_bus_name(lcd), ctx.width, ctx.height,
+        lcd->getFrameColorBits()
+    );
+    results.clear();
+    if (!run_full_fill(ctx, results)) {
+        return false;
+    }
+    for (int lines : STRIP_LINES) {
+        if (!run_strip_fill(ctx, lines, results)) {
+            return false;
+        }
+    }
+    if (!run_small_rect(ctx, results)) {
+        return false;
+    }
+    if (!run_rotated_blit(ctx, results)) {
+        return false;
+    }
+    if (!run_fb_flip(ctx, results)) {
+        return false;
+    }
+
+    return true;
+}
+
+void lcd_benchmark_print(LCD *lcd, const LCD_BenchmarkConfig &config, const std::vector<LCD_BenchmarkResult> &results)
+{
+    // Avoid the float formatting, which might not be supported by the C library
+    const char *bus_name = lcd_benchmark_get_bus_name(lcd);
+    int width = lcd->getFrameWidth();
+    int height = lcd->getFrameHeight();
+    int color_bits = lcd->getFrameColorBits();
+
+    if (config.print_csv) {
+        printf(
+            "lcd_bench,version,label,bus,width,height,color_bits,test,param,calls,bytes,time_us,mbps,fps,"
+            "p50_us,p90_us,p99_us,max_us\n"
+        );
+        for (auto &result : results) {
+            uint32_t mbps = result.getMilliMBps();
+            uint32_t fps = result.getCentiFps();
+            printf(
+                "lcd_bench,%d.%d.%d,%s,%s,%d,%d,%d,%s,%d,%" PRIu32 ",%" PRIu64 ",%" PRId64 ",%" PRIu32 ".%03" PRIu32
+                ",%" PRIu32 ".%02" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 "\n",
+                ESP_PANEL_VERSION_MAJOR, ESP_PANEL_VERSION_MINOR, ESP_PANEL_VERSION_PATCH, config.label, bus_name,
+                width, height, color_bits, result.test, result.param, result.calls, result.bytes, result.time_us,
+                mbps / 1000, mbps % 1000, fps / 100, fps % 100, result.latency_p50_us, result.latency_p90_us,
+                result.latency_p99_us, result.latency_max_us
+            );
+        }
+    }
+    if (config.print_json) {
+        for (auto &result : results) {
+            uint32_t mbps = result.getMilliMBps();
+            uint32_t fps = result.getCentiFps();
+            printf(
+                "{\"bench\":\"lcd\",\"version\":\"%d.%d.%d\",\"label\":\"%s\",\"bus\":\"%s\",\"width\":%d,"
+                "\"height\":%d,\"color_bits\":%d,\"test\":\"%s\",\"param\":%d,\"calls\":%" PRIu32 ",\"bytes\":%" PRIu64
+                ",\"time_us\":%" PRId64 ",\"mbps\":%" PRIu32 ".%03" PRIu32 ",\"fps\":%" PRIu32 ".%02" PRIu32
+                ",\"p50_us\":%" PRIu32 ",\"p90_us\":%" PRIu32 ",\"p99_us\":%" PRIu32 ",\"max_us\":%" PRIu32 "}\n",
+                ESP_PANEL_VERSION_MAJOR, ESP_PANEL_VERSION_MINOR, ESP_PANEL_VERSION_PATCH, config.label, bus_name,
+                width, height, color_bits, result.test, result.param, result.calls, result.bytes, result.time_us,
+                mbps / 1000, mbps % 1000, fps / 100, fps % 100, result.latency_p50_us, result.latency_p90_us,
+                result.latency_p99_us, result.latency_max_us
+            );
+        }
+    }
+}
+
+bool lcd_benchmark(LCD *lcd, const LCD_BenchmarkConfig &config)
+{
+    std::vector<LCD_BenchmarkResult> results;
+    if (!lcd_benchmark_run(lcd, config, results)) {
+        return false;
+    }
+    lcd_benchmark_print(lcd, config, results);
+
+    return true;
+}
@@ -0,0 +1,78 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "drivers/lcd/esp_panel_lcd.hpp"
+
+/**
+ * Display benchmark, it doesn't depend on Unity so that it also runs on the host mock (see `test_apps/host`)
+ *
+ * The tests and their parameter:
+ *   - `full_fill`: `fillRect()` of the whole screen
+ *   - `strip_fill`: asynchronous strips of `param` lines from two buffers, covering the whole screen
+ *   - `small_rect`: `drawBitmap()` of random rectangles of [8, `param`] pixels wide and high
+ *   - `rotated_blit`: `drawBitmap()` of the whole screen rotated by 90 degrees while streaming
+ *   - `fb_flip`: `switchFrameBufferTo()` between two frame buffers (RGB/MIPI-DSI bus only)
+ *
+ * The tests which are not supported by the LCD (e.g. no stream buffer, a single frame buffer) are skipped.
+ */
+
+struct LCD_BenchmarkConfig {
+    const char *label = "";         // Free text to identify the run (e.g. the board), printed with the results
+    int full_fill_num = 10;
+    int strip_frame_num = 5;
+    int small_rect_num = 200;
+    int small_rect_size_max = 64;
+    int rotated_frame_num = 5;
+    int flip_num = 60;
+    uint32_t seed = 1;              // Seed of the random rectangles, the same seed gives the same rectangles
+    bool print_csv = true;          // A header line and one line per result, all starting with `lcd_bench,`
+    bool print_json = true;         // One JSON object per result and per line, all starting with `{"bench":"lcd"`
+};
+
+struct LCD_BenchmarkResult {
+    const char *test = "";
+    int param = 0;
+    uint32_t calls = 0;             // Number of the calls to the LCD
+    uint64_t bytes = 0;             // Pixel data sent
+    uint64_t milli_frames = 0;      // Full screen equivalents (or flips) in units of 0.001 frame
+    int64_t time_us = 0;            // Total time of the test
+    uint32_t latency_p50_us = 0;    // Per call latency percentiles, from the call to the finish of its drawing
+    uint32_t latency_p90_us = 0;
+    uint32_t latency_p99_us = 0;
+    uint32_t latency_max_us = 0;
+
+    // Throughput in units of 0.001 MB/s (1 MB = 1000000 bytes)
+    uint32_t getMilliMBps() const;
+    // Full screen equivalents (or flips) per second, in units of 0.01 fps
+    uint32_t getCentiFps() const;
+};
+
+/**
+ * Get the bus name of the results, "3WIRE_SPI+RGB" for the RGB bus with a 3-wire SPI control panel
+ */
+const char *lcd_benchmark_get_bus_name(esp_panel::drivers::LCD *lcd);
+
+/**
+ * Run all the tests, the LCD should be begun
+ */
+bool lcd_benchmark_run(
+    esp_panel::drivers::LCD *lcd, const LCD_BenchmarkConfig &config, std::vector<LCD_BenchmarkResult> &results
+);
+
+/**
+ * Print the results to the console in the formats of the configuration
+ */
+void lcd_benchmark_print(
+    esp_panel::drivers::LCD *lcd, const LCD_BenchmarkConfig &config, const std::vector<LCD_BenchmarkResult> &results
+);
+
+/**
+ * Run all the tests and print the results
+ */
+bool lcd_benchmark(esp_panel::drivers::LCD *lcd, const LCD_BenchmarkConfig &config = LCD_BenchmarkConfig());
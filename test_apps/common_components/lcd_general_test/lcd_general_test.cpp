@@ -3,17 +3,27 @@
  *
  * SPDX-License-Identifier: CC0-1.0
  */
+#include <algorithm>
+#include <cstring>
 #include <memory>
 #include <thread>
+#include "esp_heap_caps.h"
 #include "esp_log.h"
 #include "esp_timer.h"
 #include "unity.h"
 #include "unity_test_runner.h"
 #include "esp_display_panel.hpp"
+#include "lcd_benchmark.hpp"
 
 #define TEST_LCD_ENABLE_PRINT_FPS               (1)
 #define TEST_LCD_ENABLE_DRAW_FINISH_CALLBACK    (1)
 #define TEST_LCD_ENABLE_DSI_PATTERN_TEST        (1)
+#define TEST_LCD_ENABLE_DRAW_ASYNC_TEST         (1)
+#define TEST_LCD_ENABLE_DRAW_PSRAM_TEST         (1)
+#define TEST_LCD_ENABLE_DRAW_CONVERT_TEST       (1)
+#define TEST_LCD_ENABLE_FILL_TEST               (1)
+#define TEST_LCD_ENABLE_PRINT_STATS             (1)
+#define TEST_LCD_ENABLE_BENCHMARK               (1)
 #define TEST_LCD_COLOR_BAR_SHOW_TIME_MS     (5000)
 
 #define delay(x)     vTaskDelay(pdMS_TO_TICKS(x))
@@ -54,6 +64,140 @@ IRAM_ATTR bool onLCD_RefreshFinishCallback(void *user_data)
 }
 #endif
 
+#if TEST_LCD_ENABLE_DRAW_ASYNC_TEST
+#define TEST_LCD_DRAW_ASYNC_STRIP_HEIGHT   (20)
+#define TEST_LCD_DRAW_ASYNC_BUFFER_NUM     (2)
+
+static void test_draw_bitmap_async(LCD *lcd)
+{
+    int width = lcd->getFrameWidth();
+    int height = lcd->getFrameHeight();
+    int bytes_per_pixel = (lcd->getFrameColorBits() + 7) / 8;
+    int strip_bytes = width * TEST_LCD_DRAW_ASYNC_STRIP_HEIGHT * bytes_per_pixel;
+
+    ESP_LOGI(TAG, "Draw strips asynchronously, queue depth: %d", lcd->getDrawBitmapQueueDepth());
+
+    std::shared_ptr<uint8_t> buffers[TEST_LCD_DRAW_ASYNC_BUFFER_NUM];
+    LCD::DrawBitmapToken tokens[TEST_LCD_DRAW_ASYNC_BUFFER_NUM] = {};
+    for (int i = 0; i < TEST_LCD_DRAW_ASYNC_BUFFER_NUM; i++) {
+        buffers[i] = std::shared_ptr<uint8_t>(
+            static_cast<uint8_t *>(heap_caps_malloc(strip_bytes, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL)), heap_caps_free
+        );
+        TEST_ASSERT_NOT_NULL_MESSAGE(buffers[i], "Allocate strip buffer failed");
+    }
+
+    int64_t start_us = esp_timer_get_time();
+    for (int y = 0, n = 0; y < height; y += TEST_LCD_DRAW_ASYNC_STRIP_HEIGHT, n++) {
+        int index = n % TEST_LCD_DRAW_ASYNC_BUFFER_NUM;
+        // Render strip N+1 into the other buffer while strip N is still being transmitted
+        if (n >= TEST_LCD_DRAW_ASYNC_BUFFER_NUM) {
+            TEST_ASSERT_TRUE_MESSAGE(lcd->waitDrawBitmapFinish(tokens[index]), "Wait draw bitmap finish failed");
+        }
+        memset(buffers[index].get(), (n & 1) ? 0xff : 0x00, strip_bytes);
+        int strip_height = std::min(TEST_LCD_DRAW_ASYNC_STRIP_HEIGHT, height - y);
+        TEST_ASSERT_TRUE_MESSAGE(
+            lcd->drawBitmapAsync(0, y, width, strip_height, buffers[index].get(), &tokens[index]),
+            "Draw bitmap async failed"
+        );
+    }
+    TEST_ASSERT_TRUE_MESSAGE(lcd->waitDrawBitmapFinishAll(), "Wait all draw bitmap finish failed");
+    ESP_LOGI(TAG, "Draw strips asynchronously done, time: %d us", (int)(esp_timer_get_time() - start_us));
+}
+#endif
+
+#if TEST_LCD_ENABLE_DRAW_PSRAM_TEST && CONFIG_SPIRAM
+static void test_draw_bitmap_from_psram(LCD *lcd)
+{
+    auto bus_type = lcd->getBus()->getBasicAttributes().type;
+    if ((bus_type == ESP_PANEL_BUS_TYPE_RGB) || (bus_type == ESP_PANEL_BUS_TYPE_MIPI_DSI)) {
+        return;
+    }
+
+    int width = lcd->getFrameWidth();
+    int height = lcd->getFrameHeight();
+    int frame_bytes = width * height * ((lcd->getFrameColorBits() + 7) / 8);
+
+    ESP_LOGI(TAG, "Draw a full frame from PSRAM");
+
+    std::shared_ptr<uint8_t> frame(
+        static_cast<uint8_t *>(heap_caps_malloc(frame_bytes, MALLOC_CAP_SPIRAM)), heap_caps_free
+    );
+    TEST_ASSERT_NOT_NULL_MESSAGE(frame, "Allocate frame buffer in PSRAM failed");
+    memset(frame.get(), 0xaa, frame_bytes);
+
+    int64_t start_us = esp_timer_get_time();
+    TEST_ASSERT_TRUE_MESSAGE(lcd->drawBitmap(0, 0, width, height, frame.get(), -1), "Draw bitmap from PSRAM failed");
+    ESP_LOGI(TAG, "Draw a full frame from PSRAM done, time: %d us", (int)(esp_timer_get_time() - start_us));
+}
+#endif
+
+#if TEST_LCD_ENABLE_DRAW_CONVERT_TEST
+#define TEST_LCD_DRAW_CONVERT_BAND_HEIGHT  (20)
+
+static void test_draw_bitmap_convert(LCD *lcd)
+{
+    int bits = lcd->getFrameColorBits();
+    if ((lcd->getStreamBufferSize() == 0) || ((bits != 16) && (bits != 18))) {
+        return;
+    }
+
+    int width = lcd->getFrameWidth();
+    int height = lcd->getFrameHeight();
+
+    ESP_LOGI(TAG, "Draw a RGB888 gradient with dithering");
+
+    // Horizontal gradient from black to white, the same band is drawn from top to bottom
+    int band_height = TEST_LCD_DRAW_CONVERT_BAND_HEIGHT;
+    std::shared_ptr<uint8_t> band(new uint8_t[width * band_height * 3], std::default_delete<uint8_t[]>());
+    TEST_ASSERT_NOT_NULL_MESSAGE(band, "Allocate band buffer failed");
+    for (int y = 0; y < band_height; y++) {
+        for (int x = 0; x < width; x++) {
+            memset(band.get() + (y * width + x) * 3, x * 255 / std::max(width - 1, 1), 3);
+        }
+    }
+
+    TEST_ASSERT_TRUE_MESSAGE(lcd->setDrawBitmapDither(true), "Enable dithering failed");
+    int64_t start_us = esp_timer_get_time();
+    for (int y = 0; y < height; y += band_height) {
+        TEST_ASSERT_TRUE_MESSAGE(
+            lcd->drawBitmap(
+                0, y, width, std::min(band_height, height - y), band.get(), LCD_ColorConvert::PixelFormat::RGB888
+            ), "Draw RGB888 failed"
+        );
+    }
+    TEST_ASSERT_TRUE_MESSAGE(lcd->waitDrawBitmapFinishAll(), "Wait for drawings finish failed");
+    ESP_LOGI(TAG, "Draw a RGB888 gradient done, time: %d us", (int)(esp_timer_get_time() - start_us));
+    TEST_ASSERT_TRUE_MESSAGE(lcd->setDrawBitmapDither(false), "Disable dithering failed");
+}
+#endif
+
+#if TEST_LCD_ENABLE_FILL_TEST
+static void test_fill_rect(LCD *lcd)
+{
+    int width = lcd->getFrameWidth();
+    int height = lcd->getFrameHeight();
+
+    ESP_LOGI(TAG, "Fill the screen with solid colors");
+
+    size_t free_size = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    for (uint32_t color : {0x00000000, 0xffffffff}) {
+        int64_t start_us = esp_timer_get_time();
+        TEST_ASSERT_TRUE_MESSAGE(lcd->fillRect(0, 0, width, height, color, -1), "Fill screen failed");
+        int time_us = (int)(esp_timer_get_time() - start_us);
+        ESP_LOGI(TAG, "Fill the screen with 0x%08x done, time: %d us", (unsigned)color, time_us);
+    }
+    // Only the small fill buffer should be allocated, whatever the screen size
+    size_t used_size = free_size - heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    ESP_LOGI(TAG, "Memory used by filling: %d bytes", (int)used_size);
+    TEST_ASSERT_TRUE_MESSAGE(used_size <= LCD::FILL_BUFFER_SIZE + 64, "Filling allocated too much memory");
+
+    // A small rectangle in the middle
+    TEST_ASSERT_TRUE_MESSAGE(
+        lcd->fillRect(width / 4, height / 4, width / 2, height / 2, 0x00000000, -1), "Fill rectangle failed"
+    );
+}
+#endif
+
 #if TEST_LCD_ENABLE_DRAW_FINISH_CALLBACK
 IRAM_ATTR bool onLCD_DrawFinishCallback(void *user_data)
 {
@@ -63,6 +207,29 @@ IRAM_ATTR bool onLCD_DrawFinishCallback(void *user_data)
 }
 #endif
 
+#if TEST_LCD_ENABLE_BENCHMARK
+static void test_benchmark(LCD *lcd)
+{
+    ESP_LOGI(TAG, "Run LCD benchmark");
+
+#if TEST_LCD_ENABLE_DRAW_FINISH_CALLBACK
+    // Printing from the callback of every drawing would distort the results
+    TEST_ASSERT_TRUE_MESSAGE(
+        lcd->attachDrawBitmapFinishCallback(nullptr, (void *)&start_time), "Detach draw finish callback failed"
+    );
+#endif
+    LCD_BenchmarkConfig config;
+    config.label = TAG;
+    TEST_ASSERT_TRUE_MESSAGE(lcd_benchmark(lcd, config), "LCD benchmark failed");
+#if TEST_LCD_ENABLE_DRAW_FINISH_CALLBACK
+    TEST_ASSERT_TRUE_MESSAGE(
+        lcd->attachDrawBitmapFinishCallback(onLCD_DrawFinishCallback, (void *)&start_time),
+        "Attach draw finish callback failed"
+    );
+#endif
+}
+#endif
+
 void lcd_general_test(LCD *lcd)
 {
     ESP_LOGI(TAG, "Run LCD general test");
@@ -108,6 +275,26 @@ void lcd_general_test(LCD *lcd)
         );
 #endif
 
+#if TEST_LCD_ENABLE_DRAW_ASYNC_TEST
+        test_draw_bitmap_async(lcd);
+#endif
+#if TEST_LCD_ENABLE_DRAW_PSRAM_TEST && CONFIG_SPIRAM
+        test_draw_bitmap_from_psram(lcd);
+#endif
+#if TEST_LCD_ENABLE_DRAW_CONVERT_TEST
+        test_draw_bitmap_convert(lcd);
+#endif
+#if TEST_LCD_ENABLE_FILL_TEST
+        test_fill_rect(lcd);
+#endif
+#if TEST_LCD_ENABLE_BENCHMARK
+        test_benchmark(lcd);
+#endif
+
+#if TEST_LCD_ENABLE_PRINT_STATS && ESP_PANEL_DRIVERS_LCD_ENABLE_STATS
+        ESP_LOGI(TAG, "LCD stats:\n%s", lcd->getStats().toString().c_str());
+#endif
+
         ESP_LOGI(TAG, "Draw color bar from top left to bottom right, the order is B - G - R");
         TEST_ASSERT_TRUE_MESSAGE(lcd->colorBarTest(), "LCD color bar test failed");
 
@@ -122,6 +309,9 @@ void lcd_general_test(LCD *lcd)
         }
 #else
         vTaskDelay(pdMS_TO_TICKS(TEST_LCD_COLOR_BAR_SHOW_TIME_MS));
+#endif
+#if TEST_LCD_ENABLE_PRINT_STATS && ESP_PANEL_DRIVERS_LCD_ENABLE_STATS
+        ESP_LOGI(TAG, "LCD stats:\n%s", lcd->getStats().toString().c_str());
 #endif
     });
 
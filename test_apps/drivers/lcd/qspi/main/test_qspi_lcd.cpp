@@ -24,6 +24,7 @@ using namespace esp_panel::drivers;
 #define TEST_LCD_HEIGHT              (300)
 #define TEST_LCD_COLOR_BITS          (16)
 #define TEST_LCD_SPI_FREQ_HZ         (40 * 1000 * 1000)
+#define TEST_LCD_STREAM_BUFFER_SIZE  (TEST_LCD_WIDTH * 20 * TEST_LCD_COLOR_BITS / 8) // Set to 0 to disable streaming
 #define TEST_LCD_USE_EXTERNAL_CMD    (0)
 #if TEST_LCD_USE_EXTERNAL_CMD
 /**
@@ -164,6 +165,9 @@ static void run_test(shared_ptr<LCD> lcd, bool use_config)
 #endif
     TEST_ASSERT_TRUE_MESSAGE(lcd->init(), "LCD init failed");
     TEST_ASSERT_TRUE_MESSAGE(lcd->reset(), "LCD reset failed");
+#if TEST_LCD_STREAM_BUFFER_SIZE > 0
+    TEST_ASSERT_TRUE_MESSAGE(lcd->configStreamBufferSize(TEST_LCD_STREAM_BUFFER_SIZE), "LCD config stream failed");
+#endif
     TEST_ASSERT_TRUE_MESSAGE(lcd->begin(), "LCD begin failed");
     if (lcd->getBasicAttributes().basic_bus_spec.isFunctionValid(LCD::BasicBusSpecification::FUNC_DISPLAY_ON_OFF)) {
         TEST_ASSERT_TRUE_MESSAGE(lcd->setDisplayOnOff(true), "LCD display on failed");
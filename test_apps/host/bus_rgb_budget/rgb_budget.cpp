@@ -0,0 +1,103 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "drivers/bus/esp_panel_bus_rgb_budget.hpp"
+
+using namespace esp_panel::drivers;
+
+// Usage: rgb_budget [name=value ...], e.g. `rgb_budget pclk=18000000 h_res=800 v_res=480 bounce=8000 render=30000000`
+int main(int argc, char *argv[])
+{
+    BusRGB_Budget::Timing timing = {
+        .pclk_hz = 16 * 1000 * 1000,
+        .h_res = 800,
+        .v_res = 480,
+        .hsync_pulse_width = 4,
+        .hsync_back_porch = 8,
+        .hsync_front_porch = 8,
+        .vsync_pulse_width = 4,
+        .vsync_back_porch = 8,
+        .vsync_front_porch = 8,
+        .bits_per_pixel = 16,
+        .bounce_buffer_size_px = 0,
+    };
+    BusRGB_Budget::Model model;
+
+    struct {
+        const char *name;
+        uint32_t *value;
+    } uint_args[] = {
+        {"pclk", &timing.pclk_hz},
+        {"h_res", &timing.h_res},
+        {"v_res", &timing.v_res},
+        {"hpw", &timing.hsync_pulse_width},
+        {"hbp", &timing.hsync_back_porch},
+        {"hfp", &timing.hsync_front_porch},
+        {"vpw", &timing.vsync_pulse_width},
+        {"vbp", &timing.vsync_back_porch},
+        {"vfp", &timing.vsync_front_porch},
+        {"bpp", &timing.bits_per_pixel},
+        {"bounce", &timing.bounce_buffer_size_px},
+        {"psram", &model.psram_bytes_per_s},
+        {"render", &model.render_bytes_per_s},
+    };
+    struct {
+        const char *name;
+        int *value;
+    } int_args[] = {
+        {"headroom", &model.headroom_percent},
+        {"stall", &model.stall_us},
+    };
+    for (int i = 1; i < argc; i++) {
+        const char *value = strchr(argv[i], '=');
+        size_t name_len = (value != nullptr) ? static_cast<size_t>(value - argv[i]) : 0;
+        bool is_found = false;
+        for (auto &arg : uint_args) {
+            if ((name_len == strlen(arg.name)) && (strncmp(arg.name, argv[i], name_len) == 0)) {
+                *arg.value = strtoul(value + 1, nullptr, 0);
+                is_found = true;
+            }
+        }
+        for (auto &arg : int_args) {
+            if ((name_len == strlen(arg.name)) && (strncmp(arg.name, argv[i], name_len) == 0)) {
+                *arg.value = atoi(value + 1);
+                is_found = true;
+            }
+        }
+        if (!is_found) {
+            printf("Unknown argument: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    BusRGB_Budget::Report report;
+    if (!BusRGB_Budget::evaluate(timing, model, report)) {
+        printf("Invalid timing or model\n");
+        return 1;
+    }
+
+    printf(
+        "Timing: %ux%u, %u bpp, pclk %u Hz, porches h(%u, %u, %u) v(%u, %u, %u), bounce %u px\n",
+        timing.h_res, timing.v_res, timing.bits_per_pixel, timing.pclk_hz, timing.hsync_pulse_width,
+        timing.hsync_back_porch, timing.hsync_front_porch, timing.vsync_pulse_width, timing.vsync_back_porch,
+        timing.vsync_front_porch, timing.bounce_buffer_size_px
+    );
+    printf(
+        "Model: PSRAM %u B/s, render %u B/s, headroom %d%%, stall %d us\n", model.psram_bytes_per_s,
+        model.render_bytes_per_s, model.headroom_percent, model.stall_us
+    );
+    printf("%-28s %.2f Hz\n", "Refresh rate", report.refresh_hz);
+    printf("%-28s %u B/s\n", "Scanout", report.scanout_bytes_per_s);
+    printf("%-28s %u B/s\n", "Required (scanout + render)", report.required_bytes_per_s);
+    printf("%-28s %u B/s\n", "Available", report.available_bytes_per_s);
+    printf("%-28s %d%% (%s)\n", "Margin", report.margin_percent, report.isWithinBudget() ? "OK" : "OVER BUDGET");
+    printf("%-28s %u Hz\n", "Max pclk", report.max_pclk_hz);
+    printf("%-28s %u px\n", "Recommended bounce size", report.recommended_bounce_size_px);
+
+    return report.isWithinBudget() ? 0 : 2;
+}
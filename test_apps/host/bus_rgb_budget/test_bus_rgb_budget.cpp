@@ -0,0 +1,138 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include "host_test.hpp"
+#include "drivers/bus/esp_panel_bus_rgb_budget.hpp"
+
+using namespace esp_panel::drivers;
+
+// 800x480 RGB565 at 16 MHz, 820x500 pixels per frame including the porches
+static BusRGB_Budget::Timing make_timing()
+{
+    return BusRGB_Budget::Timing{
+        .pclk_hz = 16 * 1000 * 1000,
+        .h_res = 800,
+        .v_res = 480,
+        .hsync_pulse_width = 4,
+        .hsync_back_porch = 8,
+        .hsync_front_porch = 8,
+        .vsync_pulse_width = 4,
+        .vsync_back_porch = 8,
+        .vsync_front_porch = 8,
+        .bits_per_pixel = 16,
+        .bounce_buffer_size_px = 0,
+    };
+}
+
+TEST_CASE("Test RGB budget without bounce buffers", "[bus][rgb_budget]")
+{
+    BusRGB_Budget::Report report;
+    TEST_ASSERT_TRUE(BusRGB_Budget::evaluate(make_timing(), {}, report));
+
+    TEST_ASSERT_EQUAL(39, static_cast<int>(report.refresh_hz));
+    // The DMA reads at the pixel clock rate during the active lines
+    TEST_ASSERT_EQUAL(32000000U, report.scanout_bytes_per_s);
+    TEST_ASSERT_EQUAL(32000000U, report.required_bytes_per_s);
+    TEST_ASSERT_EQUAL(64000000U, report.available_bytes_per_s);
+    TEST_ASSERT_EQUAL(50, report.margin_percent);
+    TEST_ASSERT_EQUAL(32000000U, report.max_pclk_hz);
+    TEST_ASSERT_TRUE(report.isWithinBudget());
+}
+
+TEST_CASE("Test RGB budget with bounce buffers", "[bus][rgb_budget]")
+{
+    BusRGB_Budget::Timing timing = make_timing();
+    timing.bounce_buffer_size_px = 8000;
+    BusRGB_Budget::Report report;
+    TEST_ASSERT_TRUE(BusRGB_Budget::evaluate(timing, {}, report));
+
+    // The reads are averaged over the frame, 800 * 480 / (820 * 500) of the peak rate
+    TEST_ASSERT_EQUAL(29970731U, report.scanout_bytes_per_s);
+    TEST_ASSERT_EQUAL(53, report.margin_percent);
+    TEST_ASSERT_EQUAL(34166666U, report.max_pclk_hz);
+}
+
+TEST_CASE("Test RGB budget with an indexed frame buffer", "[bus][rgb_budget]")
+{
+    BusRGB_Budget::Timing timing = make_timing();
+    timing.bits_per_pixel = 4;
+    timing.bounce_buffer_size_px = 8000;
+    BusRGB_Budget::Report report;
+    TEST_ASSERT_TRUE(BusRGB_Budget::evaluate(timing, {}, report));
+
+    // A quarter of the RGB565 reads
+    TEST_ASSERT_EQUAL(7492682U, report.scanout_bytes_per_s);
+    TEST_ASSERT_EQUAL(88, report.margin_percent);
+    TEST_ASSERT_EQUAL(136666666U, report.max_pclk_hz);
+}
+
+TEST_CASE("Test RGB budget with render load", "[bus][rgb_budget]")
+{
+    BusRGB_Budget::Model model;
+    model.render_bytes_per_s = 40 * 1000 * 1000;
+    BusRGB_Budget::Report report;
+    TEST_ASSERT_TRUE(BusRGB_Budget::evaluate(make_timing(), model, report));
+
+    TEST_ASSERT_EQUAL(72000000U, report.required_bytes_per_s);
+    TEST_ASSERT_EQUAL(-13, report.margin_percent);
+    TEST_ASSERT_FALSE(report.isWithinBudget());
+    TEST_ASSERT_EQUAL(12000000U, report.max_pclk_hz);
+
+    // The recommended pixel clock fits the budget
+    BusRGB_Budget::Timing timing = make_timing();
+    timing.pclk_hz = report.max_pclk_hz;
+    TEST_ASSERT_TRUE(BusRGB_Budget::evaluate(timing, model, report));
+    TEST_ASSERT_EQUAL(0, report.margin_percent);
+    TEST_ASSERT_TRUE(report.isWithinBudget());
+
+    // Nothing left for the scanout
+    model.render_bytes_per_s = 70 * 1000 * 1000;
+    TEST_ASSERT_TRUE(BusRGB_Budget::evaluate(make_timing(), model, report));
+    TEST_ASSERT_EQUAL(0U, report.max_pclk_hz);
+}
+
+TEST_CASE("Test RGB budget bounce buffer recommendation", "[bus][rgb_budget]")
+{
+    struct {
+        int stall_us;
+        uint32_t bounce_size_px;
+    } cases[] = {
+        {0, 800},       // At least 1 line
+        {100, 1600},    // 1600 pixels, 2 lines
+        {150, 2400},    // 3 lines
+        {250, 4000},    // 5 lines
+        {420, 8000},    // 9 lines, but 480 is not a multiple of 18, so 10 lines
+        {20000, 0},     // More than half of the frame
+    };
+
+    for (auto &test : cases) {
+        BusRGB_Budget::Model model;
+        model.stall_us = test.stall_us;
+        BusRGB_Budget::Report report;
+        TEST_ASSERT_TRUE(BusRGB_Budget::evaluate(make_timing(), model, report));
+        TEST_ASSERT_EQUAL(test.bounce_size_px, report.recommended_bounce_size_px);
+    }
+}
+
+TEST_CASE("Test RGB budget with invalid parameters", "[bus][rgb_budget]")
+{
+    BusRGB_Budget::Report report;
+    BusRGB_Budget::Timing timing = make_timing();
+    timing.pclk_hz = 0;
+    TEST_ASSERT_FALSE(BusRGB_Budget::evaluate(timing, {}, report));
+
+    timing = make_timing();
+    timing.bits_per_pixel = 0;
+    TEST_ASSERT_FALSE(BusRGB_Budget::evaluate(timing, {}, report));
+
+    BusRGB_Budget::Model model;
+    model.headroom_percent = 100;
+    TEST_ASSERT_FALSE(BusRGB_Budget::evaluate(make_timing(), model, report));
+    model = {};
+    model.psram_bytes_per_s = 0;
+    TEST_ASSERT_FALSE(BusRGB_Budget::evaluate(make_timing(), model, report));
+}
+
+HOST_TEST_MAIN()
@@ -0,0 +1,61 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <atomic>
+#include <cstddef>
+#include "host_heap.hpp"
+
+// The implementations of glibc, the definitions below take precedence over its `malloc()` and friends
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t num, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+void __libc_free(void *ptr);
+}
+
+static std::atomic<uint64_t> alloc_count{0};
+static std::atomic<uint64_t> free_count{0};
+
+extern "C" {
+
+void *malloc(size_t size)
+{
+    alloc_count.fetch_add(1, std::memory_order_relaxed);
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t num, size_t size)
+{
+    alloc_count.fetch_add(1, std::memory_order_relaxed);
+    return __libc_calloc(num, size);
+}
+
+void *realloc(void *ptr, size_t size)
+{
+    alloc_count.fetch_add(1, std::memory_order_relaxed);
+    return __libc_realloc(ptr, size);
+}
+
+void free(void *ptr)
+{
+    if (ptr != nullptr) {
+        free_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    __libc_free(ptr);
+}
+
+} // extern "C"
+
+namespace host_test {
+
+HeapActivity getHeapActivity()
+{
+    HeapActivity activity;
+    activity.alloc_count = alloc_count.load(std::memory_order_relaxed);
+    activity.free_count = free_count.load(std::memory_order_relaxed);
+    return activity;
+}
+
+} // namespace host_test
@@ -0,0 +1,34 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#pragma once
+
+/**
+ * @brief Heap activity counters for the host tests, link the `host_heap` library to use them
+ *
+ * `malloc()`, `calloc()`, `realloc()` and `free()` of the whole process (including `new` and `delete`) are replaced
+ * by counting wrappers of the C library functions.
+ */
+
+#include <cstdint>
+
+namespace host_test {
+
+struct HeapActivity {
+    uint64_t alloc_count = 0;   // Number of the allocations and reallocations
+    uint64_t free_count = 0;    // Number of the frees of non-null pointers
+
+    uint64_t getTotal() const
+    {
+        return alloc_count + free_count;
+    }
+};
+
+/**
+ * @brief Get the heap activity since the start of the process
+ */
+HeapActivity getHeapActivity();
+
+} // namespace host_test
@@ -0,0 +1,118 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#pragma once
+
+/**
+ * @brief Minimal Unity-like test helpers for the host tests
+ *
+ * The host tests are plain executables registered to CTest, a failed assertion prints the location and makes the
+ * test return a non-zero code.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+namespace host_test {
+
+struct TestCase {
+    const char *name;
+    std::function<void()> func;
+};
+
+inline std::vector<TestCase> &getTestCases()
+{
+    static std::vector<TestCase> test_cases;
+    return test_cases;
+}
+
+inline int &getFailCount()
+{
+    static int fail_count = 0;
+    return fail_count;
+}
+
+struct TestRegister {
+    TestRegister(const char *name, std::function<void()> func)
+    {
+        getTestCases().push_back({name, func});
+    }
+};
+
+inline int runAllTests()
+{
+    int failed_cases = 0;
+    for (auto &test_case : getTestCases()) {
+        int fail_count = getFailCount();
+        printf("[ RUN  ] %s\n", test_case.name);
+        test_case.func();
+        bool passed = (getFailCount() == fail_count);
+        failed_cases += passed ? 0 : 1;
+        printf("[ %s ] %s\n", passed ? " OK " : "FAIL", test_case.name);
+    }
+    printf("%d Tests %d Failures\n", static_cast<int>(getTestCases().size()), failed_cases);
+
+    return (failed_cases == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/**
+ * @brief Get the current time in microseconds, used by the benchmarks
+ */
+inline int64_t getTimeUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()
+           ).count();
+}
+
+} // namespace host_test
+
+#define _HOST_TEST_CONCAT(a, b) a##b
+#define HOST_TEST_CONCAT(a, b) _HOST_TEST_CONCAT(a, b)
+
+#define TEST_CASE(name, tags) \
+    static void HOST_TEST_CONCAT(host_test_func_, __LINE__)(); \
+    static host_test::TestRegister HOST_TEST_CONCAT(host_test_register_, __LINE__)( \
+        name " " tags, HOST_TEST_CONCAT(host_test_func_, __LINE__) \
+    ); \
+    static void HOST_TEST_CONCAT(host_test_func_, __LINE__)()
+
+#define TEST_ASSERT_TRUE_MESSAGE(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("%s:%d: assertion failed: %s (%s)\n", __FILE__, __LINE__, #condition, message); \
+            host_test::getFailCount()++; \
+            return; \
+        } \
+    } while (0)
+#define TEST_ASSERT_TRUE(condition)             TEST_ASSERT_TRUE_MESSAGE(condition, "")
+#define TEST_ASSERT_FALSE(condition)            TEST_ASSERT_TRUE_MESSAGE(!(condition), "")
+#define TEST_ASSERT_FALSE_MESSAGE(condition, message) TEST_ASSERT_TRUE_MESSAGE(!(condition), message)
+#define TEST_ASSERT_EQUAL(expected, actual) \
+    do { \
+        auto _expected = (expected); \
+        auto _actual = (actual); \
+        if (!(_expected == _actual)) { \
+            printf( \
+                "%s:%d: assertion failed: %s == %s (%lld != %lld)\n", __FILE__, __LINE__, #expected, #actual, \
+                static_cast<long long>(_expected), static_cast<long long>(_actual) \
+            ); \
+            host_test::getFailCount()++; \
+            return; \
+        } \
+    } while (0)
+#define TEST_ASSERT_EQUAL_MEMORY(expected, actual, len) \
+    TEST_ASSERT_TRUE_MESSAGE(memcmp((expected), (actual), (len)) == 0, "memory mismatch")
+
+#define HOST_TEST_MAIN() \
+    int main() \
+    { \
+        return host_test::runAllTests(); \
+    }
@@ -0,0 +1,107 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cstring>
+#include <memory>
+#include <vector>
+#include "esp_lcd_panel_io_mock.hpp"
+#include "host_test.hpp"
+#include "drivers/bus/esp_panel_bus_spi.hpp"
+#include "drivers/lcd/esp_panel_lcd_st7789.hpp"
+#include "lcd_benchmark.hpp"
+
+using namespace esp_panel::drivers;
+using esp_lcd_mock::PanelIO;
+
+#define TEST_LCD_WIDTH              (240)
+#define TEST_LCD_HEIGHT             (320)
+#define TEST_LCD_COLOR_BITS         (16)
+#define TEST_LCD_SPI_FREQ_HZ        (40 * 1000 * 1000)
+#define TEST_LCD_STREAM_SIZE        (TEST_LCD_WIDTH * 10 * 2)
+
+static const LCD_BenchmarkResult *find_result(
+    const std::vector<LCD_BenchmarkResult> &results, const char *test, int param
+)
+{
+    for (auto &result : results) {
+        if ((strcmp(result.test, test) == 0) && (result.param == param)) {
+            return &result;
+        }
+    }
+    return nullptr;
+}
+
+TEST_CASE("Test LCD benchmark on the mock SPI bus", "[lcd][benchmark]")
+{
+    // The transfers take the time of the SPI clock, 40 MHz gives 5 MB/s
+    PanelIO::Config io_config;
+    io_config.width = TEST_LCD_WIDTH;
+    io_config.height = TEST_LCD_HEIGHT;
+    io_config.bus_bytes_per_second = PanelIO::BUS_THROUGHPUT_FROM_PCLK;
+    PanelIO::setDefaultConfig(io_config);
+
+    auto bus = std::make_shared<BusSPI>(10, 11, 12, 13);
+    bus->configSPI_FreqHz(TEST_LCD_SPI_FREQ_HZ);
+    TEST_ASSERT_TRUE(bus->begin());
+    auto lcd = std::make_shared<LCD_ST7789>(bus.get(), TEST_LCD_WIDTH, TEST_LCD_HEIGHT, TEST_LCD_COLOR_BITS, -1);
+    TEST_ASSERT_TRUE(lcd->configStreamBufferSize(TEST_LCD_STREAM_SIZE));
+    TEST_ASSERT_TRUE(lcd->init());
+    TEST_ASSERT_TRUE(lcd->reset());
+    TEST_ASSERT_TRUE(lcd->begin());
+    TEST_ASSERT_EQUAL(0, strcmp(lcd_benchmark_get_bus_name(lcd.get()), "SPI"));
+
+    LCD_BenchmarkConfig config;
+    config.label = "host";
+    config.full_fill_num = 3;
+    config.strip_frame_num = 1;
+    config.small_rect_num = 50;
+    config.rotated_frame_num = 1;
+    std::vector<LCD_BenchmarkResult> results;
+    TEST_ASSERT_TRUE(lcd_benchmark_run(lcd.get(), config, results));
+    lcd_benchmark_print(lcd.get(), config, results);
+
+    // No frame buffer flips on the SPI bus
+    TEST_ASSERT_EQUAL(static_cast<size_t>(7), results.size());
+    TEST_ASSERT_TRUE(find_result(results, "fb_flip", 2) == nullptr);
+    for (auto &result : results) {
+        TEST_ASSERT_TRUE(result.calls > 0);
+        TEST_ASSERT_TRUE(result.time_us > 0);
+        TEST_ASSERT_TRUE(result.latency_p50_us <= result.latency_p90_us);
+        TEST_ASSERT_TRUE(result.latency_p90_us <= result.latency_p99_us);
+        TEST_ASSERT_TRUE(result.latency_p99_us <= result.latency_max_us);
+        // The bus can't be faster than its clock
+        TEST_ASSERT_TRUE(result.getMilliMBps() <= 5050);
+    }
+
+    const LCD_BenchmarkResult *full_fill = find_result(results, "full_fill", 0);
+    TEST_ASSERT_TRUE(full_fill != nullptr);
+    TEST_ASSERT_EQUAL(3U, full_fill->calls);
+    TEST_ASSERT_EQUAL(3000ULL, static_cast<unsigned long long>(full_fill->milli_frames));
+    TEST_ASSERT_TRUE(full_fill->getMilliMBps() >= 3000);
+    // A frame of 153600 bytes takes about 30.7 ms
+    TEST_ASSERT_TRUE(full_fill->latency_p50_us >= 30000);
+
+    for (int lines : {10, 20, 40, 80}) {
+        const LCD_BenchmarkResult *strip = find_result(results, "strip_fill", lines);
+        TEST_ASSERT_TRUE(strip != nullptr);
+        TEST_ASSERT_EQUAL(static_cast<uint32_t>(TEST_LCD_HEIGHT / lines), strip->calls);
+        TEST_ASSERT_EQUAL(1000ULL, static_cast<unsigned long long>(strip->milli_frames));
+    }
+
+    const LCD_BenchmarkResult *small_rect = find_result(results, "small_rect", 64);
+    TEST_ASSERT_TRUE(small_rect != nullptr);
+    TEST_ASSERT_EQUAL(50U, small_rect->calls);
+
+    const LCD_BenchmarkResult *rotated = find_result(results, "rotated_blit", 90);
+    TEST_ASSERT_TRUE(rotated != nullptr);
+    TEST_ASSERT_EQUAL(1000ULL, static_cast<unsigned long long>(rotated->milli_frames));
+    // The transformation is restored
+    TEST_ASSERT_TRUE(lcd->getDrawBitmapTransform().isIdentity());
+
+    TEST_ASSERT_TRUE(lcd->del());
+    TEST_ASSERT_TRUE(bus->del());
+}
+
+HOST_TEST_MAIN()
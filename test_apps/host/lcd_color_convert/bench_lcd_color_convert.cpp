@@ -0,0 +1,62 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "host_test.hpp"
+#include "drivers/lcd/esp_panel_lcd_color_convert.hpp"
+
+using namespace esp_panel::drivers;
+using PixelFormat = LCD_ColorConvert::PixelFormat;
+
+#define BENCH_LOOP_COUNT    (20)
+
+struct BenchCase {
+    const char *name;
+    PixelFormat src_format;
+    PixelFormat dst_format;
+    LCD_ColorConvert::Options options;
+};
+
+static const BenchCase BENCH_CASES[] = {
+    {"RGB565 -> RGB565 (swap)", PixelFormat::RGB565, PixelFormat::RGB565, {false, true}},
+    {"RGB888 -> RGB565", PixelFormat::RGB888, PixelFormat::RGB565, {false, false}},
+    {"RGB888 -> RGB565 (swap)", PixelFormat::RGB888, PixelFormat::RGB565, {false, true}},
+    {"RGB888 -> RGB565 (dither)", PixelFormat::RGB888, PixelFormat::RGB565, {true, true}},
+    {"RGB888 -> RGB666", PixelFormat::RGB888, PixelFormat::RGB666, {false, false}},
+    {"RGB888 -> RGB666 (dither)", PixelFormat::RGB888, PixelFormat::RGB666, {true, false}},
+    {"ARGB8888 -> RGB565", PixelFormat::ARGB8888, PixelFormat::RGB565, {false, true}},
+    {"ARGB8888 -> RGB565 (dither)", PixelFormat::ARGB8888, PixelFormat::RGB565, {true, true}},
+    {"ARGB8888 -> RGB888", PixelFormat::ARGB8888, PixelFormat::RGB888, {false, false}},
+};
+
+int main(int argc, char *argv[])
+{
+    // The default strip matches a 20 lines stream buffer of a 480 pixels wide panel
+    int width = (argc > 1) ? atoi(argv[1]) : 480;
+    int height = (argc > 2) ? atoi(argv[2]) : 20;
+
+    printf("Convert %dx%d, average of %d loops\n", width, height, BENCH_LOOP_COUNT);
+    printf("%-30s %10s %12s\n", "case", "us", "Mpixel/s");
+    for (auto &bench : BENCH_CASES) {
+        std::vector<uint8_t> src(width * height * LCD_ColorConvert::getBytesPerPixel(bench.src_format));
+        std::vector<uint8_t> dst(width * height * LCD_ColorConvert::getBytesPerPixel(bench.dst_format));
+        for (size_t i = 0; i < src.size(); i++) {
+            src[i] = static_cast<uint8_t>(i * 7);
+        }
+
+        int64_t start_us = host_test::getTimeUs();
+        for (int i = 0; i < BENCH_LOOP_COUNT; i++) {
+            LCD_ColorConvert::convert(
+                bench.src_format, src.data(), width, height, 0, bench.dst_format, dst.data(), 0, 0, i, bench.options
+            );
+        }
+        double time_us = static_cast<double>(host_test::getTimeUs() - start_us) / BENCH_LOOP_COUNT;
+        printf("%-30s %10.1f %12.1f\n", bench.name, time_us, width * height / time_us);
+    }
+
+    return 0;
+}
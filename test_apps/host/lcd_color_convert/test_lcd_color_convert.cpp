@@ -0,0 +1,171 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "host_test.hpp"
+#include "drivers/lcd/esp_panel_lcd_color_convert.hpp"
+
+using namespace esp_panel::drivers;
+
+TEST_CASE("Test RGB565 byte swap for all alignments and lengths", "[lcd][color_convert]")
+{
+    const int max_count = 37;
+    std::vector<uint16_t> src(max_count + 2);
+    for (size_t i = 0; i < src.size(); i++) {
+        src[i] = static_cast<uint16_t>(0x1234 + i * 0x0101);
+    }
+
+    for (int src_offset = 0; src_offset < 2; src_offset++) {
+        for (int dst_offset = 0; dst_offset < 2; dst_offset++) {
+            for (int count = 0; count <= max_count; count++) {
+                std::vector<uint16_t> dst(max_count + 4, 0xdead);
+                LCD_ColorConvert::copySwapBytesRGB565(dst.data() + dst_offset, src.data() + src_offset, count);
+                for (int i = 0; i < count; i++) {
+                    uint16_t value = src[src_offset + i];
+                    TEST_ASSERT_EQUAL(static_cast<uint16_t>((value << 8) | (value >> 8)), dst[dst_offset + i]);
+                }
+                // Make sure nothing is written outside
+                TEST_ASSERT_EQUAL(0xdead, dst[dst_offset + count]);
+                if (dst_offset > 0) {
+                    TEST_ASSERT_EQUAL(0xdead, dst[0]);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Test RGB565 byte swap in place", "[lcd][color_convert]")
+{
+    std::vector<uint16_t> data = {0x0102, 0x0304, 0x0506, 0x0708, 0x090a, 0x0b0c, 0x0d0e, 0x0f10, 0x1112};
+    LCD_ColorConvert::copySwapBytesRGB565(data.data(), data.data(), data.size());
+    std::vector<uint16_t> expected = {0x0201, 0x0403, 0x0605, 0x0807, 0x0a09, 0x0c0b, 0x0e0d, 0x100f, 0x1211};
+    TEST_ASSERT_TRUE(data == expected);
+}
+
+using PixelFormat = LCD_ColorConvert::PixelFormat;
+
+static void pack_pixel(PixelFormat format, uint8_t *dst, int r, int g, int b)
+{
+    switch (format) {
+    case PixelFormat::RGB565: {
+        uint16_t value = static_cast<uint16_t>(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+        memcpy(dst, &value, sizeof(value));
+        break;
+    }
+    case PixelFormat::RGB666:
+        dst[0] = r & 0xfc;
+        dst[1] = g & 0xfc;
+        dst[2] = b & 0xfc;
+        break;
+    case PixelFormat::RGB888:
+        dst[0] = r;
+        dst[1] = g;
+        dst[2] = b;
+        break;
+    case PixelFormat::ARGB8888:
+        dst[0] = b;
+        dst[1] = g;
+        dst[2] = r;
+        dst[3] = 0x80;
+        break;
+    }
+}
+
+TEST_CASE("Test pixel format conversion without dithering", "[lcd][color_convert]")
+{
+    const int width = 13;
+    const int height = 3;
+    const PixelFormat src_formats[] = {PixelFormat::RGB888, PixelFormat::ARGB8888};
+    const PixelFormat dst_formats[] = {PixelFormat::RGB565, PixelFormat::RGB666, PixelFormat::RGB888};
+
+    for (auto src_format : src_formats) {
+        int src_bytes = LCD_ColorConvert::getBytesPerPixel(src_format);
+        // Use a padded stride to check the line handling
+        int src_stride = (width + 3) * src_bytes;
+        std::vector<uint8_t> src(src_stride * height);
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                pack_pixel(src_format, &src[y * src_stride + x * src_bytes], x * 19, y * 97 + x, 255 - x * 17);
+            }
+        }
+        for (auto dst_format : dst_formats) {
+            int dst_bytes = LCD_ColorConvert::getBytesPerPixel(dst_format);
+            std::vector<uint8_t> dst(width * height * dst_bytes);
+            TEST_ASSERT_TRUE(LCD_ColorConvert::convert(
+                                 src_format, src.data(), width, height, src_stride, dst_format, dst.data(), 0, 0, 0, {}
+                             ));
+            std::vector<uint8_t> expected(dst_bytes);
+            for (int y = 0; y < height; y++) {
+                for (int x = 0; x < width; x++) {
+                    pack_pixel(dst_format, expected.data(), x * 19, y * 97 + x, 255 - x * 17);
+                    TEST_ASSERT_EQUAL_MEMORY(expected.data(), &dst[(y * width + x) * dst_bytes], dst_bytes);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Test pixel format conversion with byte swap and unsupported formats", "[lcd][color_convert]")
+{
+    const uint8_t src[] = {0xff, 0x00, 0x00, 0x00, 0x00, 0xff};
+    uint16_t dst[2] = {};
+    TEST_ASSERT_TRUE(LCD_ColorConvert::convert(
+                         PixelFormat::RGB888, src, 2, 1, 0, PixelFormat::RGB565, reinterpret_cast<uint8_t *>(dst), 0, 0,
+                         0, {.dither = false, .swap_bytes = true}
+                     ));
+    TEST_ASSERT_EQUAL(0x00f8, dst[0]);
+    TEST_ASSERT_EQUAL(0x1f00, dst[1]);
+
+    // ARGB8888 is only supported as the source
+    uint8_t out[8] = {};
+    bool ret = LCD_ColorConvert::convert(PixelFormat::RGB888, src, 2, 1, 0, PixelFormat::ARGB8888, out, 0, 0, 0, {});
+    TEST_ASSERT_FALSE(ret);
+    ret = LCD_ColorConvert::convert(PixelFormat::RGB888, nullptr, 2, 1, 0, PixelFormat::RGB565, out, 0, 0, 0, {});
+    TEST_ASSERT_FALSE(ret);
+
+    PixelFormat format = {};
+    TEST_ASSERT_TRUE(LCD_ColorConvert::getPixelFormatByBits(18, format));
+    TEST_ASSERT_TRUE(format == PixelFormat::RGB666);
+    TEST_ASSERT_FALSE(LCD_ColorConvert::getPixelFormatByBits(8, format));
+}
+
+TEST_CASE("Test ordered dithering keeps the average color", "[lcd][color_convert]")
+{
+    // A flat area of a color between two RGB565 levels should be dithered to an average close to it, the levels above
+    // the highest red step (248) can't be reached
+    const int size = 16;
+    for (int level = 0; level <= 248; level += 5) {
+        std::vector<uint8_t> src(size * size * 3, static_cast<uint8_t>(level));
+        std::vector<uint16_t> dst(size * size);
+        TEST_ASSERT_TRUE(LCD_ColorConvert::convert(
+                             PixelFormat::RGB888, src.data(), size, size, 0, PixelFormat::RGB565,
+                             reinterpret_cast<uint8_t *>(dst.data()), 0, 3, 1, {.dither = true, .swap_bytes = false}
+                         ));
+        int sum_r = 0;
+        int sum_g = 0;
+        for (auto value : dst) {
+            sum_r += (value >> 11) << 3;
+            sum_g += ((value >> 5) & 0x3f) << 2;
+        }
+        // Without dithering the error can be up to one step (8 for R, 4 for G)
+        TEST_ASSERT_TRUE(abs(sum_r / (size * size) - level) <= 2);
+        TEST_ASSERT_TRUE(abs(sum_g / (size * size) - level) <= 2);
+    }
+
+    // White must not overflow
+    uint8_t white[3] = {0xff, 0xff, 0xff};
+    uint16_t out = 0;
+    for (int x = 0; x < 4; x++) {
+        LCD_ColorConvert::convert(
+            PixelFormat::RGB888, white, 1, 1, 0, PixelFormat::RGB565, reinterpret_cast<uint8_t *>(&out), 0, x, x,
+            {.dither = true, .swap_bytes = false}
+        );
+        TEST_ASSERT_EQUAL(0xffff, out);
+    }
+}
+
+HOST_TEST_MAIN()
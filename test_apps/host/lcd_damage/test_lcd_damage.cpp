@@ -0,0 +1,250 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+#include "host_test.hpp"
+#include "drivers/lcd/esp_panel_lcd_damage.hpp"
+
+using namespace esp_panel::drivers;
+
+using Rect = LCD_DamageTracker::Rect;
+
+static bool is_rect_equal(const Rect &a, const Rect &b)
+{
+    return (a.x == b.x) && (a.y == b.y) && (a.width == b.width) && (a.height == b.height);
+}
+
+static bool is_rect_contained(const Rect &outer, int x, int y)
+{
+    return (x >= outer.x) && (x < outer.x + outer.width) && (y >= outer.y) && (y < outer.y + outer.height);
+}
+
+TEST_CASE("Test damage rectangle snapping", "[lcd][damage]")
+{
+    LCD_DamageTracker::Config config = {.width = 100, .height = 50, .x_align = 4, .y_align = 2};
+
+    TEST_ASSERT_TRUE(is_rect_equal({4, 2, 8, 4}, LCD_DamageTracker::snap(config, {5, 3, 6, 2})));
+    // The end is clipped to the unaligned panel size
+    TEST_ASSERT_TRUE(is_rect_equal({96, 48, 4, 2}, LCD_DamageTracker::snap(config, {97, 49, 10, 10})));
+    TEST_ASSERT_TRUE(is_rect_equal({0, 0, 4, 2}, LCD_DamageTracker::snap(config, {-10, -10, 11, 11})));
+    // Outside or empty
+    Rect empty = LCD_DamageTracker::snap(config, {100, 0, 10, 10});
+    TEST_ASSERT_EQUAL(0, empty.width);
+    empty = LCD_DamageTracker::snap(config, {10, 10, 0, 10});
+    TEST_ASSERT_EQUAL(0, empty.width);
+}
+
+TEST_CASE("Test damage merging with the cost model", "[lcd][damage]")
+{
+    LCD_DamageTracker tracker;
+    tracker.configure({.width = 320, .height = 240, .x_align = 1, .y_align = 1, .transaction_cost = 100});
+
+    // Adjacent rectangles with the same span become one window
+    tracker.add({0, 0, 10, 10});
+    tracker.add({10, 0, 10, 10});
+    TEST_ASSERT_EQUAL(1, tracker.getRectNum());
+    TEST_ASSERT_TRUE(is_rect_equal({0, 0, 20, 10}, tracker.getRects()[0]));
+
+    // Contained rectangle is absorbed
+    tracker.add({5, 5, 2, 2});
+    TEST_ASSERT_EQUAL(1, tracker.getRectNum());
+
+    // Far away rectangles are kept apart, the bounding box would waste too many pixels
+    tracker.add({300, 200, 10, 10});
+    TEST_ASSERT_EQUAL(2, tracker.getRectNum());
+
+    // Close rectangles are merged when the extra pixels cost less than a transaction
+    tracker.clear();
+    tracker.add({0, 0, 10, 10});
+    tracker.add({0, 11, 10, 10});
+    TEST_ASSERT_EQUAL(1, tracker.getRectNum());
+    TEST_ASSERT_TRUE(is_rect_equal({0, 0, 10, 21}, tracker.getRects()[0]));
+
+    // Without transaction cost, only merges that don't add pixels are done
+    tracker.configure({.width = 320, .height = 240, .x_align = 1, .y_align = 1, .transaction_cost = 0});
+    TEST_ASSERT_EQUAL(0, tracker.getRectNum());
+    tracker.add({0, 0, 10, 10});
+    tracker.add({0, 11, 10, 10});
+    TEST_ASSERT_EQUAL(2, tracker.getRectNum());
+    // Filling the gap makes a single window cheapest, the merge should cascade
+    tracker.add({0, 10, 10, 1});
+    TEST_ASSERT_EQUAL(1, tracker.getRectNum());
+    TEST_ASSERT_TRUE(is_rect_equal({0, 0, 10, 21}, tracker.getRects()[0]));
+}
+
+TEST_CASE("Test damage merging after snapping", "[lcd][damage]")
+{
+    LCD_DamageTracker tracker;
+    tracker.configure({.width = 360, .height = 360, .x_align = 2, .y_align = 2, .transaction_cost = 0});
+
+    // Both rectangles snap to the same aligned window
+    tracker.add({1, 1, 1, 1});
+    tracker.add({0, 0, 1, 1});
+    TEST_ASSERT_EQUAL(1, tracker.getRectNum());
+    TEST_ASSERT_TRUE(is_rect_equal({0, 0, 2, 2}, tracker.getRects()[0]));
+}
+
+TEST_CASE("Test damage tracker storage overflow and coverage", "[lcd][damage]")
+{
+    const int width = 480;
+    const int height = 320;
+    LCD_DamageTracker tracker;
+    tracker.configure({.width = width, .height = height, .x_align = 2, .y_align = 1, .transaction_cost = 64});
+
+    std::vector<Rect> added;
+    srand(1);
+    for (int i = 0; i < 200; i++) {
+        Rect rect = {rand() % width, rand() % height, 1 + rand() % 40, 1 + rand() % 40};
+        added.push_back(rect);
+        tracker.add(rect);
+        TEST_ASSERT_TRUE(tracker.getRectNum() <= LCD_DamageTracker::RECTS_MAX_NUM);
+    }
+
+    // Every damaged pixel should be covered by a window, and windows should be aligned and inside the panel
+    std::vector<uint8_t> covered(width * height, 0);
+    for (int i = 0; i < tracker.getRectNum(); i++) {
+        const Rect &rect = tracker.getRects()[i];
+        TEST_ASSERT_EQUAL(0, rect.x % 2);
+        TEST_ASSERT_TRUE((rect.x + rect.width <= width) && (rect.y + rect.height <= height));
+        for (int y = rect.y; y < rect.y + rect.height; y++) {
+            for (int x = rect.x; x < rect.x + rect.width; x++) {
+                covered[y * width + x] = 1;
+            }
+        }
+    }
+    for (auto &rect : added) {
+        for (int y = rect.y; y < std::min(rect.y + rect.height, height); y++) {
+            for (int x = rect.x; x < std::min(rect.x + rect.width, width); x++) {
+                TEST_ASSERT_TRUE(covered[y * width + x]);
+            }
+        }
+    }
+
+    // No window contains another one, otherwise they would have been merged
+    for (int i = 0; i < tracker.getRectNum(); i++) {
+        for (int j = 0; j < tracker.getRectNum(); j++) {
+            const Rect &a = tracker.getRects()[i];
+            const Rect &b = tracker.getRects()[j];
+            bool contained = is_rect_contained(a, b.x, b.y) &&
+                             is_rect_contained(a, b.x + b.width - 1, b.y + b.height - 1);
+            TEST_ASSERT_FALSE((i != j) && contained);
+        }
+    }
+}
+
+TEST_CASE("Test damage history by buffer age", "[lcd][damage][history]")
+{
+    LCD_DamageHistory history;
+    history.configure({.width = 100, .height = 100, .x_align = 1, .y_align = 1, .transaction_cost = 0});
+    LCD_DamageTracker damage;
+
+    // Nothing is known before any frame is recorded, except that a buffer of age 1 is up to date
+    TEST_ASSERT_FALSE(history.getDamageSince(0, damage));
+    TEST_ASSERT_TRUE(history.getDamageSince(1, damage));
+    TEST_ASSERT_EQUAL(0, damage.getRectNum());
+    TEST_ASSERT_FALSE(history.getDamageSince(2, damage));
+
+    const Rect frame_rects[] = {{0, 0, 10, 10}, {50, 50, 10, 10}, {90, 0, 10, 10}};
+    for (auto &rect : frame_rects) {
+        history.addFrame(&rect, 1);
+    }
+    TEST_ASSERT_EQUAL(3, history.getFrameNum());
+
+    // Age 2 misses the last frame only
+    TEST_ASSERT_TRUE(history.getDamageSince(2, damage));
+    TEST_ASSERT_EQUAL(1, damage.getRectNum());
+    TEST_ASSERT_TRUE(is_rect_equal(frame_rects[2], damage.getRects()[0]));
+    // Age 3 misses the last two frames, the disjoint rectangles are kept separate without transaction cost
+    TEST_ASSERT_TRUE(history.getDamageSince(3, damage));
+    TEST_ASSERT_EQUAL(2, damage.getRectNum());
+    TEST_ASSERT_TRUE(history.getDamageSince(4, damage));
+    TEST_ASSERT_EQUAL(3, damage.getRectNum());
+    TEST_ASSERT_FALSE(history.getDamageSince(5, damage));
+
+    // A frame without rectangles damages the whole frame
+    history.addFrame(nullptr, 0);
+    TEST_ASSERT_TRUE(history.getDamageSince(2, damage));
+    TEST_ASSERT_EQUAL(1, damage.getRectNum());
+    TEST_ASSERT_TRUE(is_rect_equal({0, 0, 100, 100}, damage.getRects()[0]));
+
+    // Old frames are dropped from the ring, the whole frame damage above is not included anymore
+    for (int i = 0; i < LCD_DamageHistory::FRAMES_MAX_NUM; i++) {
+        Rect rect = {i * 10, i * 10, 1, 1};
+        history.addFrame(&rect, 1);
+    }
+    TEST_ASSERT_EQUAL(LCD_DamageHistory::FRAMES_MAX_NUM, history.getFrameNum());
+    TEST_ASSERT_TRUE(history.getDamageSince(LCD_DamageHistory::FRAMES_MAX_NUM + 1, damage));
+    TEST_ASSERT_EQUAL(LCD_DamageHistory::FRAMES_MAX_NUM, damage.getRectNum());
+    for (int i = 0; i < damage.getRectNum(); i++) {
+        TEST_ASSERT_EQUAL(1, damage.getRects()[i].width);
+    }
+    TEST_ASSERT_FALSE(history.getDamageSince(LCD_DamageHistory::FRAMES_MAX_NUM + 2, damage));
+
+    history.clear();
+    TEST_ASSERT_FALSE(history.getDamageSince(2, damage));
+}
+
+TEST_CASE("Test damage history repairs triple buffers", "[lcd][damage][history]")
+{
+    constexpr int width = 64;
+    constexpr int height = 48;
+    constexpr int buffer_num = 3;
+
+    const LCD_DamageTracker::Config config = {
+        .width = width, .height = height, .x_align = 1, .y_align = 1, .transaction_cost = 0
+    };
+    LCD_DamageHistory history;
+    history.configure(config);
+    std::vector<uint8_t> frame(width * height, 0);
+    std::vector<uint8_t> buffers[buffer_num];
+    int present_ids[buffer_num] = {};
+    for (auto &buffer : buffers) {
+        buffer.assign(width * height, 0);
+    }
+
+    // Render each frame into the buffers in turn: repair from the latest frame, then draw the new damage
+    srand(1);
+    int latest = -1;
+    for (int present_id = 1; present_id <= 200; present_id++) {
+        int index = present_id % buffer_num;
+        auto &buffer = buffers[index];
+        // Same as `LCD_SwapChain::getAge()`, the latest present ID is `present_id - 1`
+        int age = (present_ids[index] > 0) ? (present_id - present_ids[index]) : 0;
+        LCD_DamageTracker damage;
+        if (latest >= 0) {
+            if (!history.getDamageSince(age, damage)) {
+                damage.add({0, 0, width, height});
+            }
+            for (int i = 0; i < damage.getRectNum(); i++) {
+                auto &rect = damage.getRects()[i];
+                for (int y = rect.y; y < rect.y + rect.height; y++) {
+                    std::copy_n(&buffers[latest][y * width + rect.x], rect.width, &buffer[y * width + rect.x]);
+                }
+            }
+        }
+
+        Rect rects[3];
+        int rect_num = 1 + rand() % 3;
+        for (int i = 0; i < rect_num; i++) {
+            rects[i] = {rand() % width, rand() % height, 1 + rand() % 16, 1 + rand() % 16};
+            auto rect = LCD_DamageTracker::snap(config, rects[i]);
+            for (int y = rect.y; y < rect.y + rect.height; y++) {
+                for (int x = rect.x; x < rect.x + rect.width; x++) {
+                    frame[y * width + x] = static_cast<uint8_t>(present_id);
+                    buffer[y * width + x] = static_cast<uint8_t>(present_id);
+                }
+            }
+        }
+        TEST_ASSERT_TRUE(buffer == frame);
+
+        history.addFrame(rects, rect_num);
+        present_ids[index] = present_id;
+        latest = index;
+    }
+}
+
+HOST_TEST_MAIN()
@@ -0,0 +1,310 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <memory>
+#include <vector>
+#include "esp_heap_caps.h"
+#include "esp_lcd_panel_commands.h"
+#include "esp_lcd_panel_io_mock.hpp"
+#include "host_test.hpp"
+#include "drivers/bus/esp_panel_bus_spi.hpp"
+#include "drivers/lcd/esp_panel_lcd_st7789.hpp"
+
+using namespace esp_panel::drivers;
+using esp_lcd_mock::PanelIO;
+
+#define TEST_LCD_WIDTH              (240)
+#define TEST_LCD_HEIGHT             (320)
+#define TEST_LCD_COLOR_BITS         (16)
+#define TEST_LCD_SPI_FREQ_HZ        (40 * 1000 * 1000)
+#define TEST_LCD_QUEUE_DEPTH        (4)
+#define TEST_LCD_STREAM_SIZE        (TEST_LCD_WIDTH * 10 * 2)
+
+struct TestPanel {
+    std::shared_ptr<BusSPI> bus;
+    std::shared_ptr<LCD_ST7789> lcd;
+    PanelIO *io = nullptr;
+    bool is_ready = false;
+};
+
+static void create_panel(TestPanel &panel, uint32_t bus_bytes_per_second, size_t stream_size = 0)
+{
+    PanelIO::Config io_config;
+    io_config.width = TEST_LCD_WIDTH;
+    io_config.height = TEST_LCD_HEIGHT;
+    io_config.bus_bytes_per_second = bus_bytes_per_second;
+    PanelIO::setDefaultConfig(io_config);
+
+    panel.bus = std::make_shared<BusSPI>(10, 11, 12, 13);
+    panel.bus->configSPI_FreqHz(TEST_LCD_SPI_FREQ_HZ);
+    panel.bus->configSPI_TransQueueDepth(TEST_LCD_QUEUE_DEPTH);
+    TEST_ASSERT_TRUE(panel.bus->begin());
+    panel.io = PanelIO::getLatest();
+    TEST_ASSERT_TRUE(panel.io != nullptr);
+
+    panel.lcd = std::make_shared<LCD_ST7789>(
+                    panel.bus.get(), TEST_LCD_WIDTH, TEST_LCD_HEIGHT, TEST_LCD_COLOR_BITS, -1
+                );
+    if (stream_size > 0) {
+        TEST_ASSERT_TRUE(panel.lcd->configStreamBufferSize(stream_size));
+    }
+    TEST_ASSERT_TRUE(panel.lcd->init());
+    TEST_ASSERT_TRUE(panel.lcd->reset());
+    TEST_ASSERT_TRUE(panel.lcd->begin());
+    panel.is_ready = true;
+}
+
+static uint16_t make_pixel(int x, int y)
+{
+    return static_cast<uint16_t>((x * 31 + y * 7) ^ (y << 8));
+}
+
+static std::vector<uint16_t> make_bitmap(int x_start, int y_start, int width, int height)
+{
+    std::vector<uint16_t> bitmap(width * height);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            bitmap[y * width + x] = make_pixel(x_start + x, y_start + y);
+        }
+    }
+    return bitmap;
+}
+
+static bool check_rect(PanelIO *io, int x_start, int y_start, int width, int height)
+{
+    for (int y = y_start; y < y_start + height; y++) {
+        for (int x = x_start; x < x_start + width; x++) {
+            if (io->getPixel(x, y) != make_pixel(x, y)) {
+                printf(
+                    "Pixel (%d, %d) is 0x%04x, expected 0x%04x\n", x, y, static_cast<unsigned>(io->getPixel(x, y)),
+                    static_cast<unsigned>(make_pixel(x, y))
+                );
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static int count_commands(PanelIO *io, int cmd)
+{
+    int count = 0;
+    for (auto &command : io->getCommands()) {
+        count += (command.cmd == cmd) ? 1 : 0;
+    }
+    return count;
+}
+
+TEST_CASE("Test LCD initialization commands", "[lcd][driver]")
+{
+    TestPanel panel;
+    create_panel(panel, 0);
+    TEST_ASSERT_TRUE(panel.is_ready);
+
+    bool has_sleep_out = false;
+    bool has_colmod = false;
+    for (auto &command : panel.io->getCommands()) {
+        has_sleep_out |= (command.cmd == LCD_CMD_SLPOUT);
+        if ((command.cmd == LCD_CMD_COLMOD) && (command.params.size() == 1)) {
+            has_colmod = (command.params[0] == 0x55);
+        }
+    }
+    TEST_ASSERT_TRUE(has_sleep_out);
+    TEST_ASSERT_TRUE(has_colmod);
+    TEST_ASSERT_EQUAL(2, panel.io->getBytesPerPixel());
+
+    panel.io->clearCommands();
+    TEST_ASSERT_TRUE(panel.lcd->setDisplayOnOff(true));
+    TEST_ASSERT_TRUE(panel.lcd->invertColor(true));
+    auto commands = panel.io->getCommands();
+    TEST_ASSERT_EQUAL(static_cast<size_t>(2), commands.size());
+    TEST_ASSERT_EQUAL(LCD_CMD_DISPON, commands[0].cmd);
+    TEST_ASSERT_EQUAL(LCD_CMD_INVON, commands[1].cmd);
+
+    TEST_ASSERT_TRUE(panel.lcd->del());
+    TEST_ASSERT_TRUE(panel.bus->del());
+    TEST_ASSERT_TRUE(PanelIO::getLatest() == nullptr);
+}
+
+TEST_CASE("Test LCD draw bitmap into the virtual frame buffer", "[lcd][driver]")
+{
+    TestPanel panel;
+    create_panel(panel, 0);
+    TEST_ASSERT_TRUE(panel.is_ready);
+
+    auto full = make_bitmap(0, 0, TEST_LCD_WIDTH, TEST_LCD_HEIGHT);
+    TEST_ASSERT_TRUE(panel.lcd->drawBitmap(
+                         0, 0, TEST_LCD_WIDTH, TEST_LCD_HEIGHT, reinterpret_cast<const uint8_t *>(full.data()), -1
+                     ));
+    TEST_ASSERT_TRUE(check_rect(panel.io, 0, 0, TEST_LCD_WIDTH, TEST_LCD_HEIGHT));
+
+    panel.io->clearFrameBuffer();
+    auto rect = make_bitmap(17, 33, 50, 21);
+    TEST_ASSERT_TRUE(panel.lcd->drawBitmap(17, 33, 50, 21, reinterpret_cast<const uint8_t *>(rect.data()), -1));
+    TEST_ASSERT_TRUE(check_rect(panel.io, 17, 33, 50, 21));
+    TEST_ASSERT_EQUAL(0U, panel.io->getPixel(16, 33));
+    TEST_ASSERT_EQUAL(0U, panel.io->getPixel(67, 53));
+    TEST_ASSERT_EQUAL(0U, panel.io->getPixel(17, 54));
+    TEST_ASSERT_EQUAL(0U, panel.io->getStats().clipped_pixels);
+
+    TEST_ASSERT_TRUE(panel.lcd->fillRect(100, 200, 30, 40, 0xa5c3, -1));
+    TEST_ASSERT_EQUAL(0xa5c3U, panel.io->getPixel(100, 200));
+    TEST_ASSERT_EQUAL(0xa5c3U, panel.io->getPixel(129, 239));
+    TEST_ASSERT_EQUAL(0U, panel.io->getPixel(130, 239));
+
+    TEST_ASSERT_TRUE(panel.lcd->del());
+    TEST_ASSERT_TRUE(panel.bus->del());
+}
+
+TEST_CASE("Test LCD asynchronous draw bitmap with a throttled bus", "[lcd][driver]")
+{
+    // 1 MB/s, a strip of 240 x 10 pixels takes 4.8 ms
+    TestPanel panel;
+    create_panel(panel, 1000 * 1000);
+    TEST_ASSERT_TRUE(panel.is_ready);
+    TEST_ASSERT_EQUAL(TEST_LCD_QUEUE_DEPTH, panel.lcd->getDrawBitmapQueueDepth());
+
+    const int strip_height = 10;
+    const int strip_num = 12;
+    std::vector<std::vector<uint16_t>> strips;
+    for (int i = 0; i < strip_num; i++) {
+        strips.push_back(make_bitmap(0, i * strip_height, TEST_LCD_WIDTH, strip_height));
+    }
+
+    int64_t start_us = host_test::getTimeUs();
+    std::vector<LCD::DrawBitmapToken> tokens(strip_num);
+    for (int i = 0; i < strip_num; i++) {
+        TEST_ASSERT_TRUE(panel.lcd->drawBitmapAsync(
+                             0, i * strip_height, TEST_LCD_WIDTH, strip_height,
+                             reinterpret_cast<const uint8_t *>(strips[i].data()), &tokens[i]
+                         ));
+    }
+    // Only the strips of the last queue slots can still be in flight
+    TEST_ASSERT_FALSE(panel.lcd->isDrawBitmapFinished(tokens[strip_num - 1]));
+    TEST_ASSERT_TRUE(panel.lcd->waitDrawBitmapFinish(tokens[strip_num / 2]));
+    TEST_ASSERT_TRUE(panel.lcd->isDrawBitmapFinished(tokens[0]));
+    TEST_ASSERT_TRUE(panel.lcd->waitDrawBitmapFinishAll());
+    int64_t elapsed_us = host_test::getTimeUs() - start_us;
+
+    TEST_ASSERT_TRUE(check_rect(panel.io, 0, 0, TEST_LCD_WIDTH, strip_height * strip_num));
+    TEST_ASSERT_TRUE(elapsed_us >= strip_num * 4800);
+    // Like the hardware, the window commands of each strip wait for the queued transfers
+    auto io_stats = panel.io->getStats();
+    TEST_ASSERT_EQUAL(static_cast<uint32_t>(strip_num), io_stats.color_trans_count);
+    TEST_ASSERT_TRUE(io_stats.max_pending_num <= TEST_LCD_QUEUE_DEPTH);
+
+    LCD_Stats stats = panel.lcd->getStats();
+    printf("%s", stats.toString().c_str());
+    TEST_ASSERT_EQUAL(static_cast<uint32_t>(strip_num), stats.getDrawBitmapCount());
+    TEST_ASSERT_EQUAL(static_cast<uint64_t>(io_stats.color_bytes), stats.getDrawBitmapBytes());
+    TEST_ASSERT_EQUAL(static_cast<uint32_t>(strip_num), stats.getLatencyCount());
+    TEST_ASSERT_TRUE(stats.getLatencyMinUs() >= 4800);
+
+    TEST_ASSERT_TRUE(panel.lcd->del());
+    TEST_ASSERT_TRUE(panel.bus->del());
+}
+
+TEST_CASE("Test LCD draw bitmap from external RAM through the stream buffers", "[lcd][driver]")
+{
+    TestPanel panel;
+    create_panel(panel, 20 * 1000 * 1000, TEST_LCD_STREAM_SIZE);
+    TEST_ASSERT_TRUE(panel.is_ready);
+    TEST_ASSERT_EQUAL(static_cast<size_t>(TEST_LCD_STREAM_SIZE), panel.lcd->getStreamBufferSize());
+
+    const int width = 200;
+    const int height = 150;
+    auto bitmap = make_bitmap(20, 40, width, height);
+    auto psram = static_cast<uint16_t *>(heap_caps_malloc(bitmap.size() * 2, MALLOC_CAP_SPIRAM));
+    TEST_ASSERT_TRUE(psram != nullptr);
+    memcpy(psram, bitmap.data(), bitmap.size() * 2);
+
+    TEST_ASSERT_TRUE(panel.lcd->drawBitmap(20, 40, width, height, reinterpret_cast<const uint8_t *>(psram), -1));
+    // The bitmap is copied into the stream buffers, it can be modified right away
+    memset(psram, 0, bitmap.size() * 2);
+    TEST_ASSERT_TRUE(panel.io->waitIdle());
+    TEST_ASSERT_TRUE(check_rect(panel.io, 20, 40, width, height));
+    // Split into the strips of the stream buffers
+    TEST_ASSERT_TRUE(panel.io->getStats().color_trans_count > 1);
+    heap_caps_free(psram);
+
+    TEST_ASSERT_TRUE(panel.lcd->del());
+    TEST_ASSERT_TRUE(panel.bus->del());
+}
+
+TEST_CASE("Test LCD address window cache", "[lcd][driver]")
+{
+    TestPanel panel;
+    create_panel(panel, 0);
+    TEST_ASSERT_TRUE(panel.is_ready);
+    auto io = panel.io;
+    auto lcd = panel.lcd;
+    auto rect = make_bitmap(17, 33, 50, 21);
+    auto draw_rect = [&]() {
+        return lcd->drawBitmap(17, 33, 50, 21, reinterpret_cast<const uint8_t *>(rect.data()), -1);
+    };
+
+    // An unchanged window is not sent again
+    TEST_ASSERT_TRUE(draw_rect());
+    io->clearCommands();
+    io->clearFrameBuffer();
+    TEST_ASSERT_TRUE(draw_rect());
+    TEST_ASSERT_EQUAL(0, count_commands(io, LCD_CMD_CASET));
+    TEST_ASSERT_EQUAL(0, count_commands(io, LCD_CMD_RASET));
+    TEST_ASSERT_TRUE(check_rect(io, 17, 33, 50, 21));
+
+    // The window of a full frame is kept, the first strip restarts the write and the ones below only continue it
+    auto full = make_bitmap(0, 0, TEST_LCD_WIDTH, TEST_LCD_HEIGHT);
+    TEST_ASSERT_TRUE(lcd->drawBitmap(
+                         0, 0, TEST_LCD_WIDTH, TEST_LCD_HEIGHT, reinterpret_cast<const uint8_t *>(full.data()), -1
+                     ));
+    io->clearCommands();
+    io->clearFrameBuffer();
+    const int strip_height = 32;
+    const int strip_num = TEST_LCD_HEIGHT / strip_height;
+    uint32_t ramwrc_count = io->getStats().ramwrc_count;
+    for (int i = 0; i < strip_num; i++) {
+        auto strip = make_bitmap(0, i * strip_height, TEST_LCD_WIDTH, strip_height);
+        TEST_ASSERT_TRUE(lcd->drawBitmap(
+                             0, i * strip_height, TEST_LCD_WIDTH, strip_height,
+                             reinterpret_cast<const uint8_t *>(strip.data()), -1
+                         ));
+    }
+    TEST_ASSERT_EQUAL(static_cast<uint32_t>(strip_num - 1), io->getStats().ramwrc_count - ramwrc_count);
+    TEST_ASSERT_EQUAL(0, count_commands(io, LCD_CMD_CASET));
+    TEST_ASSERT_EQUAL(0, count_commands(io, LCD_CMD_RASET));
+    TEST_ASSERT_TRUE(check_rect(io, 0, 0, TEST_LCD_WIDTH, TEST_LCD_HEIGHT));
+
+    // The window is sent again after the panel's address state may have changed
+    auto check_resent = [&]() {
+        io->clearCommands();
+        io->clearFrameBuffer();
+        if (!draw_rect()) {
+            return false;
+        }
+        return (count_commands(io, LCD_CMD_CASET) == 1) && (count_commands(io, LCD_CMD_RASET) == 1) &&
+               check_rect(io, 17, 33, 50, 21);
+    };
+    TEST_ASSERT_TRUE(draw_rect());
+    TEST_ASSERT_TRUE(lcd->mirrorX(true));
+    TEST_ASSERT_TRUE(check_resent());
+    TEST_ASSERT_TRUE(lcd->swapXY(true));
+    TEST_ASSERT_TRUE(check_resent());
+    TEST_ASSERT_TRUE(lcd->swapXY(false));
+    TEST_ASSERT_TRUE(lcd->mirrorX(false));
+    TEST_ASSERT_TRUE(draw_rect());
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_panel_reset(lcd->getRefreshPanelHandle()));
+    TEST_ASSERT_TRUE(check_resent());
+
+    // A failed write leaves the panel in an unknown state
+    io->setTxError(ESP_FAIL);
+    TEST_ASSERT_FALSE(draw_rect());
+    io->setTxError(ESP_OK);
+    TEST_ASSERT_TRUE(check_resent());
+
+    TEST_ASSERT_TRUE(lcd->del());
+    TEST_ASSERT_TRUE(panel.bus->del());
+}
+
+HOST_TEST_MAIN()
@@ -0,0 +1,218 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "host_test.hpp"
+#include "drivers/lcd/esp_panel_lcd_palette.hpp"
+
+using namespace esp_panel::drivers;
+
+using IndexFormat = LCD_Palette::IndexFormat;
+using PixelFormat = LCD_ColorConvert::PixelFormat;
+
+static const IndexFormat INDEX_FORMATS[] = {IndexFormat::I1, IndexFormat::I2, IndexFormat::I4, IndexFormat::I8};
+
+static int get_index(IndexFormat format, const uint8_t *data, size_t pixel)
+{
+    int bits = LCD_Palette::getBitsPerIndex(format);
+    size_t bit_pos = pixel * bits;
+    return (data[bit_pos / 8] >> (8 - bits - bit_pos % 8)) & ((1 << bits) - 1);
+}
+
+static uint32_t make_color(int index)
+{
+    uint32_t r = (index * 37 + 11) & 0xff;
+    uint32_t g = (index * 91 + 3) & 0xff;
+    uint32_t b = (index * 53 + 200) & 0xff;
+    return (r << 16) | (g << 8) | b;
+}
+
+static void setup_palette(LCD_Palette &palette, IndexFormat index_format, PixelFormat pixel_format)
+{
+    TEST_ASSERT_TRUE(palette.configure(index_format, pixel_format));
+    std::vector<uint32_t> colors(palette.getColorNum());
+    for (size_t i = 0; i < colors.size(); i++) {
+        colors[i] = make_color(i);
+    }
+    TEST_ASSERT_TRUE(palette.setColors(0, colors.data(), colors.size()));
+}
+
+TEST_CASE("Test palette color packing", "[lcd][palette]")
+{
+    LCD_Palette palette;
+    uint32_t color = 0x12c3f4;
+
+    TEST_ASSERT_TRUE(palette.configure(IndexFormat::I8, PixelFormat::RGB565));
+    TEST_ASSERT_TRUE(palette.setColors(5, &color, 1));
+    uint32_t rgb565 = ((0x12 >> 3) << 11) | ((0xc3 >> 2) << 5) | (0xf4 >> 3);
+    TEST_ASSERT_EQUAL(rgb565, palette.getPixel(5));
+    TEST_ASSERT_EQUAL(0U, palette.getPixel(4));
+
+    TEST_ASSERT_TRUE(palette.configure(IndexFormat::I8, PixelFormat::RGB888));
+    TEST_ASSERT_EQUAL(0U, palette.getPixel(5));
+    TEST_ASSERT_TRUE(palette.setColors(5, &color, 1));
+    TEST_ASSERT_EQUAL(0xf4c312U, palette.getPixel(5));
+
+    TEST_ASSERT_FALSE(palette.configure(IndexFormat::I8, PixelFormat::RGB666));
+    TEST_ASSERT_FALSE(palette.configure(IndexFormat::I8, PixelFormat::ARGB8888));
+}
+
+TEST_CASE("Test palette color range", "[lcd][palette]")
+{
+    LCD_Palette palette;
+    std::vector<uint32_t> colors(LCD_Palette::COLOR_NUM_MAX, 0xffffff);
+
+    TEST_ASSERT_TRUE(palette.configure(IndexFormat::I4, PixelFormat::RGB565));
+    TEST_ASSERT_EQUAL(16, palette.getColorNum());
+    TEST_ASSERT_TRUE(palette.setColors(0, colors.data(), 16));
+    TEST_ASSERT_TRUE(palette.setColors(15, colors.data(), 1));
+    TEST_ASSERT_FALSE(palette.setColors(15, colors.data(), 2));
+    TEST_ASSERT_FALSE(palette.setColors(-1, colors.data(), 1));
+    TEST_ASSERT_FALSE(palette.setColors(0, nullptr, 1));
+
+    TEST_ASSERT_TRUE(palette.configure(IndexFormat::I1, PixelFormat::RGB565));
+    TEST_ASSERT_EQUAL(2, palette.getColorNum());
+    TEST_ASSERT_FALSE(palette.setColors(0, colors.data(), 3));
+}
+
+TEST_CASE("Test palette expansion for all formats, offsets and lengths", "[lcd][palette]")
+{
+    const int max_offset = 9;
+    const int max_count = 41;
+    std::vector<uint8_t> frame(64);
+    srand(1);
+    for (auto &value : frame) {
+        value = rand() & 0xff;
+    }
+
+    for (auto index_format : INDEX_FORMATS) {
+        for (auto pixel_format : {PixelFormat::RGB565, PixelFormat::RGB888}) {
+            LCD_Palette palette;
+            setup_palette(palette, index_format, pixel_format);
+            int bytes_per_pixel = LCD_ColorConvert::getBytesPerPixel(pixel_format);
+
+            for (int offset = 0; offset < max_offset; offset++) {
+                for (int count = 0; count <= max_count; count++) {
+                    // Check both the 32-bit aligned and unaligned destinations
+                    for (int dst_offset = 0; dst_offset <= 2; dst_offset += 2) {
+                        std::vector<uint8_t> dst((max_count + 4) * bytes_per_pixel, 0xa5);
+                        palette.expand(frame.data(), offset, count, dst.data() + dst_offset);
+                        for (int i = 0; i < count; i++) {
+                            uint32_t pixel = palette.getPixel(get_index(index_format, frame.data(), offset + i));
+                            const uint8_t *out = dst.data() + dst_offset + i * bytes_per_pixel;
+                            if (pixel_format == PixelFormat::RGB565) {
+                                uint16_t value = 0;
+                                memcpy(&value, out, sizeof(value));
+                                TEST_ASSERT_EQUAL(pixel, static_cast<uint32_t>(value));
+                            } else {
+                                TEST_ASSERT_EQUAL(pixel & 0xff, static_cast<uint32_t>(out[0]));
+                                TEST_ASSERT_EQUAL((pixel >> 8) & 0xff, static_cast<uint32_t>(out[1]));
+                                TEST_ASSERT_EQUAL((pixel >> 16) & 0xff, static_cast<uint32_t>(out[2]));
+                            }
+                        }
+                        // Make sure nothing is written outside
+                        TEST_ASSERT_EQUAL(0xa5, dst[dst_offset + count * bytes_per_pixel]);
+                        if (dst_offset > 0) {
+                            TEST_ASSERT_EQUAL(0xa5, dst[0]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Test palette I4 pairs follow partial color updates", "[lcd][palette]")
+{
+    // Only the first 4 bytes are used by the 8 pixels of I4
+    const std::vector<uint8_t> frame = {0x31, 0x13, 0x33, 0x45, 0x00, 0x00, 0x00, 0x00};
+    const int indexes[] = {3, 1, 1, 3, 3, 3, 4, 5};
+    const int pixel_num = sizeof(indexes) / sizeof(indexes[0]);
+    uint32_t color = 0xff0000;
+
+    for (auto pixel_format : {PixelFormat::RGB565, PixelFormat::RGB888}) {
+        LCD_Palette palette;
+        setup_palette(palette, IndexFormat::I4, pixel_format);
+        TEST_ASSERT_TRUE(palette.setColors(3, &color, 1));
+
+        int bytes_per_pixel = LCD_ColorConvert::getBytesPerPixel(pixel_format);
+        std::vector<uint8_t> dst(pixel_num * bytes_per_pixel);
+        palette.expand(frame.data(), 0, pixel_num, dst.data());
+        for (int i = 0; i < pixel_num; i++) {
+            uint32_t value = 0;
+            memcpy(&value, dst.data() + i * bytes_per_pixel, bytes_per_pixel);
+            TEST_ASSERT_EQUAL(palette.getPixel(indexes[i]), value);
+        }
+        TEST_ASSERT_EQUAL((pixel_format == PixelFormat::RGB565) ? 0xf800U : 0x0000ffU, palette.getPixel(3));
+    }
+}
+
+TEST_CASE("Test palette frame buffer size", "[lcd][palette]")
+{
+    TEST_ASSERT_EQUAL(static_cast<size_t>(800 * 480), LCD_Palette::getFrameBufferSize(IndexFormat::I8, 800, 480));
+    TEST_ASSERT_EQUAL(static_cast<size_t>(800 * 480 / 2), LCD_Palette::getFrameBufferSize(IndexFormat::I4, 800, 480));
+    TEST_ASSERT_EQUAL(static_cast<size_t>(2), LCD_Palette::getFrameBufferSize(IndexFormat::I1, 3, 3));
+    TEST_ASSERT_EQUAL(static_cast<size_t>(0), LCD_Palette::getFrameBufferSize(IndexFormat::I8, 0, 480));
+}
+
+TEST_CASE("Test palette index copy into the frame buffer", "[lcd][palette]")
+{
+    const int frame_width = 27;
+    const int frame_height = 9;
+    srand(2);
+
+    for (auto format : INDEX_FORMATS) {
+        int bits = LCD_Palette::getBitsPerIndex(format);
+        size_t frame_size = LCD_Palette::getFrameBufferSize(format, frame_width, frame_height);
+        for (int round = 0; round < 200; round++) {
+            int width = rand() % frame_width + 1;
+            int height = rand() % frame_height + 1;
+            int x = rand() % (frame_width - width + 1);
+            int y = rand() % (frame_height - height + 1);
+            int src_stride = (width * bits + 7) / 8 + rand() % 2;
+
+            std::vector<uint8_t> src(src_stride * height);
+            for (auto &value : src) {
+                value = rand() & 0xff;
+            }
+            std::vector<uint8_t> frame(frame_size + 1);
+            for (auto &value : frame) {
+                value = rand() & 0xff;
+            }
+            std::vector<uint8_t> origin = frame;
+
+            TEST_ASSERT_TRUE(LCD_Palette::copyIndices(
+                format, src.data(), width, height, src_stride, frame.data(), frame_width, x, y
+            ));
+            for (int row = 0; row < frame_height; row++) {
+                for (int col = 0; col < frame_width; col++) {
+                    size_t pixel = row * frame_width + col;
+                    bool is_inside = (col >= x) && (col < x + width) && (row >= y) && (row < y + height);
+                    int expected = is_inside ?
+                                   get_index(format, src.data() + (row - y) * src_stride, col - x) :
+                                   get_index(format, origin.data(), pixel);
+                    TEST_ASSERT_EQUAL(expected, get_index(format, frame.data(), pixel));
+                }
+            }
+            TEST_ASSERT_EQUAL(origin[frame_size], frame[frame_size]);
+        }
+    }
+}
+
+TEST_CASE("Test palette index copy with invalid parameters", "[lcd][palette]")
+{
+    uint8_t src[16] = {};
+    uint8_t frame[64] = {};
+
+    TEST_ASSERT_FALSE(LCD_Palette::copyIndices(IndexFormat::I8, src, 9, 1, 0, frame, 8, 0, 0));
+    TEST_ASSERT_FALSE(LCD_Palette::copyIndices(IndexFormat::I8, src, 4, 1, 0, frame, 8, 5, 0));
+    TEST_ASSERT_FALSE(LCD_Palette::copyIndices(IndexFormat::I8, src, 4, 2, 3, frame, 8, 0, 0));
+    TEST_ASSERT_FALSE(LCD_Palette::copyIndices(IndexFormat::I8, nullptr, 4, 1, 0, frame, 8, 0, 0));
+    TEST_ASSERT_TRUE(LCD_Palette::copyIndices(IndexFormat::I4, src, 4, 2, 2, frame, 8, 4, 7));
+}
+
+HOST_TEST_MAIN()
@@ -0,0 +1,149 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include "host_test.hpp"
+#include "drivers/lcd/esp_panel_lcd_refresh_monitor.hpp"
+
+using namespace esp_panel::drivers;
+
+static constexpr int FRAME_US = 25000;     // 40 Hz
+static constexpr int BOUNCE_US = 1000;      // 20 bounce buffers per frame, the rest is blanking
+static constexpr int BOUNCE_NUM = 20;
+
+/**
+ * Simulated RGB panel: fills the bounce buffers of each frame, then finishes the frame
+ */
+struct SimulatedPanel {
+    // Run a frame, the fill `late_fill` (if not negative) is delayed by `delay_us`
+    void runFrame(LCD_RefreshMonitor &monitor, int late_fill = -1, int delay_us = 0)
+    {
+        int64_t fill_us = frame_start_us;
+        for (int i = 0; i < BOUNCE_NUM; i++) {
+            monitor.onBounceFill(fill_us + ((i == late_fill) ? delay_us : 0));
+            fill_us += BOUNCE_US;
+        }
+        frame_start_us += FRAME_US;
+        monitor.onFrameFinish(frame_start_us + extra_frame_us);
+    }
+
+    int64_t frame_start_us = 1000000;
+    int extra_frame_us = 0;
+};
+
+TEST_CASE("Test refresh monitor with regular frames", "[lcd][refresh_monitor]")
+{
+    LCD_RefreshMonitor monitor;
+    monitor.configure(FRAME_US, BOUNCE_US, LCD_RefreshMonitor::TOLERANCE_PERCENT_DEFAULT);
+    SimulatedPanel panel;
+
+    for (int i = 0; i < 100; i++) {
+        panel.runFrame(monitor);
+    }
+    TEST_ASSERT_EQUAL(100U, monitor.getFrameCount());
+    TEST_ASSERT_EQUAL(0U, monitor.getLateFrameCount());
+    TEST_ASSERT_EQUAL(0U, monitor.getLateFillCount());
+    TEST_ASSERT_FALSE(monitor.isRestartPending());
+    TEST_ASSERT_FALSE(monitor.takeRestartRequest());
+}
+
+TEST_CASE("Test refresh monitor with late bounce fills", "[lcd][refresh_monitor]")
+{
+    LCD_RefreshMonitor monitor;
+    monitor.configure(FRAME_US, BOUNCE_US, LCD_RefreshMonitor::TOLERANCE_PERCENT_DEFAULT);
+    SimulatedPanel panel;
+
+    panel.runFrame(monitor);
+    // Within the tolerance
+    panel.runFrame(monitor, 5, BOUNCE_US / 5);
+    TEST_ASSERT_EQUAL(0U, monitor.getLateFillCount());
+
+    // Late, the frame is counted once and requests a restart
+    panel.runFrame(monitor, 5, BOUNCE_US / 2);
+    TEST_ASSERT_EQUAL(1U, monitor.getLateFillCount());
+    TEST_ASSERT_EQUAL(1U, monitor.getLateFrameCount());
+    TEST_ASSERT_TRUE(monitor.isRestartPending());
+
+    // The first fill of a frame follows the blanking, it is never late
+    panel.runFrame(monitor, 0, BOUNCE_US * 3);
+    TEST_ASSERT_EQUAL(1U, monitor.getLateFillCount());
+    TEST_ASSERT_EQUAL(1U, monitor.getLateFrameCount());
+
+    TEST_ASSERT_TRUE(monitor.takeRestartRequest());
+    TEST_ASSERT_FALSE(monitor.isRestartPending());
+    TEST_ASSERT_FALSE(monitor.takeRestartRequest());
+    TEST_ASSERT_EQUAL(1U, monitor.getRestartCount());
+    TEST_ASSERT_EQUAL(4U, monitor.getFrameCount());
+}
+
+TEST_CASE("Test refresh monitor with late frames", "[lcd][refresh_monitor]")
+{
+    LCD_RefreshMonitor monitor;
+    monitor.configure(FRAME_US, BOUNCE_US, LCD_RefreshMonitor::TOLERANCE_PERCENT_DEFAULT);
+    SimulatedPanel panel;
+
+    // The first frame has no interval to check
+    panel.extra_frame_us = FRAME_US;
+    panel.runFrame(monitor);
+    TEST_ASSERT_EQUAL(0U, monitor.getDelayedFrameCount());
+
+    panel.extra_frame_us = 0;
+    panel.runFrame(monitor);
+    panel.runFrame(monitor);
+    TEST_ASSERT_EQUAL(0U, monitor.getDelayedFrameCount());
+
+    // A late frame interrupt is only the interrupt latency, it is counted without requesting a restart
+    panel.frame_start_us += FRAME_US / 2;
+    panel.runFrame(monitor);
+    TEST_ASSERT_EQUAL(1U, monitor.getDelayedFrameCount());
+    TEST_ASSERT_EQUAL(0U, monitor.getLateFrameCount());
+    TEST_ASSERT_FALSE(monitor.isRestartPending());
+
+    panel.runFrame(monitor, 3, BOUNCE_US);
+    TEST_ASSERT_EQUAL(1U, monitor.getLateFrameCount());
+    TEST_ASSERT_TRUE(monitor.takeRestartRequest());
+
+    // The restart shifts the next frame, it is not checked
+    panel.frame_start_us += FRAME_US / 2;
+    panel.runFrame(monitor);
+    panel.runFrame(monitor);
+    TEST_ASSERT_EQUAL(1U, monitor.getDelayedFrameCount());
+    TEST_ASSERT_EQUAL(1U, monitor.getLateFrameCount());
+    TEST_ASSERT_FALSE(monitor.isRestartPending());
+}
+
+TEST_CASE("Test refresh monitor without bounce buffers", "[lcd][refresh_monitor]")
+{
+    LCD_RefreshMonitor monitor;
+    monitor.configure(FRAME_US, 0, LCD_RefreshMonitor::TOLERANCE_PERCENT_DEFAULT);
+    SimulatedPanel panel;
+
+    panel.runFrame(monitor);
+    panel.runFrame(monitor, 3, BOUNCE_US * 10);
+    panel.frame_start_us += FRAME_US;
+    panel.runFrame(monitor);
+    TEST_ASSERT_EQUAL(0U, monitor.getLateFillCount());
+    TEST_ASSERT_EQUAL(0U, monitor.getLateFrameCount());
+    TEST_ASSERT_EQUAL(1U, monitor.getDelayedFrameCount());
+    TEST_ASSERT_FALSE(monitor.isRestartPending());
+}
+
+TEST_CASE("Test refresh monitor reconfiguration", "[lcd][refresh_monitor]")
+{
+    LCD_RefreshMonitor monitor;
+    monitor.configure(FRAME_US, BOUNCE_US, 0);
+    SimulatedPanel panel;
+
+    panel.runFrame(monitor);
+    panel.runFrame(monitor, 2, 1);
+    TEST_ASSERT_EQUAL(1U, monitor.getLateFrameCount());
+
+    monitor.configure(FRAME_US, BOUNCE_US, 0);
+    TEST_ASSERT_EQUAL(0U, monitor.getFrameCount());
+    TEST_ASSERT_EQUAL(0U, monitor.getLateFrameCount());
+    TEST_ASSERT_EQUAL(0U, monitor.getDelayedFrameCount());
+    TEST_ASSERT_FALSE(monitor.isRestartPending());
+}
+
+HOST_TEST_MAIN()
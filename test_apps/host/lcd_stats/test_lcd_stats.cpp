@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cstdio>
+#include "host_test.hpp"
+#include "drivers/lcd/esp_panel_lcd_stats.hpp"
+
+using namespace esp_panel::drivers;
+
+TEST_CASE("Test stats latency buckets", "[lcd][stats]")
+{
+    TEST_ASSERT_EQUAL(0, LCD_Stats::getLatencyBucketIndex(0));
+    TEST_ASSERT_EQUAL(0, LCD_Stats::getLatencyBucketIndex(1));
+    TEST_ASSERT_EQUAL(1, LCD_Stats::getLatencyBucketIndex(2));
+    TEST_ASSERT_EQUAL(1, LCD_Stats::getLatencyBucketIndex(3));
+    TEST_ASSERT_EQUAL(10, LCD_Stats::getLatencyBucketIndex(1024));
+    TEST_ASSERT_EQUAL(10, LCD_Stats::getLatencyBucketIndex(2047));
+    TEST_ASSERT_EQUAL(LCD_Stats::LATENCY_BUCKET_NUM - 1, LCD_Stats::getLatencyBucketIndex(0xffffffff));
+
+    for (int i = 0; i < LCD_Stats::LATENCY_BUCKET_NUM; i++) {
+        TEST_ASSERT_EQUAL(i, LCD_Stats::getLatencyBucketIndex(LCD_Stats::getLatencyBucketLowerUs(i)));
+    }
+}
+
+TEST_CASE("Test stats draw bitmap latency", "[lcd][stats]")
+{
+    LCD_Stats stats;
+    TEST_ASSERT_EQUAL(0U, stats.getLatencyPercentileUs(50));
+
+    // 90 transfers of 1500 us and 10 of 5000 us, two in flight at a time
+    int64_t time_us = 1000;
+    for (uint32_t token = 1; token <= 100; token += 2) {
+        uint32_t latency_us = (token > 90) ? 5000 : 1500;
+        stats.onDrawBitmapSubmit(token, time_us);
+        stats.onDrawBitmapSent(1000);
+        stats.onDrawBitmapSubmit(token + 1, time_us + 10);
+        stats.onDrawBitmapSent(1000);
+        stats.onDrawBitmapFinish(token, time_us + latency_us);
+        stats.onDrawBitmapFinish(token + 1, time_us + 10 + latency_us);
+        time_us += 10000;
+    }
+
+    TEST_ASSERT_EQUAL(100U, stats.getDrawBitmapCount());
+    TEST_ASSERT_EQUAL(100000ULL, stats.getDrawBitmapBytes());
+    TEST_ASSERT_EQUAL(100U, stats.getLatencyCount());
+    TEST_ASSERT_EQUAL(90U, stats.getLatencyBucket(10));
+    TEST_ASSERT_EQUAL(10U, stats.getLatencyBucket(12));
+    TEST_ASSERT_EQUAL(1500U, stats.getLatencyMinUs());
+    TEST_ASSERT_EQUAL(5000U, stats.getLatencyMaxUs());
+    TEST_ASSERT_EQUAL(1850U, stats.getLatencyAverageUs());
+    TEST_ASSERT_EQUAL(2048U, stats.getLatencyPercentileUs(50));
+    TEST_ASSERT_EQUAL(2048U, stats.getLatencyPercentileUs(90));
+    TEST_ASSERT_EQUAL(5000U, stats.getLatencyPercentileUs(99));
+
+    // A finish without a submission (or finished twice) is not measured
+    stats.onDrawBitmapFinish(100, time_us);
+    stats.onDrawBitmapFinish(101, time_us);
+    TEST_ASSERT_EQUAL(100U, stats.getLatencyCount());
+}
+
+TEST_CASE("Test stats with too many transfers in flight", "[lcd][stats]")
+{
+    LCD_Stats stats;
+    int num = LCD_Stats::PENDING_DRAW_NUM + 4;
+    for (int i = 1; i <= num; i++) {
+        stats.onDrawBitmapSubmit(i, i * 100);
+    }
+    for (int i = 1; i <= num; i++) {
+        stats.onDrawBitmapFinish(i, 100000);
+    }
+    // The submission times of the oldest ones are overwritten
+    TEST_ASSERT_EQUAL(static_cast<uint32_t>(LCD_Stats::PENDING_DRAW_NUM), stats.getLatencyCount());
+    TEST_ASSERT_EQUAL(static_cast<uint32_t>(100000 - num * 100), stats.getLatencyMinUs());
+}
+
+TEST_CASE("Test stats refresh rate and waits", "[lcd][stats]")
+{
+    LCD_Stats stats;
+    stats.onRefreshFinish(1000);
+    TEST_ASSERT_EQUAL(0, static_cast<int>(stats.getRefreshRate()));
+
+    int64_t time_us = 1000;
+    for (int i = 0; i < 100; i++) {
+        time_us += 16667;
+        stats.onRefreshFinish(time_us);
+    }
+    TEST_ASSERT_EQUAL(101U, stats.getRefreshCount());
+    TEST_ASSERT_EQUAL(60, static_cast<int>(stats.getRefreshRate() + 0.5f));
+
+    // Follow a new rate
+    for (int i = 0; i < 100; i++) {
+        time_us += 33333;
+        stats.onRefreshFinish(time_us);
+    }
+    TEST_ASSERT_EQUAL(30, static_cast<int>(stats.getRefreshRate() + 0.5f));
+
+    stats.onWaitFinish(300);
+    stats.onWaitFinish(700);
+    TEST_ASSERT_EQUAL(2U, stats.getWaitCount());
+    TEST_ASSERT_EQUAL(1000LL, stats.getWaitTimeUs());
+    TEST_ASSERT_EQUAL(700LL, stats.getWaitMaxUs());
+
+    stats.reset();
+    TEST_ASSERT_EQUAL(0U, stats.getRefreshCount());
+    TEST_ASSERT_EQUAL(0U, stats.getWaitCount());
+    TEST_ASSERT_EQUAL(0, static_cast<int>(stats.getRefreshRate()));
+}
+
+TEST_CASE("Test stats text", "[lcd][stats]")
+{
+    LCD_Stats stats;
+    stats.onDrawBitmapSubmit(1, 1000);
+    stats.onDrawBitmapSent(2048);
+    stats.onDrawBitmapFinish(1, 4000);
+    stats.onRefreshFinish(1000);
+    stats.onRefreshFinish(21000);
+    stats.onWaitFinish(2500);
+
+    std::string text = stats.toString();
+    printf("%s", text.c_str());
+    TEST_ASSERT_TRUE(text.find("Draw bitmap: 1 transfers, 2048 bytes\n") != std::string::npos);
+    TEST_ASSERT_TRUE(text.find("  [2048, 4096) us: 1\n") != std::string::npos);
+    TEST_ASSERT_TRUE(text.find("Refresh: 2 frames, 50.00 Hz\n") != std::string::npos);
+    TEST_ASSERT_TRUE(text.find("Wait: 1 times, total 2500 us, max 2500 us\n") != std::string::npos);
+}
+
+HOST_TEST_MAIN()
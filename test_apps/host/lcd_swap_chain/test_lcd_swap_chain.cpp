@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include "host_test.hpp"
+#include "drivers/lcd/esp_panel_lcd_swap_chain.hpp"
+
+using namespace esp_panel::drivers;
+
+using BufferState = LCD_SwapChain::BufferState;
+using PresentMode = LCD_SwapChain::PresentMode;
+
+static uint8_t frame_buffers[LCD_SwapChain::BUFFER_NUM_MAX][16];
+static void *const buffers[LCD_SwapChain::BUFFER_NUM_MAX] = {frame_buffers[0], frame_buffers[1], frame_buffers[2]};
+
+TEST_CASE("Test swap chain initialization", "[lcd][swap_chain]")
+{
+    LCD_SwapChain chain;
+    TEST_ASSERT_FALSE(chain.init(buffers, 1, PresentMode::FIFO));
+    TEST_ASSERT_FALSE(chain.init(buffers, 4, PresentMode::FIFO));
+    void *const invalid[2] = {frame_buffers[0], nullptr};
+    TEST_ASSERT_FALSE(chain.init(invalid, 2, PresentMode::FIFO));
+    TEST_ASSERT_FALSE(chain.isInit());
+
+    TEST_ASSERT_TRUE(chain.init(buffers, 3, PresentMode::FIFO));
+    TEST_ASSERT_TRUE(chain.isInit());
+    TEST_ASSERT_EQUAL(0, chain.getFrontIndex());
+    TEST_ASSERT_TRUE(chain.getState(0) == BufferState::FRONT);
+    TEST_ASSERT_EQUAL(2, chain.getIndex(frame_buffers[2]));
+    TEST_ASSERT_EQUAL(-1, chain.getIndex(nullptr));
+
+    chain.deinit();
+    TEST_ASSERT_FALSE(chain.isInit());
+}
+
+TEST_CASE("Test swap chain double buffering in FIFO mode", "[lcd][swap_chain]")
+{
+    LCD_SwapChain chain;
+    TEST_ASSERT_TRUE(chain.init(buffers, 2, PresentMode::FIFO));
+
+    int index = chain.acquire();
+    TEST_ASSERT_EQUAL(1, index);
+    TEST_ASSERT_EQUAL(0, chain.getAge(index));
+    TEST_ASSERT_EQUAL(-1, chain.getLatestIndex());
+    // The front buffer can't be acquired
+    TEST_ASSERT_EQUAL(-1, chain.acquire());
+    TEST_ASSERT_TRUE(chain.present(index));
+    TEST_ASSERT_EQUAL(index, chain.getLatestIndex());
+    TEST_ASSERT_FALSE(chain.canPresent());
+
+    // Until the refresh finishes, buffer 0 is still scanned out
+    TEST_ASSERT_EQUAL(-1, chain.acquire());
+    TEST_ASSERT_TRUE(chain.onRefreshFinish());
+    TEST_ASSERT_FALSE(chain.onRefreshFinish());
+    TEST_ASSERT_EQUAL(1, chain.getFrontIndex());
+    TEST_ASSERT_TRUE(chain.canPresent());
+
+    index = chain.acquire();
+    TEST_ASSERT_EQUAL(0, index);
+    TEST_ASSERT_EQUAL(0, chain.getAge(index));
+    TEST_ASSERT_TRUE(chain.present(index));
+    TEST_ASSERT_TRUE(chain.onRefreshFinish());
+
+    // From now on, each buffer holds the frame before the previous one
+    for (int i = 0; i < 10; i++) {
+        index = chain.acquire();
+        TEST_ASSERT_EQUAL(2, chain.getAge(index));
+        TEST_ASSERT_TRUE(chain.present(index));
+        TEST_ASSERT_TRUE(chain.onRefreshFinish());
+    }
+    TEST_ASSERT_EQUAL(12, static_cast<int>(chain.getPresentCount()));
+    TEST_ASSERT_EQUAL(0, static_cast<int>(chain.getDroppedCount()));
+}
+
+TEST_CASE("Test swap chain triple buffering", "[lcd][swap_chain]")
+{
+    LCD_SwapChain chain;
+    TEST_ASSERT_TRUE(chain.init(buffers, 3, PresentMode::FIFO));
+
+    // Render two frames ahead while the first one is not shown yet
+    int a = chain.acquire();
+    TEST_ASSERT_TRUE(chain.present(a));
+    int b = chain.acquire();
+    TEST_ASSERT_TRUE(b >= 0);
+    TEST_ASSERT_TRUE(b != a);
+    // FIFO waits for the queued buffer
+    TEST_ASSERT_FALSE(chain.canPresent());
+    TEST_ASSERT_FALSE(chain.present(b));
+    TEST_ASSERT_TRUE(chain.onRefreshFinish());
+    TEST_ASSERT_TRUE(chain.present(b));
+    TEST_ASSERT_TRUE(chain.onRefreshFinish());
+
+    // The most recent free buffer is chosen
+    int c = chain.acquire();
+    TEST_ASSERT_EQUAL(a, c);
+    TEST_ASSERT_EQUAL(2, chain.getAge(c));
+    TEST_ASSERT_TRUE(chain.release(c));
+    TEST_ASSERT_FALSE(chain.release(c));
+}
+
+TEST_CASE("Test swap chain mailbox mode", "[lcd][swap_chain]")
+{
+    LCD_SwapChain chain;
+    TEST_ASSERT_TRUE(chain.init(buffers, 3, PresentMode::MAILBOX));
+
+    int a = chain.acquire();
+    TEST_ASSERT_TRUE(chain.present(a));
+    int b = chain.acquire();
+    // Never waits, the queued buffer is replaced
+    TEST_ASSERT_TRUE(chain.canPresent());
+    TEST_ASSERT_TRUE(chain.present(b));
+    TEST_ASSERT_TRUE(chain.getState(a) == BufferState::FREE);
+    TEST_ASSERT_EQUAL(1, static_cast<int>(chain.getDroppedCount()));
+    TEST_ASSERT_EQUAL(b, chain.getQueuedIndex());
+
+    TEST_ASSERT_TRUE(chain.onRefreshFinish());
+    TEST_ASSERT_EQUAL(b, chain.getFrontIndex());
+    // The dropped buffer still holds a complete frame
+    int c = chain.acquire();
+    TEST_ASSERT_EQUAL(a, c);
+    TEST_ASSERT_EQUAL(2, chain.getAge(c));
+
+    // Presenting a buffer which is not acquired fails
+    TEST_ASSERT_FALSE(chain.present(b));
+    TEST_ASSERT_FALSE(chain.present(-1));
+}
+
+HOST_TEST_MAIN()
@@ -0,0 +1,177 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cmath>
+#include <cstdlib>
+#include "host_test.hpp"
+#include "drivers/lcd/esp_panel_lcd_tear_sync.hpp"
+
+using namespace esp_panel::drivers;
+
+static constexpr int PANEL_WIDTH = 240;
+static constexpr int PANEL_HEIGHT = 320;
+static constexpr int PERIOD_US = 16667;     // 60 Hz
+
+/**
+ * Simulated TE source: the panel starts scanning a frame every `period_us`, with an optional jitter
+ */
+struct SimulatedPanel {
+    int64_t getEdgeTime(int frame) const
+    {
+        int64_t jitter = (jitter_us > 0) ? ((rand() % (2 * jitter_us + 1)) - jitter_us) : 0;
+        return start_us + static_cast<int64_t>(frame) * period_us + jitter;
+    }
+
+    // Check if a write started at `start_us` shows a mix of old and new rows in any frame
+    bool isTearing(int64_t write_start_us, int64_t write_us, int y_start, int height) const
+    {
+        int64_t write_end_us = write_start_us + write_us;
+        int frame_first = static_cast<int>((write_start_us - start_us) / period_us) - 1;
+        int frame_last = static_cast<int>((write_end_us - start_us) / period_us) + 1;
+        for (int frame = frame_first; frame <= frame_last; frame++) {
+            int new_rows = 0;
+            int old_rows = 0;
+            for (int row = y_start; row < y_start + height; row++) {
+                double show_us = start_us + (frame + static_cast<double>(row) / PANEL_HEIGHT) * period_us;
+                double written_us = write_start_us + static_cast<double>(row - y_start) / height * write_us;
+                // Ignore the rounding of the integer scheduler
+                if (std::fabs(show_us - written_us) < 2) {
+                    continue;
+                }
+                (written_us < show_us) ? new_rows++ : old_rows++;
+            }
+            if ((new_rows > 0) && (old_rows > 0)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    int64_t start_us = 1000000;
+    int period_us = PERIOD_US;
+    int jitter_us = 0;
+};
+
+static void feed_edges(LCD_TearSync &sync, const SimulatedPanel &panel, int frame_start, int frame_num)
+{
+    for (int frame = frame_start; frame < frame_start + frame_num; frame++) {
+        sync.onTearingEffect(panel.getEdgeTime(frame));
+    }
+}
+
+TEST_CASE("Test TE refresh rate measurement", "[lcd][tear_sync]")
+{
+    srand(1);
+    LCD_TearSync sync;
+    SimulatedPanel panel;
+    panel.jitter_us = 50;
+    sync.configure(PANEL_HEIGHT);
+
+    // Not locked until enough pulses are received
+    feed_edges(sync, panel, 0, LCD_TearSync::LOCK_EDGE_NUM);
+    TEST_ASSERT_FALSE(sync.isLocked());
+    TEST_ASSERT_EQUAL(0, sync.getPeriodUs());
+    TEST_ASSERT_EQUAL(0, static_cast<int>(sync.getWaitTime(panel.start_us, 0, PANEL_HEIGHT, 1)));
+
+    feed_edges(sync, panel, LCD_TearSync::LOCK_EDGE_NUM, 100);
+    TEST_ASSERT_TRUE(sync.isLocked());
+    TEST_ASSERT_TRUE(std::abs(sync.getPeriodUs() - PERIOD_US) < 50);
+    TEST_ASSERT_TRUE(std::fabs(sync.getRefreshRate() - 60) < 0.2f);
+    TEST_ASSERT_EQUAL(LCD_TearSync::LOCK_EDGE_NUM + 100, static_cast<int>(sync.getEdgeCount()));
+}
+
+TEST_CASE("Test TE missed and glitch pulses", "[lcd][tear_sync]")
+{
+    srand(2);
+    LCD_TearSync sync;
+    SimulatedPanel panel;
+    sync.configure(PANEL_HEIGHT);
+    feed_edges(sync, panel, 0, 20);
+
+    // Every third pulse is missed, the intervals are divided by the number of periods
+    for (int frame = 20; frame < 200; frame++) {
+        if (frame % 3 != 0) {
+            sync.onTearingEffect(panel.getEdgeTime(frame));
+        }
+    }
+    TEST_ASSERT_TRUE(std::abs(sync.getPeriodUs() - PERIOD_US) < 5);
+
+    // A glitch right after a pulse is dropped
+    sync.onTearingEffect(panel.getEdgeTime(200));
+    sync.onTearingEffect(panel.getEdgeTime(200) + 300);
+    sync.onTearingEffect(panel.getEdgeTime(201));
+    TEST_ASSERT_TRUE(std::abs(sync.getPeriodUs() - PERIOD_US) < 5);
+    TEST_ASSERT_EQUAL(panel.getEdgeTime(201), sync.getEdgeTime());
+
+    // Pulses out of the valid range are ignored before the period is known
+    sync.configure(PANEL_HEIGHT);
+    for (int i = 0; i < 10; i++) {
+        sync.onTearingEffect(panel.start_us + i * (LCD_TearSync::PERIOD_MAX_US + 1));
+    }
+    TEST_ASSERT_FALSE(sync.isLocked());
+}
+
+static void test_schedule(int64_t full_frame_write_us)
+{
+    srand(3);
+    LCD_TearSync sync;
+    SimulatedPanel panel;
+    sync.configure(PANEL_HEIGHT);
+    feed_edges(sync, panel, 0, 10);
+    sync.onWriteFinish(PANEL_WIDTH * PANEL_HEIGHT, full_frame_write_us);
+    TEST_ASSERT_TRUE(sync.getPeriodUs() == PERIOD_US);
+
+    int waited = 0;
+    for (int i = 0; i < 2000; i++) {
+        int64_t now_us = panel.getEdgeTime(9) + rand() % PERIOD_US;
+        int y_start = rand() % PANEL_HEIGHT;
+        int height = 1 + rand() % (PANEL_HEIGHT - y_start);
+        if (i % 10 == 0) {
+            y_start = 0;
+            height = PANEL_HEIGHT;
+        }
+
+        int pixels = PANEL_WIDTH * height;
+        int64_t wait_us = sync.getWaitTime(now_us, y_start, height, pixels);
+        TEST_ASSERT_TRUE((wait_us >= 0) && (wait_us <= PERIOD_US));
+        waited += (wait_us > 0) ? 1 : 0;
+        // A write longer than a frame can't avoid the scanline, it just starts right after TE
+        int64_t write_us = sync.getWriteTimeUs(pixels);
+        if (write_us <= PERIOD_US) {
+            TEST_ASSERT_FALSE(panel.isTearing(now_us + wait_us, write_us, y_start, height));
+        }
+    }
+    // Most of the writes don't need to wait
+    TEST_ASSERT_TRUE(waited < 2000 / 2);
+}
+
+TEST_CASE("Test TE scheduling with a write faster than the scan", "[lcd][tear_sync]")
+{
+    test_schedule(PERIOD_US * 6 / 10);
+}
+
+TEST_CASE("Test TE scheduling with a write slower than the scan", "[lcd][tear_sync]")
+{
+    test_schedule(PERIOD_US * 9 / 5);
+}
+
+TEST_CASE("Test TE scheduling of a full frame", "[lcd][tear_sync]")
+{
+    LCD_TearSync sync;
+    SimulatedPanel panel;
+    sync.configure(PANEL_HEIGHT);
+    feed_edges(sync, panel, 0, 10);
+    sync.onWriteFinish(PANEL_WIDTH * PANEL_HEIGHT, PERIOD_US / 2);
+
+    // Right at TE the write races ahead of the scanline, so it starts at once
+    int64_t edge_us = panel.getEdgeTime(9);
+    TEST_ASSERT_EQUAL(0, static_cast<int>(sync.getWaitTime(edge_us, 0, PANEL_HEIGHT, PANEL_WIDTH * PANEL_HEIGHT)));
+    // In the middle of the frame it waits for the next TE
+    int64_t wait_us = sync.getWaitTime(edge_us + PERIOD_US / 2, 0, PANEL_HEIGHT, PANEL_WIDTH * PANEL_HEIGHT);
+    TEST_ASSERT_EQUAL(PERIOD_US - PERIOD_US / 2, static_cast<int>(wait_us));
+}
+
+HOST_TEST_MAIN()
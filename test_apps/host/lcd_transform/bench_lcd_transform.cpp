@@ -0,0 +1,50 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "host_test.hpp"
+#include "drivers/lcd/esp_panel_lcd_transform.hpp"
+
+using namespace esp_panel::drivers;
+
+#define BENCH_LOOP_COUNT    (20)
+
+static const LCD_Transform::BlockSize BLOCK_SIZES[] = {
+    {8, 8}, {16, 16}, {32, 32}, {32, 256}, {64, 64}, {128, 32}, {1 << 16, 1 << 16},
+};
+
+int main(int argc, char *argv[])
+{
+    int width = (argc > 1) ? atoi(argv[1]) : 1024;
+    int height = (argc > 2) ? atoi(argv[2]) : 600;
+
+    printf("Transform %dx%d, average of %d loops (MB/s of source data)\n", width, height, BENCH_LOOP_COUNT);
+    printf("%-6s %-10s %-12s %10s %10s\n", "bpp", "rotation", "block", "us", "MB/s");
+    for (int bpp : {16, 24, 32}) {
+        int bytes = LCD_Transform::getBytesPerPixel(bpp);
+        std::vector<uint8_t> src(width * height * bytes, 0x5a);
+        std::vector<uint8_t> dst(width * height * bytes);
+        for (auto rotation : {LCD_Transform::Rotation::ROTATE_90, LCD_Transform::Rotation::ROTATE_180}) {
+            LCD_Transform::Operation op = {rotation, false, false};
+            for (auto &block : BLOCK_SIZES) {
+                int64_t start_us = host_test::getTimeUs();
+                for (int i = 0; i < BENCH_LOOP_COUNT; i++) {
+                    LCD_Transform::transform(op, bpp, src.data(), width, height, 0, dst.data(), 0, block);
+                }
+                double time_us = static_cast<double>(host_test::getTimeUs() - start_us) / BENCH_LOOP_COUNT;
+                char block_str[32];
+                snprintf(block_str, sizeof(block_str), "%dx%d", block.width, block.height);
+                printf(
+                    "%-6d %-10d %-12s %10.1f %10.1f\n", bpp, (rotation == LCD_Transform::Rotation::ROTATE_90) ? 90 : 180,
+                    block_str, time_us, src.size() / time_us
+                );
+            }
+        }
+    }
+
+    return 0;
+}
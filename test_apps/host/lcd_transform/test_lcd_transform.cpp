@@ -0,0 +1,152 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cstring>
+#include <vector>
+#include "host_test.hpp"
+#include "drivers/lcd/esp_panel_lcd_transform.hpp"
+
+using namespace esp_panel::drivers;
+
+using Rotation = LCD_Transform::Rotation;
+
+static const Rotation ROTATIONS[] = {
+    Rotation::ROTATE_0, Rotation::ROTATE_90, Rotation::ROTATE_180, Rotation::ROTATE_270
+};
+static const int BITS_PER_PIXEL[] = {8, 16, 24, 32};
+
+static std::vector<uint8_t> make_image(int width, int height, int bytes_per_pixel)
+{
+    std::vector<uint8_t> image(width * height * bytes_per_pixel);
+    for (size_t i = 0; i < image.size(); i++) {
+        image[i] = static_cast<uint8_t>(i * 7 + i / 251);
+    }
+    return image;
+}
+
+// Reference implementation, copies pixel by pixel with the coordinate mapping documented in the header
+static void reference_transform(
+    const LCD_Transform::Operation &op, int bytes_per_pixel, const uint8_t *src, int width, int height, uint8_t *dst
+)
+{
+    int dst_width = op.isSwapXY() ? height : width;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            int mx = op.mirror_x ? (width - 1 - x) : x;
+            int my = op.mirror_y ? (height - 1 - y) : y;
+            int dx = mx;
+            int dy = my;
+            switch (op.rotation) {
+            case Rotation::ROTATE_90:
+                dx = my;
+                dy = width - 1 - mx;
+                break;
+            case Rotation::ROTATE_180:
+                dx = width - 1 - mx;
+                dy = height - 1 - my;
+                break;
+            case Rotation::ROTATE_270:
+                dx = height - 1 - my;
+                dy = mx;
+                break;
+            default:
+                break;
+            }
+            memcpy(
+                dst + (dy * dst_width + dx) * bytes_per_pixel, src + (y * width + x) * bytes_per_pixel, bytes_per_pixel
+            );
+        }
+    }
+}
+
+TEST_CASE("Test transform matches the reference for all operations", "[lcd][transform]")
+{
+    const int width = 37;
+    const int height = 23;
+    for (int bpp : BITS_PER_PIXEL) {
+        int bytes = bpp / 8;
+        auto src = make_image(width, height, bytes);
+        for (auto rotation : ROTATIONS) {
+            for (int mirror = 0; mirror < 4; mirror++) {
+                LCD_Transform::Operation op = {rotation, (mirror & 1) != 0, (mirror & 2) != 0};
+                std::vector<uint8_t> expected(src.size());
+                std::vector<uint8_t> actual(src.size(), 0);
+                reference_transform(op, bytes, src.data(), width, height, expected.data());
+                // Small blocks to cover the block edges
+                TEST_ASSERT_TRUE(
+                    LCD_Transform::transform(op, bpp, src.data(), width, height, 0, actual.data(), 0, {5, 3})
+                );
+                TEST_ASSERT_EQUAL_MEMORY(expected.data(), actual.data(), expected.size());
+            }
+        }
+    }
+}
+
+TEST_CASE("Test transformRect updates only the mapped area", "[lcd][transform]")
+{
+    const int width = 48;
+    const int height = 32;
+    const LCD_Transform::Rect rect = {5, 7, 20, 9};
+    for (int bpp : BITS_PER_PIXEL) {
+        int bytes = bpp / 8;
+        auto src = make_image(width, height, bytes);
+        for (auto rotation : ROTATIONS) {
+            LCD_Transform::Operation op = {rotation, false, true};
+            std::vector<uint8_t> full(src.size());
+            reference_transform(op, bytes, src.data(), width, height, full.data());
+
+            std::vector<uint8_t> actual(src.size(), 0);
+            TEST_ASSERT_TRUE(
+                LCD_Transform::transformRect(op, bpp, src.data(), width, height, 0, rect, actual.data(), 0)
+            );
+
+            auto dst_rect = LCD_Transform::mapRect(op, width, height, rect);
+            int dst_width = op.isSwapXY() ? height : width;
+            int dst_height = op.isSwapXY() ? width : height;
+            for (int y = 0; y < dst_height; y++) {
+                for (int x = 0; x < dst_width; x++) {
+                    bool inside = (x >= dst_rect.x) && (x < dst_rect.x + dst_rect.width) &&
+                                  (y >= dst_rect.y) && (y < dst_rect.y + dst_rect.height);
+                    const uint8_t *pixel = actual.data() + (y * dst_width + x) * bytes;
+                    if (inside) {
+                        TEST_ASSERT_EQUAL_MEMORY(full.data() + (y * dst_width + x) * bytes, pixel, bytes);
+                    } else {
+                        static const uint8_t zero[4] = {};
+                        TEST_ASSERT_EQUAL_MEMORY(zero, pixel, bytes);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Test mapRect swaps the size for 90/270 degrees", "[lcd][transform]")
+{
+    LCD_Transform::Operation op = {Rotation::ROTATE_90, false, false};
+    auto rect = LCD_Transform::mapRect(op, 320, 240, {0, 0, 320, 20});
+    TEST_ASSERT_EQUAL(0, rect.x);
+    TEST_ASSERT_EQUAL(0, rect.y);
+    TEST_ASSERT_EQUAL(20, rect.width);
+    TEST_ASSERT_EQUAL(320, rect.height);
+
+    op.rotation = Rotation::ROTATE_270;
+    rect = LCD_Transform::mapRect(op, 320, 240, {0, 20, 320, 20});
+    TEST_ASSERT_EQUAL(200, rect.x);
+    TEST_ASSERT_EQUAL(0, rect.y);
+    TEST_ASSERT_EQUAL(20, rect.width);
+    TEST_ASSERT_EQUAL(320, rect.height);
+}
+
+TEST_CASE("Test transform rejects invalid parameters", "[lcd][transform]")
+{
+    uint8_t buffer[16] = {};
+    LCD_Transform::Operation op = {};
+    TEST_ASSERT_FALSE(LCD_Transform::transform(op, 12, buffer, 2, 2, 0, buffer + 8, 0));
+    TEST_ASSERT_FALSE(LCD_Transform::transform(op, 16, nullptr, 2, 2, 0, buffer, 0));
+    TEST_ASSERT_FALSE(LCD_Transform::transformRect(op, 16, buffer, 2, 2, 0, {1, 1, 2, 2}, buffer + 8, 0));
+    TEST_ASSERT_EQUAL(3, LCD_Transform::getBytesPerPixel(18));
+}
+
+HOST_TEST_MAIN()
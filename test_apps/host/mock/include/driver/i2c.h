@@ -0,0 +1,44 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+/* Only the types used by the bus configurations, the I2C bus isn't simulated yet */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "driver/gpio.h"
+#include "esp_err.h"
+
+typedef int i2c_port_t;
+#define I2C_NUM_0               0
+#define I2C_NUM_1               1
+#define I2C_NUM_MAX             2
+
+typedef enum {
+    I2C_MODE_SLAVE = 0,
+    I2C_MODE_MASTER,
+} i2c_mode_t;
+
+#define I2C_SCLK_SRC_FLAG_FOR_NOMAL 0
+
+typedef struct {
+    i2c_mode_t mode;
+    int sda_io_num;
+    int scl_io_num;
+    bool sda_pullup_en;
+    bool scl_pullup_en;
+    union {
+        struct {
+            uint32_t clk_speed;
+        } master;
+        struct {
+            uint8_t addr_10bit_en;
+            uint16_t slave_addr;
+            uint32_t maximum_speed;
+        } slave;
+    };
+    uint32_t clk_flags;
+} i2c_config_t;
@@ -0,0 +1,62 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef enum {
+    SPI1_HOST = 0,
+    SPI2_HOST = 1,
+    SPI3_HOST = 2,
+    SPI_HOST_MAX,
+} spi_host_device_t;
+
+#define SPI_MASTER_FREQ_40M     (80 * 1000 * 1000 / 2)
+#define SPI_MASTER_FREQ_80M     (80 * 1000 * 1000)
+#define SPI_DMA_CH_AUTO         3
+#define SPICOMMON_BUSFLAG_MASTER (1 << 0)
+
+#define SPI_SWAP_DATA_TX(DATA, LEN) __builtin_bswap32((uint32_t)(DATA) << (32 - (LEN)))
+
+typedef struct {
+    union {
+        int mosi_io_num;
+        int data0_io_num;
+    };
+    union {
+        int miso_io_num;
+        int data1_io_num;
+    };
+    int sclk_io_num;
+    union {
+        int quadwp_io_num;
+        int data2_io_num;
+    };
+    union {
+        int quadhd_io_num;
+        int data3_io_num;
+    };
+    int data4_io_num;
+    int data5_io_num;
+    int data6_io_num;
+    int data7_io_num;
+    int max_transfer_sz;
+    uint32_t flags;
+    int isr_cpu_id;
+    int intr_flags;
+} spi_bus_config_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+esp_err_t spi_bus_initialize(spi_host_device_t host_id, const spi_bus_config_t *bus_config, int dma_chan);
+esp_err_t spi_bus_free(spi_host_device_t host_id);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,12 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#pragma once
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+
+#define BIT(nr)                 (1UL << (nr))
+#define BIT64(nr)               (1ULL << (nr))
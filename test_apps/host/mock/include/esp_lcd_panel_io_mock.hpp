@@ -0,0 +1,169 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+/**
+ * @file
+ * @brief Memory-backed panel IO of the host mock, created by `esp_lcd_new_panel_io_spi()`
+ *
+ * It decodes the MIPI-DCS commands sent by the panel drivers (`CASET`, `RASET`, `RAMWR`, `RAMWRC`, `COLMOD`) into a
+ * virtual frame buffer, and completes the color transfers from a worker thread as the DMA would: in order, after the
+ * time needed by the configured bus throughput, then calls the `on_color_trans_done` callback like an interrupt.
+ *
+ * The pixels are stored at the addresses of the panel memory, `MADCTL` is only recorded.
+ */
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "esp_lcd_panel_io.h"
+
+namespace esp_lcd_mock {
+
+class PanelIO {
+public:
+    /**
+     * Special value of the bus throughput, to derive it from the pixel clock of the IO configuration (1-line SPI)
+     */
+    static constexpr uint32_t BUS_THROUGHPUT_FROM_PCLK = UINT32_MAX;
+
+    struct Config {
+        int width = 240;                        // Columns of the panel memory
+        int height = 320;                       // Rows of the panel memory
+        uint32_t bus_bytes_per_second = 0;      // `0` finishes the transfers immediately
+    };
+
+    struct Command {
+        int cmd;
+        std::vector<uint8_t> params;
+    };
+
+    struct Stats {
+        uint32_t color_trans_count = 0;         // Number of the finished color transfers
+        uint64_t color_bytes = 0;               // Size of the finished color transfers
+        uint32_t param_count = 0;               // Number of the parameter transfers
+        uint32_t max_pending_num = 0;           // Maximum number of the color transfers in flight
+        uint32_t clipped_pixels = 0;            // Pixels written outside of the panel memory
+        uint32_t ramwrc_count = 0;              // Number of the `RAMWRC` transfers
+    };
+
+    using RxParamHandler = std::function<esp_err_t(int lcd_cmd, void *param, size_t param_size)>;
+
+    PanelIO(esp_lcd_panel_io_handle_t handle, const Config &config, const esp_lcd_panel_io_spi_config_t &io_config);
+    ~PanelIO();
+
+    PanelIO(const PanelIO &) = delete;
+    PanelIO &operator=(const PanelIO &) = delete;
+
+    /**
+     * Set the configuration of the panel IOs created later
+     */
+    static void setDefaultConfig(const Config &config);
+
+    /**
+     * Get the latest created panel IO, `nullptr` if it is deleted
+     */
+    static PanelIO *getLatest();
+
+    void setBusThroughput(uint32_t bytes_per_second);
+    uint32_t getBusThroughput() const;
+
+    /**
+     * Handle `esp_lcd_panel_io_rx_param()`, used to emulate the registers of the devices (e.g. touch controllers)
+     */
+    void setRxParamHandler(RxParamHandler handler);
+
+    /**
+     * Make `esp_lcd_panel_io_tx_param()` and `esp_lcd_panel_io_tx_color()` fail with the error, `ESP_OK` to recover
+     */
+    void setTxError(esp_err_t error);
+
+    /**
+     * Wait until all the color transfers are finished and their callbacks returned
+     */
+    bool waitIdle(uint32_t timeout_ms = 1000);
+
+    int getWidth() const
+    {
+        return _config.width;
+    }
+
+    int getHeight() const
+    {
+        return _config.height;
+    }
+
+    int getBytesPerPixel() const;
+
+    /**
+     * Get a pixel of the panel memory, its bytes are assembled in the order they were sent (little-endian), so a
+     * RGB565 pixel equals the `uint16_t` which was in the host memory
+     */
+    uint32_t getPixel(int x, int y) const;
+    std::vector<uint8_t> getFrameBuffer() const;
+    void clearFrameBuffer();
+
+    /**
+     * Get the commands sent by `esp_lcd_panel_io_tx_param()`, the memory writes aren't recorded
+     */
+    std::vector<Command> getCommands() const;
+    void clearCommands();
+    Stats getStats() const;
+
+    esp_err_t rxParam(int lcd_cmd, void *param, size_t param_size);
+    esp_err_t txParam(int lcd_cmd, const void *param, size_t param_size);
+    esp_err_t txColor(int lcd_cmd, const void *color, size_t color_size);
+    esp_err_t registerEventCallbacks(const esp_lcd_panel_io_callbacks_t *cbs, void *user_ctx);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Transfer {
+        int cmd;
+        const uint8_t *data;
+        size_t size;
+    };
+
+    void runWorker();
+    void applyParam(int lcd_cmd, const uint8_t *param, size_t param_size);
+    void writeColor(int lcd_cmd, const uint8_t *data, size_t size);
+    void writePixel(const uint8_t *pixel);
+    Clock::duration getTransferTime(size_t size) const;
+
+    esp_lcd_panel_io_handle_t _handle;
+    Config _config;
+    uint32_t _pclk_hz;
+    size_t _queue_depth;
+    esp_lcd_panel_io_color_trans_done_cb_t _on_color_trans_done;
+    void *_user_ctx;
+    RxParamHandler _rx_param_handler;
+    esp_err_t _tx_error = ESP_OK;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _queue_cond;
+    std::condition_variable _idle_cond;
+    std::deque<Transfer> _queue;
+    size_t _pending_num = 0;
+    bool _is_stopping = false;
+    Clock::time_point _bus_free_time;
+    std::thread _worker;
+
+    std::vector<uint8_t> _frame_buffer;
+    std::vector<Command> _commands;
+    Stats _stats;
+    uint8_t _colmod = 0x55;
+    int _window[4] = {};            // x_start, x_end, y_start, y_end, inclusive
+    int _cursor_x = 0;
+    int _cursor_y = 0;
+    uint8_t _pixel[4] = {};
+    int _pixel_fill = 0;
+};
+
+} // namespace esp_lcd_mock
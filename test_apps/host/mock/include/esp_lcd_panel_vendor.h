@@ -0,0 +1,23 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#pragma once
+
+#include "esp_lcd_panel_ops.h"
+#include "esp_lcd_types.h"
+
+typedef struct {
+    int reset_gpio_num;
+    union {
+        lcd_rgb_element_order_t rgb_ele_order;
+        lcd_color_rgb_endian_t rgb_endian;
+    };
+    lcd_rgb_data_endian_t data_endian;
+    uint32_t bits_per_pixel;
+    struct {
+        uint32_t reset_active_high: 1;
+    } flags;
+    void *vendor_config;
+} esp_lcd_panel_dev_config_t;
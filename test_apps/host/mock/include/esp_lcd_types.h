@@ -0,0 +1,37 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef struct esp_lcd_panel_io_t esp_lcd_panel_io_t;
+typedef struct esp_lcd_panel_t esp_lcd_panel_t;
+typedef esp_lcd_panel_io_t *esp_lcd_panel_io_handle_t;
+typedef esp_lcd_panel_t *esp_lcd_panel_handle_t;
+
+typedef enum {
+    LCD_RGB_ELEMENT_ORDER_RGB,
+    LCD_RGB_ELEMENT_ORDER_BGR,
+} lcd_rgb_element_order_t;
+typedef lcd_rgb_element_order_t lcd_color_rgb_endian_t;
+#define LCD_RGB_ENDIAN_RGB      LCD_RGB_ELEMENT_ORDER_RGB
+#define LCD_RGB_ENDIAN_BGR      LCD_RGB_ELEMENT_ORDER_BGR
+
+typedef enum {
+    LCD_RGB_DATA_ENDIAN_BIG = 0,
+    LCD_RGB_DATA_ENDIAN_LITTLE,
+} lcd_rgb_data_endian_t;
+
+typedef enum {
+    LCD_COLOR_PIXEL_FORMAT_RGB565 = 16,
+    LCD_COLOR_PIXEL_FORMAT_RGB666 = 18,
+    LCD_COLOR_PIXEL_FORMAT_RGB888 = 24,
+} lcd_color_rgb_pixel_format_t;
+
+typedef int lcd_clock_source_t;
+#define LCD_CLK_SRC_DEFAULT     0
@@ -0,0 +1,164 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+/**
+ * @file
+ * @brief Host stand-in of the `esp-lib-utils` component, only what the library uses
+ */
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef __cplusplus
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+#endif
+
+#define ESP_UTILS_LOG_LEVEL_DEBUG   0
+#define ESP_UTILS_LOG_LEVEL_INFO    1
+#define ESP_UTILS_LOG_LEVEL_WARNING 2
+#define ESP_UTILS_LOG_LEVEL_ERROR   3
+#define ESP_UTILS_CONF_LOG_LEVEL    ESP_UTILS_LOG_LEVEL_WARNING
+
+#define ESP_UTILS_LOG_PRINT(level, format, ...) do {                                        \
+        if (ESP_UTILS_LOG_LEVEL_##level >= ESP_UTILS_CONF_LOG_LEVEL) {                      \
+            printf("[" #level "] [%s:%d] " format "\n", __FUNCTION__, __LINE__, ##__VA_ARGS__); \
+        }                                                                                   \
+    } while (0)
+
+#define ESP_UTILS_LOGD(format, ...) ESP_UTILS_LOG_PRINT(DEBUG, format, ##__VA_ARGS__)
+#define ESP_UTILS_LOGI(format, ...) ESP_UTILS_LOG_PRINT(INFO, format, ##__VA_ARGS__)
+#define ESP_UTILS_LOGW(format, ...) ESP_UTILS_LOG_PRINT(WARNING, format, ##__VA_ARGS__)
+#define ESP_UTILS_LOGE(format, ...) ESP_UTILS_LOG_PRINT(ERROR, format, ##__VA_ARGS__)
+
+#define ESP_UTILS_LOG_TRACE_ENTER()
+#define ESP_UTILS_LOG_TRACE_EXIT()
+#define ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS()
+#define ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS()
+
+#define ESP_UTILS_CHECK_NULL_RETURN(x, ret, format, ...) do {   \
+        if ((x) == NULL) {                                   \
+            ESP_UTILS_LOGE(format, ##__VA_ARGS__);              \
+            return ret;                                         \
+        }                                                       \
+    } while (0)
+
+#define ESP_UTILS_CHECK_FALSE_RETURN(x, ret, format, ...) do {  \
+        if (!(x)) {                                             \
+            ESP_UTILS_LOGE(format, ##__VA_ARGS__);              \
+            return ret;                                         \
+        }                                                       \
+    } while (0)
+
+#define ESP_UTILS_CHECK_ERROR_RETURN(x, ret, format, ...) do {  \
+        if ((x) != 0) {                                         \
+            ESP_UTILS_LOGE(format, ##__VA_ARGS__);              \
+            return ret;                                         \
+        }                                                       \
+    } while (0)
+
+#define ESP_UTILS_CHECK_NULL_EXIT(x, format, ...) do {          \
+        if ((x) == NULL) {                                   \
+            ESP_UTILS_LOGE(format, ##__VA_ARGS__);              \
+            return;                                             \
+        }                                                       \
+    } while (0)
+
+#define ESP_UTILS_CHECK_FALSE_EXIT(x, format, ...) do {         \
+        if (!(x)) {                                             \
+            ESP_UTILS_LOGE(format, ##__VA_ARGS__);              \
+            return;                                             \
+        }                                                       \
+    } while (0)
+
+#define ESP_UTILS_CHECK_ERROR_EXIT(x, format, ...) do {         \
+        if ((x) != 0) {                                         \
+            ESP_UTILS_LOGE(format, ##__VA_ARGS__);              \
+            return;                                             \
+        }                                                       \
+    } while (0)
+
+#define ESP_UTILS_CHECK_NULL_GOTO(x, goto_tag, format, ...) do { \
+        if ((x) == NULL) {                                   \
+            ESP_UTILS_LOGE(format, ##__VA_ARGS__);              \
+            goto goto_tag;                                      \
+        }                                                       \
+    } while (0)
+
+#define ESP_UTILS_CHECK_FALSE_GOTO(x, goto_tag, format, ...) do { \
+        if (!(x)) {                                             \
+            ESP_UTILS_LOGE(format, ##__VA_ARGS__);              \
+            goto goto_tag;                                      \
+        }                                                       \
+    } while (0)
+
+#ifdef __cplusplus
+#define ESP_UTILS_CHECK_EXCEPTION_RETURN(x, ret, format, ...) do { \
+        try {                                                   \
+            x;                                                  \
+        } catch (const std::exception &e) {                     \
+            ESP_UTILS_LOGE(format ": %s", ##__VA_ARGS__, e.what()); \
+            return ret;                                         \
+        }                                                       \
+    } while (0)
+
+namespace esp_utils {
+
+template <typename T>
+struct GeneralMemoryAllocator {
+    using value_type = T;
+
+    GeneralMemoryAllocator() = default;
+
+    template <typename U>
+    GeneralMemoryAllocator(const GeneralMemoryAllocator<U> &) {}
+
+    T *allocate(std::size_t n)
+    {
+        void *ptr = malloc(n * sizeof(T));
+        if (ptr == nullptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T *>(ptr);
+    }
+
+    void deallocate(T *p, std::size_t)
+    {
+        free(p);
+    }
+
+    // Construct in place so that `std::allocate_shared()` can use the private constructors of its friends
+    template <typename U, typename... Args>
+    void construct(U *p, Args &&... args)
+    {
+        ::new (static_cast<void *>(p)) U(std::forward<Args>(args)...);
+    }
+
+    template <typename U>
+    void destroy(U *p)
+    {
+        p->~U();
+    }
+
+    template <typename U>
+    bool operator==(const GeneralMemoryAllocator<U> &) const
+    {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const GeneralMemoryAllocator<U> &) const
+    {
+        return false;
+    }
+};
+
+} // namespace esp_utils
+#endif // __cplusplus
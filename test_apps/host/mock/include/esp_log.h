@@ -0,0 +1,14 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#pragma once
+
+#include <stdio.h>
+
+#define ESP_LOGE(tag, format, ...)  printf("E (%s) " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...)  printf("W (%s) " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...)  printf("I (%s) " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...)  do { if (0) { printf(format, ##__VA_ARGS__); } } while (0)
+#define ESP_LOGV(tag, format, ...)  do { if (0) { printf(format, ##__VA_ARGS__); } } while (0)
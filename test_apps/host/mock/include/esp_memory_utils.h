@@ -0,0 +1,21 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#pragma once
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+bool esp_ptr_external_ram(const void *p);
+bool esp_ptr_dma_capable(const void *p);
+bool esp_ptr_internal(const void *p);
+bool esp_ptr_in_iram(const void *p);
+
+#ifdef __cplusplus
+}
+#endif
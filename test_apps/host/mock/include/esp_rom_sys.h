@@ -0,0 +1,21 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define esp_rom_printf printf
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void esp_rom_delay_us(uint32_t us);
+
+#ifdef __cplusplus
+}
+#endif
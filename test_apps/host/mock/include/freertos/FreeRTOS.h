@@ -0,0 +1,62 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+/**
+ * @file
+ * @brief Host stand-in of the FreeRTOS kernel, backed by the host threads
+ *
+ * A tick is a millisecond since the start of the program. The critical sections are real spinlocks, since the
+ * simulated interrupts (e.g. the transfer done callbacks of the mock panel IO) run in other threads.
+ */
+#pragma once
+
+#include <stdint.h>
+#include "esp_attr.h"
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef uint32_t StackType_t;
+
+#define pdTRUE                  1
+#define pdFALSE                 0
+#define pdPASS                  pdTRUE
+#define pdFAIL                  pdFALSE
+#define portMAX_DELAY           ((TickType_t)0xffffffffUL)
+#define portTICK_PERIOD_MS      ((TickType_t)1000 / CONFIG_FREERTOS_HZ)
+#define pdMS_TO_TICKS(ms)       ((TickType_t)(((uint64_t)(ms) * CONFIG_FREERTOS_HZ) / 1000))
+#define portYIELD_FROM_ISR(...)
+#define configMAX_PRIORITIES    25
+#define tskNO_AFFINITY          0x7fffffff
+
+/* Large enough to hold the host semaphore, see `freertos.cpp` */
+typedef struct {
+    uint8_t storage[128] __attribute__((aligned(16)));
+} StaticSemaphore_t;
+
+typedef struct {
+    volatile int owner;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED    {0}
+#define portMUX_INITIALIZE(mux)         ((mux)->owner = 0)
+
+static inline void vPortEnterCritical(portMUX_TYPE *mux)
+{
+    while (__atomic_exchange_n(&mux->owner, 1, __ATOMIC_ACQUIRE)) {
+    }
+}
+
+static inline void vPortExitCritical(portMUX_TYPE *mux)
+{
+    __atomic_store_n(&mux->owner, 0, __ATOMIC_RELEASE);
+}
+
+#define portENTER_CRITICAL(mux)         vPortEnterCritical(mux)
+#define portEXIT_CRITICAL(mux)          vPortExitCritical(mux)
+#define portENTER_CRITICAL_ISR(mux)     vPortEnterCritical(mux)
+#define portEXIT_CRITICAL_ISR(mux)      vPortExitCritical(mux)
@@ -0,0 +1,33 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct tskTaskControlBlock *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void vTaskDelay(TickType_t ticks_to_delay);
+TickType_t xTaskGetTickCount(void);
+BaseType_t xTaskCreate(
+    TaskFunction_t task_code, const char *name, uint32_t stack_depth, void *parameters, UBaseType_t priority,
+    TaskHandle_t *created_task
+);
+BaseType_t xTaskCreatePinnedToCore(
+    TaskFunction_t task_code, const char *name, uint32_t stack_depth, void *parameters, UBaseType_t priority,
+    TaskHandle_t *created_task, BaseType_t core_id
+);
+/* Only a task deleting itself (`NULL`) is supported */
+void vTaskDelete(TaskHandle_t task);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+
+#ifdef __cplusplus
+}
+#endif
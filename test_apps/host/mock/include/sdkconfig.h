@@ -0,0 +1,20 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+/**
+ * @file
+ * @brief Host stand-in of the ESP-IDF `sdkconfig.h`, the drivers available on the host are selected here
+ */
+#pragma once
+
+#define CONFIG_IDF_TARGET_LINUX                         1
+#define CONFIG_FREERTOS_HZ                              1000
+
+#define CONFIG_ESP_PANEL_DRIVERS_FILE_SKIP              1
+#define CONFIG_ESP_PANEL_BOARD_FILE_SKIP                1
+
+#define CONFIG_ESP_PANEL_DRIVERS_BUS_USE_SPI            1
+#define CONFIG_ESP_PANEL_DRIVERS_LCD_USE_ST7789         1
+#define CONFIG_ESP_PANEL_DRIVERS_LCD_ENABLE_STATS       1
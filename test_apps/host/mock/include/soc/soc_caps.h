@@ -0,0 +1,10 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+/**
+ * @file
+ * @brief Host stand-in of the SoC capabilities, the host has none of the LCD peripherals (RGB, I80, MIPI-DSI)
+ */
+#pragma once
@@ -0,0 +1,123 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include "esp_lcd_panel_interface.h"
+#include "esp_lcd_panel_io_interface.h"
+#include "esp_lcd_panel_ops.h"
+
+/* Same dispatch as the `esp_lcd` component */
+
+extern "C" {
+
+esp_err_t esp_lcd_panel_io_rx_param(esp_lcd_panel_io_handle_t io, int lcd_cmd, void *param, size_t param_size)
+{
+    if ((io == nullptr) || (io->rx_param == nullptr)) {
+        return (io == nullptr) ? ESP_ERR_INVALID_ARG : ESP_ERR_NOT_SUPPORTED;
+    }
+    return io->rx_param(io, lcd_cmd, param, param_size);
+}
+
+esp_err_t esp_lcd_panel_io_tx_param(esp_lcd_panel_io_handle_t io, int lcd_cmd, const void *param, size_t param_size)
+{
+    return (io != nullptr) ? io->tx_param(io, lcd_cmd, param, param_size) : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t esp_lcd_panel_io_tx_color(esp_lcd_panel_io_handle_t io, int lcd_cmd, const void *color, size_t color_size)
+{
+    return (io != nullptr) ? io->tx_color(io, lcd_cmd, color, color_size) : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t esp_lcd_panel_io_del(esp_lcd_panel_io_handle_t io)
+{
+    return (io != nullptr) ? io->del(io) : ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_io_register_event_callbacks(
+    esp_lcd_panel_io_handle_t io, const esp_lcd_panel_io_callbacks_t *cbs, void *user_ctx
+)
+{
+    if ((io == nullptr) || (cbs == nullptr)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (io->register_event_callbacks == nullptr) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    return io->register_event_callbacks(io, cbs, user_ctx);
+}
+
+esp_err_t esp_lcd_panel_reset(esp_lcd_panel_handle_t panel)
+{
+    return (panel != nullptr) ? panel->reset(panel) : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t esp_lcd_panel_init(esp_lcd_panel_handle_t panel)
+{
+    return (panel != nullptr) ? panel->init(panel) : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t esp_lcd_panel_del(esp_lcd_panel_handle_t panel)
+{
+    return (panel != nullptr) ? panel->del(panel) : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t esp_lcd_panel_draw_bitmap(
+    esp_lcd_panel_handle_t panel, int x_start, int y_start, int x_end, int y_end, const void *color_data
+)
+{
+    if (panel == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return panel->draw_bitmap(panel, x_start, y_start, x_end, y_end, color_data);
+}
+
+esp_err_t esp_lcd_panel_mirror(esp_lcd_panel_handle_t panel, bool mirror_x, bool mirror_y)
+{
+    if ((panel == nullptr) || (panel->mirror == nullptr)) {
+        return (panel == nullptr) ? ESP_ERR_INVALID_ARG : ESP_ERR_NOT_SUPPORTED;
+    }
+    return panel->mirror(panel, mirror_x, mirror_y);
+}
+
+esp_err_t esp_lcd_panel_swap_xy(esp_lcd_panel_handle_t panel, bool swap_axes)
+{
+    if ((panel == nullptr) || (panel->swap_xy == nullptr)) {
+        return (panel == nullptr) ? ESP_ERR_INVALID_ARG : ESP_ERR_NOT_SUPPORTED;
+    }
+    return panel->swap_xy(panel, swap_axes);
+}
+
+esp_err_t esp_lcd_panel_set_gap(esp_lcd_panel_handle_t panel, int x_gap, int y_gap)
+{
+    if ((panel == nullptr) || (panel->set_gap == nullptr)) {
+        return (panel == nullptr) ? ESP_ERR_INVALID_ARG : ESP_ERR_NOT_SUPPORTED;
+    }
+    return panel->set_gap(panel, x_gap, y_gap);
+}
+
+esp_err_t esp_lcd_panel_invert_color(esp_lcd_panel_handle_t panel, bool invert_color_data)
+{
+    if ((panel == nullptr) || (panel->invert_color == nullptr)) {
+        return (panel == nullptr) ? ESP_ERR_INVALID_ARG : ESP_ERR_NOT_SUPPORTED;
+    }
+    return panel->invert_color(panel, invert_color_data);
+}
+
+esp_err_t esp_lcd_panel_disp_on_off(esp_lcd_panel_handle_t panel, bool on_off)
+{
+    if ((panel == nullptr) || (panel->disp_on_off == nullptr)) {
+        return (panel == nullptr) ? ESP_ERR_INVALID_ARG : ESP_ERR_NOT_SUPPORTED;
+    }
+    return panel->disp_on_off(panel, on_off);
+}
+
+esp_err_t esp_lcd_panel_disp_sleep(esp_lcd_panel_handle_t panel, bool sleep)
+{
+    if ((panel == nullptr) || (panel->disp_sleep == nullptr)) {
+        return (panel == nullptr) ? ESP_ERR_INVALID_ARG : ESP_ERR_NOT_SUPPORTED;
+    }
+    return panel->disp_sleep(panel, sleep);
+}
+
+} // extern "C"
@@ -0,0 +1,414 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <algorithm>
+#include <cstring>
+#include "esp_lcd_panel_commands.h"
+#include "esp_lcd_panel_io_interface.h"
+#include "esp_lcd_panel_io_mock.hpp"
+
+namespace esp_lcd_mock {
+
+namespace {
+
+struct MockPanelIO {
+    esp_lcd_panel_io_t base;
+    PanelIO *io;
+};
+
+std::mutex global_mutex;
+PanelIO::Config default_config;
+PanelIO *latest_io = nullptr;
+
+PanelIO *get_io(esp_lcd_panel_io_t *io)
+{
+    return reinterpret_cast<MockPanelIO *>(io)->io;
+}
+
+esp_err_t mock_rx_param(esp_lcd_panel_io_t *io, int lcd_cmd, void *param, size_t param_size)
+{
+    return get_io(io)->rxParam(lcd_cmd, param, param_size);
+}
+
+esp_err_t mock_tx_param(esp_lcd_panel_io_t *io, int lcd_cmd, const void *param, size_t param_size)
+{
+    return get_io(io)->txParam(lcd_cmd, param, param_size);
+}
+
+esp_err_t mock_tx_color(esp_lcd_panel_io_t *io, int lcd_cmd, const void *color, size_t color_size)
+{
+    return get_io(io)->txColor(lcd_cmd, color, color_size);
+}
+
+esp_err_t mock_register_event_callbacks(esp_lcd_panel_io_t *io, const esp_lcd_panel_io_callbacks_t *cbs, void *ctx)
+{
+    return get_io(io)->registerEventCallbacks(cbs, ctx);
+}
+
+esp_err_t mock_del(esp_lcd_panel_io_t *io)
+{
+    auto mock_io = reinterpret_cast<MockPanelIO *>(io);
+    delete mock_io->io;
+    delete mock_io;
+
+    return ESP_OK;
+}
+
+} // namespace
+
+PanelIO::PanelIO(
+    esp_lcd_panel_io_handle_t handle, const Config &config, const esp_lcd_panel_io_spi_config_t &io_config
+):
+    _handle(handle),
+    _config(config),
+    _pclk_hz(io_config.pclk_hz),
+    _queue_depth(std::max<size_t>(io_config.trans_queue_depth, 1)),
+    _on_color_trans_done(io_config.on_color_trans_done),
+    _user_ctx(io_config.user_ctx),
+    _bus_free_time(Clock::now()),
+    _frame_buffer(static_cast<size_t>(config.width) * config.height * 2)
+{
+    _window[1] = config.width - 1;
+    _window[3] = config.height - 1;
+    _worker = std::thread(&PanelIO::runWorker, this);
+
+    std::lock_guard<std::mutex> lock(global_mutex);
+    latest_io = this;
+}
+
+PanelIO::~PanelIO()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _is_stopping = true;
+    }
+    _queue_cond.notify_all();
+    _worker.join();
+
+    std::lock_guard<std::mutex> lock(global_mutex);
+    if (latest_io == this) {
+        latest_io = nullptr;
+    }
+}
+
+void PanelIO::setDefaultConfig(const Config &config)
+{
+    std::lock_guard<std::mutex> lock(global_mutex);
+    default_config = config;
+}
+
+PanelIO *PanelIO::getLatest()
+{
+    std::lock_guard<std::mutex> lock(global_mutex);
+    return latest_io;
+}
+
+void PanelIO::setBusThroughput(uint32_t bytes_per_second)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _config.bus_bytes_per_second = bytes_per_second;
+}
+
+uint32_t PanelIO::getBusThroughput() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_config.bus_bytes_per_second == BUS_THROUGHPUT_FROM_PCLK) {
+        return _pclk_hz / 8;
+    }
+    return _config.bus_bytes_per_second;
+}
+
+void PanelIO::setRxParamHandler(RxParamHandler handler)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _rx_param_handler = std::move(handler);
+}
+
+void PanelIO::setTxError(esp_err_t error)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _tx_error = error;
+}
+
+bool PanelIO::waitIdle(uint32_t timeout_ms)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    return _idle_cond.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this]() {
+        return _pending_num == 0;
+    });
+}
+
+int PanelIO::getBytesPerPixel() const
+{
+    // 16-bit for `0x55`, 18-bit and 24-bit are both sent as 3 bytes
+    return ((_colmod & 0x07) == 0x05) ? 2 : 3;
+}
+
+uint32_t PanelIO::getPixel(int x, int y) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if ((x < 0) || (x >= _config.width) || (y < 0) || (y >= _config.height)) {
+        return 0;
+    }
+
+    int bytes_per_pixel = getBytesPerPixel();
+    const uint8_t *pixel = _frame_buffer.data() + (static_cast<size_t>(y) * _config.width + x) * bytes_per_pixel;
+    uint32_t value = 0;
+    for (int i = bytes_per_pixel - 1; i >= 0; i--) {
+        value = (value << 8) | pixel[i];
+    }
+
+    return value;
+}
+
+std::vector<uint8_t> PanelIO::getFrameBuffer() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _frame_buffer;
+}
+
+void PanelIO::clearFrameBuffer()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::fill(_frame_buffer.begin(), _frame_buffer.end(), 0);
+}
+
+std::vector<PanelIO::Command> PanelIO::getCommands() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _commands;
+}
+
+void PanelIO::clearCommands()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _commands.clear();
+}
+
+PanelIO::Stats PanelIO::getStats() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _stats;
+}
+
+esp_err_t PanelIO::rxParam(int lcd_cmd, void *param, size_t param_size)
+{
+    RxParamHandler handler;
+    {
+        // Like the hardware, the read waits for the queued transfers
+        std::unique_lock<std::mutex> lock(_mutex);
+        _idle_cond.wait(lock, [this]() {
+            return _pending_num == 0;
+        });
+        handler = _rx_param_handler;
+    }
+
+    return handler ? handler(lcd_cmd, param, param_size) : ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t PanelIO::txParam(int lcd_cmd, const void *param, size_t param_size)
+{
+    if ((param == nullptr) && (param_size > 0)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (_tx_error != ESP_OK) {
+        return _tx_error;
+    }
+    _idle_cond.wait(lock, [this]() {
+        return _pending_num == 0;
+    });
+    applyParam(lcd_cmd, static_cast<const uint8_t *>(param), param_size);
+
+    return ESP_OK;
+}
+
+esp_err_t PanelIO::txColor(int lcd_cmd, const void *color, size_t color_size)
+{
+    if ((color == nullptr) && (color_size > 0)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    {
+        // Like `spi_device_queue_trans()`, block while the queue is full
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (_tx_error != ESP_OK) {
+            return _tx_error;
+        }
+        _idle_cond.wait(lock, [this]() {
+            return _pending_num < _queue_depth;
+        });
+        _queue.push_back({lcd_cmd, static_cast<const uint8_t *>(color), color_size});
+        _pending_num++;
+        _stats.max_pending_num = std::max<uint32_t>(_stats.max_pending_num, _pending_num);
+    }
+    _queue_cond.notify_one();
+
+    return ESP_OK;
+}
+
+esp_err_t PanelIO::registerEventCallbacks(const esp_lcd_panel_io_callbacks_t *cbs, void *user_ctx)
+{
+    if (cbs == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _on_color_trans_done = cbs->on_color_trans_done;
+    _user_ctx = user_ctx;
+
+    return ESP_OK;
+}
+
+void PanelIO::runWorker()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _queue_cond.wait(lock, [this]() {
+            return _is_stopping || !_queue.empty();
+        });
+        if (_queue.empty()) {
+            break;
+        }
+
+        // The transfers are sent back to back, each one starts when the previous one leaves the bus
+        Transfer transfer = _queue.front();
+        _bus_free_time = std::max(Clock::now(), _bus_free_time) + getTransferTime(transfer.size);
+        auto finish_time = _bus_free_time;
+        lock.unlock();
+        std::this_thread::sleep_until(finish_time);
+        lock.lock();
+
+        // The data is read at the end, so a buffer reused before the callback shows up as corrupted pixels
+        writeColor(transfer.cmd, transfer.data, transfer.size);
+        _queue.pop_front();
+        _stats.color_trans_count++;
+        _stats.color_bytes += transfer.size;
+        auto callback = _on_color_trans_done;
+        auto user_ctx = _user_ctx;
+        lock.unlock();
+        if (callback != nullptr) {
+            esp_lcd_panel_io_event_data_t edata = {};
+            callback(_handle, &edata, user_ctx);
+        }
+        lock.lock();
+        _pending_num--;
+        _idle_cond.notify_all();
+    }
+}
+
+void PanelIO::applyParam(int lcd_cmd, const uint8_t *param, size_t param_size)
+{
+    _stats.param_count++;
+    _commands.push_back({lcd_cmd, std::vector<uint8_t>(param, param + param_size)});
+
+    switch (lcd_cmd) {
+    case LCD_CMD_CASET:
+    case LCD_CMD_RASET:
+        if (param_size >= 4) {
+            int *range = _window + ((lcd_cmd == LCD_CMD_CASET) ? 0 : 2);
+            range[0] = (param[0] << 8) | param[1];
+            range[1] = (param[2] << 8) | param[3];
+        }
+        break;
+    case LCD_CMD_COLMOD:
+        if (param_size >= 1) {
+            _colmod = param[0];
+            _frame_buffer.assign(static_cast<size_t>(_config.width) * _config.height * getBytesPerPixel(), 0);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void PanelIO::writeColor(int lcd_cmd, const uint8_t *data, size_t size)
+{
+    if (lcd_cmd == LCD_CMD_RAMWR) {
+        _cursor_x = _window[0];
+        _cursor_y = _window[2];
+        _pixel_fill = 0;
+    } else if (lcd_cmd == LCD_CMD_RAMWRC) {
+        _stats.ramwrc_count++;
+    } else if (lcd_cmd >= 0) {
+        // Not a memory write, only record it
+        _commands.push_back({lcd_cmd, std::vector<uint8_t>(data, data + size)});
+        return;
+    }
+
+    int bytes_per_pixel = getBytesPerPixel();
+    for (size_t i = 0; i < size; i++) {
+        _pixel[_pixel_fill++] = data[i];
+        if (_pixel_fill == bytes_per_pixel) {
+            writePixel(_pixel);
+            _pixel_fill = 0;
+        }
+    }
+}
+
+void PanelIO::writePixel(const uint8_t *pixel)
+{
+    int bytes_per_pixel = getBytesPerPixel();
+    if ((_cursor_x < _config.width) && (_cursor_y < _config.height)) {
+        size_t offset = (static_cast<size_t>(_cursor_y) * _config.width + _cursor_x) * bytes_per_pixel;
+        memcpy(_frame_buffer.data() + offset, pixel, bytes_per_pixel);
+    } else {
+        _stats.clipped_pixels++;
+    }
+
+    // Raster order inside the window, wrap to its start at the end
+    if (++_cursor_x > _window[1]) {
+        _cursor_x = _window[0];
+        if (++_cursor_y > _window[3]) {
+            _cursor_y = _window[2];
+        }
+    }
+}
+
+PanelIO::Clock::duration PanelIO::getTransferTime(size_t size) const
+{
+    uint32_t bytes_per_second = _config.bus_bytes_per_second;
+    if (bytes_per_second == BUS_THROUGHPUT_FROM_PCLK) {
+        bytes_per_second = _pclk_hz / 8;
+    }
+    if (bytes_per_second == 0) {
+        return Clock::duration::zero();
+    }
+
+    return std::chrono::duration_cast<Clock::duration>(
+               std::chrono::nanoseconds(static_cast<uint64_t>(size) * 1000000000ULL / bytes_per_second)
+           );
+}
+
+} // namespace esp_lcd_mock
+
+using esp_lcd_mock::PanelIO;
+
+extern "C" esp_err_t esp_lcd_new_panel_io_spi(
+    esp_lcd_spi_bus_handle_t bus, const esp_lcd_panel_io_spi_config_t *io_config, esp_lcd_panel_io_handle_t *ret_io
+)
+{
+    (void)bus;
+    if ((io_config == nullptr) || (ret_io == nullptr)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    PanelIO::Config config;
+    {
+        std::lock_guard<std::mutex> lock(esp_lcd_mock::global_mutex);
+        config = esp_lcd_mock::default_config;
+    }
+    auto mock_io = new esp_lcd_mock::MockPanelIO();
+    mock_io->base.rx_param = esp_lcd_mock::mock_rx_param;
+    mock_io->base.tx_param = esp_lcd_mock::mock_tx_param;
+    mock_io->base.tx_color = esp_lcd_mock::mock_tx_color;
+    mock_io->base.del = esp_lcd_mock::mock_del;
+    mock_io->base.register_event_callbacks = esp_lcd_mock::mock_register_event_callbacks;
+    mock_io->io = new PanelIO(&mock_io->base, config, *io_config);
+    *ret_io = &mock_io->base;
+
+    return ESP_OK;
+}
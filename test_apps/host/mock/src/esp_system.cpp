@@ -0,0 +1,303 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <thread>
+#include "driver/gpio.h"
+#include "driver/spi_master.h"
+#include "esp_cpu.h"
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
+#include "esp_rom_sys.h"
+#include "esp_timer.h"
+
+using Clock = std::chrono::steady_clock;
+
+static const Clock::time_point start_time = Clock::now();
+
+/* Timer */
+
+struct esp_timer {
+    esp_timer_create_args_t args;
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::thread thread;
+    bool is_running = false;
+};
+
+/* Heap */
+
+static std::mutex heap_mutex;
+// Start address and size of the memory allocated with `MALLOC_CAP_SPIRAM`
+static std::map<uintptr_t, size_t> spiram_blocks;
+
+static bool is_spiram(const void *p)
+{
+    auto addr = reinterpret_cast<uintptr_t>(p);
+    std::lock_guard<std::mutex> lock(heap_mutex);
+    auto it = spiram_blocks.upper_bound(addr);
+    if (it == spiram_blocks.begin()) {
+        return false;
+    }
+    it--;
+    return addr < it->first + it->second;
+}
+
+static void *track_allocation(void *ptr, size_t size, uint32_t caps)
+{
+    if ((ptr != nullptr) && (caps & MALLOC_CAP_SPIRAM)) {
+        std::lock_guard<std::mutex> lock(heap_mutex);
+        spiram_blocks[reinterpret_cast<uintptr_t>(ptr)] = (size > 0) ? size : 1;
+    }
+    return ptr;
+}
+
+/* GPIO */
+
+static std::mutex gpio_mutex;
+static std::map<gpio_num_t, uint32_t> gpio_levels;
+
+extern "C" {
+
+const char *esp_err_to_name(esp_err_t code)
+{
+    switch (code) {
+    case ESP_OK:
+        return "ESP_OK";
+    case ESP_FAIL:
+        return "ESP_FAIL";
+    case ESP_ERR_NO_MEM:
+        return "ESP_ERR_NO_MEM";
+    case ESP_ERR_INVALID_ARG:
+        return "ESP_ERR_INVALID_ARG";
+    case ESP_ERR_INVALID_STATE:
+        return "ESP_ERR_INVALID_STATE";
+    case ESP_ERR_INVALID_SIZE:
+        return "ESP_ERR_INVALID_SIZE";
+    case ESP_ERR_NOT_FOUND:
+        return "ESP_ERR_NOT_FOUND";
+    case ESP_ERR_NOT_SUPPORTED:
+        return "ESP_ERR_NOT_SUPPORTED";
+    case ESP_ERR_TIMEOUT:
+        return "ESP_ERR_TIMEOUT";
+    default:
+        return "UNKNOWN ERROR";
+    }
+}
+
+int64_t esp_timer_get_time(void)
+{
+    // Start from 1 us, `0` is used as "not set" by the callers
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start_time).count() + 1;
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *create_args, esp_timer_handle_t *out_handle)
+{
+    if ((create_args == nullptr) || (create_args->callback == nullptr) || (out_handle == nullptr)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    auto timer = new esp_timer();
+    timer->args = *create_args;
+    *out_handle = timer;
+
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period)
+{
+    if ((timer == nullptr) || (period == 0)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (timer->is_running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->is_running = true;
+    timer->thread = std::thread([timer, period]() {
+        auto next_time = Clock::now() + std::chrono::microseconds(period);
+        auto is_stopped = [timer]() {
+            return !timer->is_running;
+        };
+        std::unique_lock<std::mutex> lock(timer->mutex);
+        while (!timer->cond.wait_until(lock, next_time, is_stopped)) {
+            lock.unlock();
+            timer->args.callback(timer->args.arg);
+            lock.lock();
+            next_time += std::chrono::microseconds(period);
+        }
+    });
+
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer)
+{
+    if (timer == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    {
+        std::lock_guard<std::mutex> lock(timer->mutex);
+        if (!timer->is_running) {
+            return ESP_ERR_INVALID_STATE;
+        }
+        timer->is_running = false;
+    }
+    timer->cond.notify_all();
+    if (timer->thread.joinable() && (timer->thread.get_id() != std::this_thread::get_id())) {
+        timer->thread.join();
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer)
+{
+    if (timer == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (timer->is_running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (timer->thread.joinable()) {
+        timer->thread.join();
+    }
+    delete timer;
+
+    return ESP_OK;
+}
+
+void esp_rom_delay_us(uint32_t us)
+{
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+uint32_t esp_cpu_get_cycle_count(void)
+{
+    // As a 1 GHz CPU
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start_time);
+    return static_cast<uint32_t>(elapsed.count());
+}
+
+void *heap_caps_malloc(size_t size, uint32_t caps)
+{
+    return track_allocation(malloc(size), size, caps);
+}
+
+void *heap_caps_calloc(size_t n, size_t size, uint32_t caps)
+{
+    return track_allocation(calloc(n, size), n * size, caps);
+}
+
+void *heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps)
+{
+    return track_allocation(aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment), size, caps);
+}
+
+void heap_caps_free(void *ptr)
+{
+    if (ptr == nullptr) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(heap_mutex);
+        spiram_blocks.erase(reinterpret_cast<uintptr_t>(ptr));
+    }
+    free(ptr);
+}
+
+size_t heap_caps_get_free_size(uint32_t)
+{
+    return SIZE_MAX;
+}
+
+bool esp_ptr_external_ram(const void *p)
+{
+    return is_spiram(p);
+}
+
+bool esp_ptr_dma_capable(const void *p)
+{
+    return !is_spiram(p);
+}
+
+bool esp_ptr_internal(const void *p)
+{
+    return !is_spiram(p);
+}
+
+bool esp_ptr_in_iram(const void *)
+{
+    return true;
+}
+
+esp_err_t gpio_config(const gpio_config_t *cfg)
+{
+    return (cfg != nullptr) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t gpio_install_isr_service(int)
+{
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_add(gpio_num_t, gpio_isr_t isr_handler, void *)
+{
+    return (isr_handler != nullptr) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t gpio_isr_handler_remove(gpio_num_t)
+{
+    return ESP_OK;
+}
+
+esp_err_t gpio_intr_enable(gpio_num_t)
+{
+    return ESP_OK;
+}
+
+esp_err_t gpio_intr_disable(gpio_num_t)
+{
+    return ESP_OK;
+}
+
+esp_err_t gpio_reset_pin(gpio_num_t gpio_num)
+{
+    std::lock_guard<std::mutex> lock(gpio_mutex);
+    gpio_levels.erase(gpio_num);
+
+    return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t gpio_num)
+{
+    std::lock_guard<std::mutex> lock(gpio_mutex);
+    auto it = gpio_levels.find(gpio_num);
+
+    return (it != gpio_levels.end()) ? static_cast<int>(it->second) : 0;
+}
+
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level)
+{
+    std::lock_guard<std::mutex> lock(gpio_mutex);
+    gpio_levels[gpio_num] = level ? 1 : 0;
+
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_initialize(spi_host_device_t host_id, const spi_bus_config_t *bus_config, int)
+{
+    return ((host_id < SPI_HOST_MAX) && (bus_config != nullptr)) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t spi_bus_free(spi_host_device_t host_id)
+{
+    return (host_id < SPI_HOST_MAX) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+} // extern "C"
@@ -0,0 +1,226 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+using Clock = std::chrono::steady_clock;
+
+static const Clock::time_point start_time = Clock::now();
+
+struct QueueDefinition {
+    QueueDefinition(UBaseType_t max_count, UBaseType_t initial_count, bool is_static):
+        max_count(max_count),
+        count(initial_count),
+        is_static(is_static)
+    {
+    }
+
+    std::mutex mutex;
+    std::condition_variable cond;
+    UBaseType_t max_count;
+    UBaseType_t count;
+    bool is_static;
+    // Only used by the recursive mutex
+    std::thread::id owner;
+    UBaseType_t recursion = 0;
+};
+
+static_assert(sizeof(QueueDefinition) <= sizeof(StaticSemaphore_t), "StaticSemaphore_t is too small");
+
+static SemaphoreHandle_t create_semaphore(UBaseType_t max_count, UBaseType_t initial_count, StaticSemaphore_t *buffer)
+{
+    if (buffer != nullptr) {
+        return new (buffer->storage) QueueDefinition(max_count, initial_count, true);
+    }
+    return new (std::nothrow) QueueDefinition(max_count, initial_count, false);
+}
+
+static std::chrono::milliseconds ticks_to_duration(TickType_t ticks)
+{
+    return std::chrono::milliseconds(static_cast<uint64_t>(ticks) * 1000 / CONFIG_FREERTOS_HZ);
+}
+
+static bool wait_ticks(std::unique_lock<std::mutex> &lock, SemaphoreHandle_t semaphore, TickType_t ticks_to_wait)
+{
+    auto ready = [semaphore]() {
+        return semaphore->count > 0;
+    };
+    if (ticks_to_wait == portMAX_DELAY) {
+        semaphore->cond.wait(lock, ready);
+        return true;
+    }
+    return semaphore->cond.wait_for(lock, ticks_to_duration(ticks_to_wait), ready);
+}
+
+extern "C" {
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return create_semaphore(1, 0, nullptr);
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t *buffer)
+{
+    return (buffer != nullptr) ? create_semaphore(1, 0, buffer) : nullptr;
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max_count, UBaseType_t initial_count)
+{
+    return create_semaphore(max_count, initial_count, nullptr);
+}
+
+SemaphoreHandle_t xSemaphoreCreateCountingStatic(
+    UBaseType_t max_count, UBaseType_t initial_count, StaticSemaphore_t *buffer
+)
+{
+    return (buffer != nullptr) ? create_semaphore(max_count, initial_count, buffer) : nullptr;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return create_semaphore(1, 1, nullptr);
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex(void)
+{
+    return create_semaphore(1, 1, nullptr);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait)
+{
+    std::unique_lock<std::mutex> lock(semaphore->mutex);
+    if (!wait_ticks(lock, semaphore, ticks_to_wait)) {
+        return pdFALSE;
+    }
+    semaphore->count--;
+
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait)
+{
+    std::unique_lock<std::mutex> lock(semaphore->mutex);
+    if ((semaphore->recursion > 0) && (semaphore->owner == std::this_thread::get_id())) {
+        semaphore->recursion++;
+        return pdTRUE;
+    }
+    if (!wait_ticks(lock, semaphore, ticks_to_wait)) {
+        return pdFALSE;
+    }
+    semaphore->count--;
+    semaphore->owner = std::this_thread::get_id();
+    semaphore->recursion = 1;
+
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    {
+        std::lock_guard<std::mutex> lock(semaphore->mutex);
+        if (semaphore->count >= semaphore->max_count) {
+            return pdFALSE;
+        }
+        semaphore->count++;
+    }
+    semaphore->cond.notify_one();
+
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t semaphore)
+{
+    {
+        std::lock_guard<std::mutex> lock(semaphore->mutex);
+        if ((semaphore->recursion == 0) || (semaphore->owner != std::this_thread::get_id())) {
+            return pdFALSE;
+        }
+        if (--semaphore->recursion > 0) {
+            return pdTRUE;
+        }
+        semaphore->count++;
+    }
+    semaphore->cond.notify_one();
+
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t semaphore, BaseType_t *higher_priority_task_woken)
+{
+    if (higher_priority_task_woken != nullptr) {
+        *higher_priority_task_woken = pdFALSE;
+    }
+    return xSemaphoreGive(semaphore);
+}
+
+UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t semaphore)
+{
+    std::lock_guard<std::mutex> lock(semaphore->mutex);
+    return semaphore->count;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore)
+{
+    if (semaphore == nullptr) {
+        return;
+    }
+    if (semaphore->is_static) {
+        semaphore->~QueueDefinition();
+    } else {
+        delete semaphore;
+    }
+}
+
+void vTaskDelay(TickType_t ticks_to_delay)
+{
+    std::this_thread::sleep_for(ticks_to_duration(ticks_to_delay));
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start_time);
+    return static_cast<TickType_t>(elapsed.count() * CONFIG_FREERTOS_HZ / 1000);
+}
+
+BaseType_t xTaskCreate(
+    TaskFunction_t task_code, const char *, uint32_t, void *parameters, UBaseType_t, TaskHandle_t *created_task
+)
+{
+    std::thread(task_code, parameters).detach();
+    if (created_task != nullptr) {
+        // Not a real handle, only `vTaskDelete(NULL)` is supported
+        *created_task = reinterpret_cast<TaskHandle_t>(1);
+    }
+
+    return pdPASS;
+}
+
+BaseType_t xTaskCreatePinnedToCore(
+    TaskFunction_t task_code, const char *name, uint32_t stack_depth, void *parameters, UBaseType_t priority,
+    TaskHandle_t *created_task, BaseType_t
+)
+{
+    return xTaskCreate(task_code, name, stack_depth, parameters, priority, created_task);
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    // A task deleting itself returns from its function right after this call, the thread ends by itself
+    (void)task;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return reinterpret_cast<TaskHandle_t>(1);
+}
+
+} // extern "C"
@@ -0,0 +1,395 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "host_heap.hpp"
+#include "host_test.hpp"
+#include "drivers/bus/esp_panel_bus_spi.hpp"
+#include "drivers/touch/esp_panel_touch.hpp"
+
+using namespace esp_panel::drivers;
+
+#define TEST_TOUCH_WIDTH            (240)
+#define TEST_TOUCH_HEIGHT           (320)
+#define TEST_TOUCH_POINTS_NUM       (3)
+#define TEST_TOUCH_BUTTONS_NUM      (2)
+#define TEST_TOUCH_READ_NUM         (1000)
+
+/**
+ * A touch controller in memory, each read moves the points by one pixel. All is released if `is_released` is set
+ */
+class TestTouch : public Touch {
+public:
+    TestTouch(Bus *bus, int int_io = -1):
+        Touch(
+            BasicAttributes{"TEST", TEST_TOUCH_POINTS_NUM, TEST_TOUCH_BUTTONS_NUM}, bus, TEST_TOUCH_WIDTH,
+            TEST_TOUCH_HEIGHT, -1, int_io
+        )
+    {
+    }
+
+    ~TestTouch() override
+    {
+        del();
+    }
+
+    bool begin() override
+    {
+        if (!isOverState(State::INIT) && !init()) {
+            return false;
+        }
+        _panel = {};
+        _panel.read_data = onReadData;
+        _panel.get_xy = onGetXY;
+        _panel.get_button_state = onGetButtonState;
+        _panel.config = *getConfig().getDeviceFullConfig();
+        _panel.config.driver_data = this;
+        touch_panel = &_panel;
+        setState(State::BEGIN);
+
+        return true;
+    }
+
+    // Raise the interrupt, like the ISR of the interrupt pin
+    void interrupt()
+    {
+        _panel.config.interrupt_callback(&_panel);
+    }
+
+    std::atomic<int> read_count = 0;
+    std::atomic<bool> is_released = false;
+
+private:
+    static TestTouch *getTouch(esp_lcd_touch_handle_t tp)
+    {
+        return static_cast<TestTouch *>(tp->config.driver_data);
+    }
+
+    static esp_err_t onReadData(esp_lcd_touch_handle_t tp)
+    {
+        getTouch(tp)->read_count++;
+        return ESP_OK;
+    }
+
+    static bool onGetXY(
+        esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num,
+        uint8_t max_point_num
+    )
+    {
+        int count = getTouch(tp)->read_count;
+        *point_num = (max_point_num < TEST_TOUCH_POINTS_NUM) ? max_point_num : TEST_TOUCH_POINTS_NUM;
+        *point_num = getTouch(tp)->is_released ? 0 : *point_num;
+        for (int i = 0; i < *point_num; i++) {
+            x[i] = (count + i * 10) % TEST_TOUCH_WIDTH;
+            y[i] = (count * 2 + i * 10) % TEST_TOUCH_HEIGHT;
+            strength[i] = 100 + i;
+        }
+        return true;
+    }
+
+    static esp_err_t onGetButtonState(esp_lcd_touch_handle_t tp, uint8_t n, uint8_t *state)
+    {
+        if (n >= TEST_TOUCH_BUTTONS_NUM) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        *state = getTouch(tp)->is_released ? 0 : ((getTouch(tp)->read_count + n) & 1);
+        return ESP_OK;
+    }
+
+    esp_lcd_touch_t _panel = {};
+};
+
+struct TestDevice {
+    std::shared_ptr<BusSPI> bus;
+    std::shared_ptr<TestTouch> touch;
+    bool is_ready = false;
+};
+
+static void create_device(
+    TestDevice &device, size_t frame_ring_size = 0, const TouchFilter::Config &filter_config = {}
+)
+{
+    device.bus = std::make_shared<BusSPI>(10, 11, 12, 13);
+    device.touch = std::make_shared<TestTouch>(device.bus.get());
+    if (frame_ring_size > 0) {
+        TEST_ASSERT_TRUE(device.touch->configFrameRingSize(frame_ring_size));
+    }
+    TEST_ASSERT_TRUE(device.touch->configFilter(filter_config));
+    TEST_ASSERT_TRUE(device.touch->init());
+    TEST_ASSERT_TRUE(device.touch->begin());
+    device.is_ready = true;
+}
+
+TEST_CASE("Test touch read points and buttons", "[touch][driver]")
+{
+    TestDevice device;
+    create_device(device);
+    TEST_ASSERT_TRUE(device.is_ready);
+    auto touch = device.touch;
+
+    TEST_ASSERT_TRUE(touch->readRawData(-1, -1, 0));
+    TouchPoint points[TEST_TOUCH_POINTS_NUM + 1];
+    TEST_ASSERT_EQUAL(TEST_TOUCH_POINTS_NUM, touch->getPoints(points, TEST_TOUCH_POINTS_NUM + 1));
+    TEST_ASSERT_EQUAL(1, points[0].x);
+    TEST_ASSERT_EQUAL(2, points[0].y);
+    TEST_ASSERT_EQUAL(102, points[2].strength);
+    TEST_ASSERT_EQUAL(1, touch->getPoints(points, 1));
+
+    std::vector<TouchPoint> point_vector;
+    TEST_ASSERT_TRUE(touch->getPoints(point_vector));
+    TEST_ASSERT_EQUAL(static_cast<size_t>(TEST_TOUCH_POINTS_NUM), point_vector.size());
+    TEST_ASSERT_EQUAL(21, point_vector[2].x);
+
+    TouchButton buttons[TEST_TOUCH_BUTTONS_NUM];
+    TEST_ASSERT_EQUAL(TEST_TOUCH_BUTTONS_NUM, touch->getButtons(buttons, TEST_TOUCH_BUTTONS_NUM));
+    TEST_ASSERT_EQUAL(1, buttons[0].second);
+    TEST_ASSERT_EQUAL(0, buttons[1].second);
+    TEST_ASSERT_EQUAL(0, touch->getButtonState(1));
+
+    // Only one point is read from the controller
+    TEST_ASSERT_EQUAL(1, touch->readPoints(points, 1, 0));
+    TEST_ASSERT_EQUAL(2, points[0].x);
+    TEST_ASSERT_TRUE(touch->getPoints(point_vector));
+    TEST_ASSERT_EQUAL(static_cast<size_t>(1), point_vector.size());
+
+    touch->resetPoints();
+    TEST_ASSERT_EQUAL(0, touch->getPoints(points, TEST_TOUCH_POINTS_NUM));
+}
+
+TEST_CASE("Test touch read tracked contacts", "[touch][driver]")
+{
+    TestDevice device;
+    create_device(device);
+    TEST_ASSERT_TRUE(device.is_ready);
+    auto touch = device.touch;
+
+    TouchPoint points[TEST_TOUCH_POINTS_NUM];
+    TouchContact contacts[TEST_TOUCH_POINTS_NUM];
+    TEST_ASSERT_EQUAL(TEST_TOUCH_POINTS_NUM, touch->readPoints(points, TEST_TOUCH_POINTS_NUM, 0));
+    TEST_ASSERT_EQUAL(TEST_TOUCH_POINTS_NUM, touch->getContacts(contacts, TEST_TOUCH_POINTS_NUM));
+    for (int i = 0; i < TEST_TOUCH_POINTS_NUM; i++) {
+        TEST_ASSERT_EQUAL(i, points[i].id);
+        TEST_ASSERT_TRUE(contacts[i].phase == TouchContact::Phase::DOWN);
+    }
+
+    TEST_ASSERT_EQUAL(TEST_TOUCH_POINTS_NUM, touch->readPoints(points, TEST_TOUCH_POINTS_NUM, 0));
+    TEST_ASSERT_EQUAL(2, points[2].id);
+    TEST_ASSERT_EQUAL(TEST_TOUCH_POINTS_NUM, touch->getContacts(contacts, TEST_TOUCH_POINTS_NUM));
+    TEST_ASSERT_TRUE(contacts[2].phase == TouchContact::Phase::MOVE);
+
+    // Only the first point is read, the others are released
+    TEST_ASSERT_EQUAL(1, touch->readPoints(points, 1, 0));
+    TEST_ASSERT_EQUAL(TEST_TOUCH_POINTS_NUM, touch->getContacts(contacts, TEST_TOUCH_POINTS_NUM));
+    TEST_ASSERT_TRUE(contacts[0].phase == TouchContact::Phase::MOVE);
+    TEST_ASSERT_TRUE(contacts[1].phase == TouchContact::Phase::UP);
+
+    TEST_ASSERT_FALSE(touch->configTracker({.distance_max = 10}));
+}
+
+TEST_CASE("Test touch read predicted points", "[touch][driver]")
+{
+    // The reads are microseconds apart, so the points are predicted far ahead and clamped to the panel
+    TestDevice device;
+    device.bus = std::make_shared<BusSPI>(10, 11, 12, 13);
+    device.touch = std::make_shared<TestTouch>(device.bus.get());
+    auto touch = device.touch;
+    TEST_ASSERT_FALSE(touch->configPredictor({.horizon_ms = TouchPredictor::HORIZON_MAX_MS + 1}));
+    TEST_ASSERT_TRUE(touch->configPredictor({.horizon_ms = TouchPredictor::HORIZON_MAX_MS}));
+    TEST_ASSERT_TRUE(touch->init());
+    TEST_ASSERT_TRUE(touch->begin());
+    TEST_ASSERT_EQUAL(TouchPredictor::HORIZON_MAX_MS, touch->getPredictorConfig().horizon_ms);
+
+    TouchPoint points[TEST_TOUCH_POINTS_NUM];
+    TEST_ASSERT_EQUAL(TEST_TOUCH_POINTS_NUM, touch->readPoints(points, TEST_TOUCH_POINTS_NUM, 0));
+    TEST_ASSERT_EQUAL(1, points[0].x);
+    for (int i = 2; i <= 10; i++) {
+        TEST_ASSERT_EQUAL(TEST_TOUCH_POINTS_NUM, touch->readPoints(points, TEST_TOUCH_POINTS_NUM, 0));
+        for (int j = 0; j < TEST_TOUCH_POINTS_NUM; j++) {
+            // Ahead of the read point, within the panel
+            TEST_ASSERT_TRUE((points[j].x >= i + j * 10) && (points[j].x <= TEST_TOUCH_WIDTH));
+            TEST_ASSERT_TRUE((points[j].y >= i * 2 + j * 10) && (points[j].y <= TEST_TOUCH_HEIGHT));
+        }
+    }
+    TEST_ASSERT_TRUE(touch->swapXY(true));
+    TEST_ASSERT_EQUAL(TEST_TOUCH_POINTS_NUM, touch->readPoints(points, TEST_TOUCH_POINTS_NUM, 0));
+    TEST_ASSERT_TRUE(points[0].x <= TEST_TOUCH_HEIGHT);
+    TEST_ASSERT_TRUE(points[0].y <= TEST_TOUCH_WIDTH);
+}
+
+TEST_CASE("Test touch read path without heap activity", "[touch][driver]")
+{
+    TestDevice device;
+    create_device(device, 8);
+    TEST_ASSERT_TRUE(device.is_ready);
+    auto touch = device.touch;
+
+    TouchPoint points[TEST_TOUCH_POINTS_NUM];
+    TouchButton buttons[TEST_TOUCH_BUTTONS_NUM];
+    std::vector<TouchPoint> point_vector;
+    std::vector<TouchButton> button_vector;
+    TouchFrame frame;
+    uint32_t cursor = 0;
+    auto frame_ring = touch->getFrameRing();
+    TEST_ASSERT_TRUE(frame_ring != nullptr);
+
+    // The vectors of the caller only allocate when growing, on the first read
+    TEST_ASSERT_TRUE(touch->readRawData(-1, -1, 0));
+    TEST_ASSERT_TRUE(touch->getPoints(point_vector));
+    TEST_ASSERT_TRUE(touch->getButtons(button_vector));
+
+    auto heap_start = host_test::getHeapActivity();
+    int points_sum = 0;
+    for (int i = 0; i < TEST_TOUCH_READ_NUM; i++) {
+        points_sum += touch->readPoints(points, TEST_TOUCH_POINTS_NUM, 0);
+        points_sum += touch->readButtons(buttons, TEST_TOUCH_BUTTONS_NUM, 0);
+        touch->readRawData(-1, -1, 0);
+        touch->getPoints(point_vector);
+        touch->getButtons(button_vector);
+        touch->getButtonState(0);
+        while (frame_ring->read(cursor, frame)) {
+        }
+    }
+    auto heap_end = host_test::getHeapActivity();
+
+    printf(
+        "Heap activity of %d reads: %llu allocations, %llu frees\n", TEST_TOUCH_READ_NUM,
+        static_cast<unsigned long long>(heap_end.alloc_count - heap_start.alloc_count),
+        static_cast<unsigned long long>(heap_end.free_count - heap_start.free_count)
+    );
+    TEST_ASSERT_EQUAL(heap_start.getTotal(), heap_end.getTotal());
+    TEST_ASSERT_EQUAL(TEST_TOUCH_READ_NUM * (TEST_TOUCH_POINTS_NUM + TEST_TOUCH_BUTTONS_NUM), points_sum);
+    TEST_ASSERT_EQUAL(static_cast<uint32_t>(TEST_TOUCH_READ_NUM * 3 + 1), cursor);
+    TEST_ASSERT_EQUAL(TEST_TOUCH_POINTS_NUM, frame.points_num);
+    TEST_ASSERT_EQUAL(TEST_TOUCH_BUTTONS_NUM, frame.buttons_num);
+    TEST_ASSERT_EQUAL(static_cast<int>(point_vector[0].x), frame.points[0].x);
+}
+
+TEST_CASE("Test touch read filtered points", "[touch][driver]")
+{
+    // The points move by less than the dead-zone, so they are held at their first position
+    TestDevice device;
+    create_device(device, 4, {.dead_zone = 100});
+    TEST_ASSERT_TRUE(device.is_ready);
+    auto touch = device.touch;
+    TEST_ASSERT_EQUAL(100, touch->getFilterConfig().dead_zone);
+    TEST_ASSERT_FALSE(touch->configFilter({}));
+
+    TouchPoint points[TEST_TOUCH_POINTS_NUM];
+    for (int i = 1; i <= 10; i++) {
+        TEST_ASSERT_EQUAL(TEST_TOUCH_POINTS_NUM, touch->readPoints(points, TEST_TOUCH_POINTS_NUM, 0));
+        TEST_ASSERT_EQUAL(1, points[0].x);
+        TEST_ASSERT_EQUAL(2, points[0].y);
+        TEST_ASSERT_EQUAL(21, points[2].x);
+    }
+
+    // The frame ring buffer keeps the filtered points
+    TouchFrame frame;
+    TEST_ASSERT_TRUE(touch->getFrameRing()->readLatest(frame));
+    TEST_ASSERT_EQUAL(1, frame.points[0].x);
+
+    // The filter starts over after `del()`
+    TEST_ASSERT_TRUE(touch->del());
+    TEST_ASSERT_TRUE(touch->init());
+    TEST_ASSERT_TRUE(touch->begin());
+    TEST_ASSERT_EQUAL(TEST_TOUCH_POINTS_NUM, touch->readPoints(points, TEST_TOUCH_POINTS_NUM, 0));
+    TEST_ASSERT_EQUAL(11, points[0].x);
+}
+
+TEST_CASE("Test touch sampling task", "[touch][driver]")
+{
+    TestDevice device;
+    create_device(device);
+    TEST_ASSERT_TRUE(device.is_ready);
+    auto touch = device.touch;
+
+    TEST_ASSERT_FALSE(touch->startSampling({.burst_period_ms = 0}));
+    TEST_ASSERT_FALSE(touch->isSampling());
+    TEST_ASSERT_TRUE(touch->startSampling({.burst_period_ms = 5, .idle_period_ms = 40}));
+    TEST_ASSERT_TRUE(touch->isSampling());
+    TEST_ASSERT_FALSE(touch->startSampling());
+
+    // Pressed, read at the burst rate. The bounds are loose for the host scheduler
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    TouchSampler::Stats stats = touch->getSamplingStats();
+    printf(
+        "Burst: %d reads/s, %d reads/s while pressed, bus load %d/1000\n", stats.getSampleRateHz(),
+        stats.getBurstSampleRateHz(), stats.getBusLoadPermille()
+    );
+    TEST_ASSERT_TRUE(stats.mode == TouchSampler::Mode::BURST);
+    TEST_ASSERT_TRUE(stats.read_count > 10);
+    TEST_ASSERT_TRUE((stats.getBurstSampleRateHz() > 50) && (stats.getBurstSampleRateHz() <= 200));
+    TEST_ASSERT_TRUE(stats.bus_time_us >= 0);
+    TouchPoint points[TEST_TOUCH_POINTS_NUM];
+    TEST_ASSERT_EQUAL(TEST_TOUCH_POINTS_NUM, touch->getPoints(points, TEST_TOUCH_POINTS_NUM));
+
+    // Released, backs off to the idle rate
+    touch->is_released = true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    int read_count = touch->read_count;
+    std::this_thread::sleep_for(std::chrono::milliseconds(400));
+    stats = touch->getSamplingStats();
+    TEST_ASSERT_TRUE(stats.mode == TouchSampler::Mode::BACKOFF);
+    TEST_ASSERT_EQUAL(40, stats.period_ms);
+    TEST_ASSERT_TRUE(touch->read_count - read_count <= 11);
+    TEST_ASSERT_EQUAL(0, touch->getPoints(points, TEST_TOUCH_POINTS_NUM));
+
+    // No read after the stop
+    TEST_ASSERT_TRUE(touch->stopSampling());
+    TEST_ASSERT_FALSE(touch->isSampling());
+    TEST_ASSERT_EQUAL(static_cast<uint32_t>(0), touch->getSamplingStats().read_count);
+    read_count = touch->read_count;
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    TEST_ASSERT_EQUAL(read_count, touch->read_count.load());
+    TEST_ASSERT_TRUE(touch->stopSampling());
+}
+
+TEST_CASE("Test touch sampling task with interrupt", "[touch][driver]")
+{
+    TestDevice device;
+    device.bus = std::make_shared<BusSPI>(10, 11, 12, 13);
+    device.touch = std::make_shared<TestTouch>(device.bus.get(), 5);
+    auto touch = device.touch;
+    TEST_ASSERT_FALSE(touch->startSampling());
+    TEST_ASSERT_TRUE(touch->init());
+    TEST_ASSERT_TRUE(touch->begin());
+
+    touch->is_released = true;
+    TEST_ASSERT_TRUE(touch->startSampling({.burst_period_ms = 5, .idle_period_ms = 2000}));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    TEST_ASSERT_TRUE(touch->getSamplingStats().mode == TouchSampler::Mode::INTERRUPT);
+
+    // No read until the interrupt
+    int read_count = touch->read_count;
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    TEST_ASSERT_EQUAL(read_count, touch->read_count.load());
+
+    // The task owns the controller, the reads of the caller return at once with its latest data
+    TouchPoint points[TEST_TOUCH_POINTS_NUM];
+    TEST_ASSERT_EQUAL(0, touch->readPoints(points, TEST_TOUCH_POINTS_NUM, -1));
+    TEST_ASSERT_EQUAL(read_count, touch->read_count.load());
+
+    touch->is_released = false;
+    touch->interrupt();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    TouchSampler::Stats stats = touch->getSamplingStats();
+    TEST_ASSERT_TRUE(stats.mode == TouchSampler::Mode::BURST);
+    TEST_ASSERT_EQUAL(static_cast<uint32_t>(1), stats.interrupt_count);
+    TEST_ASSERT_TRUE(touch->read_count - read_count > 5);
+
+    // Released, back to waiting for the interrupt
+    touch->is_released = true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    TEST_ASSERT_TRUE(touch->getSamplingStats().mode == TouchSampler::Mode::INTERRUPT);
+
+    // `del()` stops the task
+    TEST_ASSERT_TRUE(touch->del());
+    TEST_ASSERT_FALSE(touch->isSampling());
+}
+
+HOST_TEST_MAIN()
@@ -0,0 +1,238 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+#include "host_heap.hpp"
+#include "host_test.hpp"
+#include "drivers/touch/esp_panel_touch_filter.hpp"
+#include "touch_traces.hpp"
+
+using namespace esp_panel::drivers;
+
+#define TRACE_NUM(trace)    (sizeof(trace) / sizeof(trace[0]))
+
+struct TraceResult {
+    std::vector<TouchPoint> points;
+    int hold_error_max = 0;     // Largest distance (in x or y) from the held point
+    int moves = 0;              // Number of the outputs different from the previous one, each one is a redraw
+};
+
+static TraceResult run_trace(TouchFilter &filter, const TraceSample trace[], size_t num, int hold_x, int hold_y)
+{
+    TraceResult result;
+    for (size_t i = 0; i < num; i++) {
+        TouchPoint point(trace[i].x, trace[i].y, 0);
+        filter.process(&point, 1, trace[i].time_us);
+        if (!result.points.empty() && (result.points.back() != point)) {
+            result.moves++;
+        }
+        result.points.push_back(point);
+        int error = std::max(std::abs(point.x - hold_x), std::abs(point.y - hold_y));
+        result.hold_error_max = std::max(result.hold_error_max, error);
+    }
+    return result;
+}
+
+static TraceResult run_hold(const TouchFilter::Config &config)
+{
+    TouchFilter filter;
+    filter.configure(config);
+    return run_trace(filter, TRACE_HOLD, TRACE_NUM(TRACE_HOLD), TRACE_HOLD_X, TRACE_HOLD_Y);
+}
+
+static TraceResult run_drag(const TouchFilter::Config &config)
+{
+    TouchFilter filter;
+    filter.configure(config);
+    return run_trace(filter, TRACE_DRAG, TRACE_NUM(TRACE_DRAG), TRACE_DRAG_X_END, TRACE_DRAG_Y);
+}
+
+TEST_CASE("Test touch filter configuration", "[touch][filter]")
+{
+    TouchFilter filter;
+    TEST_ASSERT_FALSE(filter.isEnabled());
+    TEST_ASSERT_TRUE(filter.getConfig().isValid());
+
+    TEST_ASSERT_FALSE(filter.configure({.median_size = 4}));
+    TEST_ASSERT_FALSE(filter.configure({.median_size = TouchFilter::MEDIAN_SIZE_MAX + 2}));
+    TEST_ASSERT_FALSE(filter.configure({.iir_weight_percent = 0}));
+    TEST_ASSERT_FALSE(filter.configure({.iir_weight_percent = 101}));
+    TEST_ASSERT_FALSE(filter.configure({.one_euro_min_cutoff_mhz = 1000, .one_euro_d_cutoff_mhz = 0}));
+    TEST_ASSERT_FALSE(filter.configure({.dead_zone = -1}));
+    TEST_ASSERT_FALSE(filter.isEnabled());
+
+    TEST_ASSERT_TRUE(filter.configure({.median_size = 1}));
+    TEST_ASSERT_FALSE(filter.isEnabled());
+    TEST_ASSERT_TRUE(filter.configure({.median_size = 3, .dead_zone = 2}));
+    TEST_ASSERT_TRUE(filter.isEnabled());
+    TEST_ASSERT_EQUAL(3, filter.getConfig().median_size);
+}
+
+TEST_CASE("Test touch filter disabled stages pass the points through", "[touch][filter]")
+{
+    auto result = run_hold({});
+    for (size_t i = 0; i < TRACE_NUM(TRACE_HOLD); i++) {
+        TEST_ASSERT_EQUAL(TRACE_HOLD[i].x, result.points[i].x);
+        TEST_ASSERT_EQUAL(TRACE_HOLD[i].y, result.points[i].y);
+    }
+    // The spikes of the trace
+    TEST_ASSERT_TRUE(result.hold_error_max >= 25);
+}
+
+TEST_CASE("Test touch filter median removes the spikes", "[touch][filter]")
+{
+    auto result = run_hold({.median_size = 5});
+    printf("Median: hold error %d, moves %d\n", result.hold_error_max, result.moves);
+    // Only the noise is left
+    TEST_ASSERT_TRUE(result.hold_error_max <= 2);
+
+    // Follows a drag with a delay of half the window
+    result = run_drag({.median_size = 5});
+    TEST_ASSERT_TRUE(std::abs(result.points.back().x - TRACE_DRAG_X_END) <= 10);
+    for (auto &point : result.points) {
+        TEST_ASSERT_TRUE(std::abs(point.y - TRACE_DRAG_Y) <= 2);
+    }
+}
+
+TEST_CASE("Test touch filter IIR smoothing", "[touch][filter]")
+{
+    TouchFilter filter;
+    TEST_ASSERT_TRUE(filter.configure({.iir_weight_percent = 25}));
+
+    // Step response
+    TouchPoint point(0, 0, 7);
+    filter.process(&point, 1, 0);
+    TEST_ASSERT_EQUAL(0, point.x);
+    const int expected[] = {25, 44, 58, 68, 76};
+    for (int i = 0; i < 5; i++) {
+        point = TouchPoint(100, 0, 7);
+        filter.process(&point, 1, (i + 1) * 10000);
+        TEST_ASSERT_EQUAL(expected[i], point.x);
+        TEST_ASSERT_EQUAL(0, point.y);
+        TEST_ASSERT_EQUAL(7, point.strength);
+    }
+}
+
+TEST_CASE("Test touch filter One-Euro is steady at rest and follows a drag", "[touch][filter]")
+{
+    // Without the speed term, it is an exponential smoothing at 1 Hz: steady but slow
+    TouchFilter::Config steady = {.median_size = 5, .one_euro_min_cutoff_mhz = 1000};
+    TouchFilter::Config adaptive = steady;
+    adaptive.one_euro_beta_micro = 40000;
+
+    auto hold_steady = run_hold(steady);
+    auto hold_adaptive = run_hold(adaptive);
+    auto drag_steady = run_drag(steady);
+    auto drag_adaptive = run_drag(adaptive);
+    int lag_steady = TRACE_DRAG_X_END - drag_steady.points.back().x;
+    int lag_adaptive = TRACE_DRAG_X_END - drag_adaptive.points.back().x;
+    printf(
+        "One-Euro: hold error %d/%d, drag lag %d/%d pixels (fixed/adaptive cutoff)\n", hold_steady.hold_error_max,
+        hold_adaptive.hold_error_max, lag_steady, lag_adaptive
+    );
+
+    TEST_ASSERT_TRUE(hold_steady.hold_error_max <= 1);
+    TEST_ASSERT_TRUE(hold_adaptive.hold_error_max <= 1);
+    // The lag of an exponential smoothing is the speed times its time constant, about 54 pixels here
+    TEST_ASSERT_TRUE(lag_steady > 40);
+    TEST_ASSERT_TRUE(lag_adaptive < 20);
+    TEST_ASSERT_TRUE(lag_adaptive >= 0);
+}
+
+TEST_CASE("Test touch filter dead-zone stops the redraws at rest", "[touch][filter]")
+{
+    auto raw = run_hold({.median_size = 5});
+    auto result = run_hold({.median_size = 5, .dead_zone = 4});
+    printf("Dead-zone: moves %d -> %d\n", raw.moves, result.moves);
+    TEST_ASSERT_TRUE(raw.moves > 30);
+    TEST_ASSERT_EQUAL(0, result.moves);
+
+    // Dragged along at the edge of the dead-zone
+    result = run_drag({.dead_zone = 3});
+    for (size_t i = 1; i < TRACE_NUM(TRACE_DRAG); i++) {
+        auto &point = result.points[i];
+        TEST_ASSERT_TRUE(std::abs(point.x - TRACE_DRAG[i].x) <= 3);
+        TEST_ASSERT_TRUE(std::abs(point.y - TRACE_DRAG[i].y) <= 3);
+    }
+}
+
+TEST_CASE("Test touch filter recommended chain for the resistive panels", "[touch][filter]")
+{
+    // Same as `TouchXPT2046::FILTER_CONFIG_RECOMMENDED`
+    TouchFilter::Config config = {
+        .median_size = 5,
+        .one_euro_min_cutoff_mhz = 1000,
+        .one_euro_beta_micro = 40000,
+        .dead_zone = 1,
+    };
+    auto hold = run_hold(config);
+    auto drag = run_drag(config);
+    printf(
+        "Chain: hold error %d, moves %d, drag lag %d pixels\n", hold.hold_error_max, hold.moves,
+        TRACE_DRAG_X_END - drag.points.back().x
+    );
+    TEST_ASSERT_TRUE(hold.hold_error_max <= 1);
+    TEST_ASSERT_TRUE(hold.moves <= 2);
+    TEST_ASSERT_TRUE(TRACE_DRAG_X_END - drag.points.back().x < 20);
+    for (auto &point : drag.points) {
+        TEST_ASSERT_TRUE(std::abs(point.y - TRACE_DRAG_Y) <= 2);
+    }
+}
+
+TEST_CASE("Test touch filter keeps the state per contact", "[touch][filter]")
+{
+    TouchFilter filter;
+    TEST_ASSERT_TRUE(filter.configure({.iir_weight_percent = 50}));
+
+    TouchPoint points[2] = {TouchPoint(0, 0, 0), TouchPoint(200, 200, 0)};
+    filter.process(points, 2, 0);
+    points[0] = TouchPoint(100, 0, 0);
+    points[1] = TouchPoint(100, 200, 0);
+    filter.process(points, 2, 10000);
+    TEST_ASSERT_EQUAL(50, points[0].x);
+    TEST_ASSERT_EQUAL(150, points[1].x);
+
+    // The second contact is lifted, then starts over from its first sample
+    points[0] = TouchPoint(100, 0, 0);
+    filter.process(points, 1, 20000);
+    TEST_ASSERT_EQUAL(75, points[0].x);
+    points[0] = TouchPoint(100, 0, 0);
+    points[1] = TouchPoint(10, 10, 0);
+    filter.process(points, 2, 30000);
+    TEST_ASSERT_EQUAL(88, points[0].x);
+    TEST_ASSERT_EQUAL(10, points[1].x);
+
+    filter.reset();
+    points[0] = TouchPoint(0, 0, 0);
+    filter.process(points, 1, 40000);
+    TEST_ASSERT_EQUAL(0, points[0].x);
+}
+
+TEST_CASE("Test touch filter without heap activity", "[touch][filter]")
+{
+    TouchFilter filter;
+    TEST_ASSERT_TRUE(filter.configure({
+        .median_size = TouchFilter::MEDIAN_SIZE_MAX,
+        .iir_weight_percent = 50,
+        .one_euro_min_cutoff_mhz = 1000,
+        .one_euro_beta_micro = 40000,
+        .dead_zone = 2,
+    }));
+
+    TouchPoint points[TouchFilter::CONTACTS_MAX_NUM];
+    auto heap_start = host_test::getHeapActivity();
+    for (int i = 0; i < 1000; i++) {
+        for (int j = 0; j < TouchFilter::CONTACTS_MAX_NUM; j++) {
+            auto &sample = TRACE_DRAG[(i + j) % TRACE_NUM(TRACE_DRAG)];
+            points[j] = TouchPoint(sample.x, sample.y, 0);
+        }
+        filter.process(points, 1 + i % TouchFilter::CONTACTS_MAX_NUM, i * 10000);
+    }
+    TEST_ASSERT_EQUAL(heap_start.getTotal(), host_test::getHeapActivity().getTotal());
+}
+
+HOST_TEST_MAIN()
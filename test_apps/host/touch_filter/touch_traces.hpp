@@ -0,0 +1,55 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#pragma once
+
+#include <cstdint>
+
+/**
+ * Traces of a resistive panel read at 100 Hz, in the shape of the XPT2046 samples: +-2 pixels of noise on every
+ * sample, and spikes of 25 to 40 pixels from the conversions taken while the pressure changes
+ */
+struct TraceSample {
+    int64_t time_us;
+    int x;
+    int y;
+};
+
+/* A stylus held at (120, 160), with 6 spikes (2 of them in a row) */
+static const TraceSample TRACE_HOLD[] = {
+    {0, 120, 159}, {10000, 121, 158}, {20000, 118, 162}, {30000, 118, 160}, {40000, 122, 158}, {50000, 122, 159},
+    {60000, 118, 158}, {70000, 89, 123}, {80000, 118, 162}, {90000, 118, 159}, {100000, 122, 158},
+    {110000, 122, 162}, {120000, 121, 158}, {130000, 119, 158}, {140000, 122, 159}, {150000, 120, 161},
+    {160000, 119, 162}, {170000, 118, 162}, {180000, 120, 162}, {190000, 83, 131}, {200000, 82, 193},
+    {210000, 121, 162}, {220000, 121, 160}, {230000, 120, 159}, {240000, 119, 159}, {250000, 118, 162},
+    {260000, 120, 162}, {270000, 121, 160}, {280000, 121, 160}, {290000, 122, 158}, {300000, 118, 162},
+    {310000, 121, 159}, {320000, 120, 159}, {330000, 94, 196}, {340000, 120, 162}, {350000, 121, 162},
+    {360000, 121, 158}, {370000, 118, 160}, {380000, 121, 158}, {390000, 118, 160}, {400000, 122, 161},
+    {410000, 120, 161}, {420000, 120, 158}, {430000, 121, 160}, {440000, 119, 162}, {450000, 118, 161},
+    {460000, 147, 122}, {470000, 121, 161}, {480000, 118, 159}, {490000, 121, 161}, {500000, 122, 160},
+    {510000, 119, 161}, {520000, 158, 192}, {530000, 119, 158}, {540000, 119, 159}, {550000, 119, 159},
+    {560000, 118, 161}, {570000, 122, 159}, {580000, 120, 160}, {590000, 118, 159},
+};
+#define TRACE_HOLD_X        (120)
+#define TRACE_HOLD_Y        (160)
+
+/* A stylus dragged from (20, 100) to (220, 100) in 590 ms (about 340 pixels/s), with 2 spikes */
+static const TraceSample TRACE_DRAG[] = {
+    {0, 21, 102}, {10000, 23, 102}, {20000, 29, 100}, {30000, 29, 102}, {40000, 36, 98}, {50000, 38, 102},
+    {60000, 41, 101}, {70000, 45, 101}, {80000, 45, 101}, {90000, 52, 98}, {100000, 53, 98}, {110000, 56, 101},
+    {120000, 60, 98}, {130000, 64, 102}, {140000, 65, 98}, {150000, 69, 137}, {160000, 73, 102}, {170000, 76, 100},
+    {180000, 83, 98}, {190000, 82, 99}, {200000, 90, 101}, {210000, 90, 100}, {220000, 95, 102}, {230000, 98, 101},
+    {240000, 99, 98}, {250000, 106, 101}, {260000, 109, 101}, {270000, 112, 98}, {280000, 114, 98},
+    {290000, 118, 100}, {300000, 123, 99}, {310000, 127, 98}, {320000, 127, 102}, {330000, 132, 99},
+    {340000, 137, 98}, {350000, 141, 100}, {360000, 140, 100}, {370000, 147, 100}, {380000, 148, 100},
+    {390000, 151, 102}, {400000, 158, 102}, {410000, 159, 134}, {420000, 164, 99}, {430000, 165, 101},
+    {440000, 168, 99}, {450000, 175, 101}, {460000, 176, 98}, {470000, 177, 100}, {480000, 184, 100},
+    {490000, 185, 102}, {500000, 189, 101}, {510000, 193, 100}, {520000, 194, 99}, {530000, 198, 99},
+    {540000, 204, 99}, {550000, 206, 99}, {560000, 211, 102}, {570000, 215, 98}, {580000, 218, 100},
+    {590000, 218, 98},
+};
+#define TRACE_DRAG_X_START  (20)
+#define TRACE_DRAG_X_END    (220)
+#define TRACE_DRAG_Y        (100)
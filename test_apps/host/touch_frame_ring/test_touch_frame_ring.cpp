@@ -0,0 +1,188 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "host_test.hpp"
+#include "drivers/touch/esp_panel_touch_frame_ring.hpp"
+
+using namespace esp_panel::drivers;
+
+// The content of a frame is derived from its index, so that a torn copy is detected
+static void make_frame(uint32_t index, TouchFrame &frame)
+{
+    frame = TouchFrame();
+    frame.timestamp_us = static_cast<int64_t>(index) * 1000;
+    frame.points_num = 1 + index % TouchFrame::POINTS_MAX_NUM;
+    for (int i = 0; i < frame.points_num; i++) {
+        frame.points[i] = TouchPoint(static_cast<int>(index), i, static_cast<int>(index ^ 0x5a5a));
+    }
+    frame.buttons_num = index % (TouchFrame::BUTTONS_MAX_NUM + 1);
+    for (int i = 0; i < frame.buttons_num; i++) {
+        frame.buttons[i] = TouchButton(i, static_cast<uint8_t>(index));
+    }
+}
+
+static bool check_frame(const TouchFrame &frame)
+{
+    uint32_t index = static_cast<uint32_t>(frame.timestamp_us / 1000);
+    TouchFrame expected;
+    make_frame(index, expected);
+    if ((frame.points_num != expected.points_num) || (frame.buttons_num != expected.buttons_num)) {
+        return false;
+    }
+    for (int i = 0; i < frame.points_num; i++) {
+        if ((frame.points[i].x != expected.points[i].x) || (frame.points[i].y != expected.points[i].y) ||
+                (frame.points[i].strength != expected.points[i].strength)) {
+            return false;
+        }
+    }
+    for (int i = 0; i < frame.buttons_num; i++) {
+        if (frame.buttons[i] != expected.buttons[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST_CASE("Test frame ring capacity", "[touch][frame_ring]")
+{
+    TEST_ASSERT_FALSE(TouchFrameRing(0).isValid());
+    TEST_ASSERT_EQUAL(static_cast<size_t>(0), TouchFrameRing(0).getCapacity());
+    TEST_ASSERT_EQUAL(static_cast<size_t>(2), TouchFrameRing(1).getCapacity());
+    TEST_ASSERT_EQUAL(static_cast<size_t>(8), TouchFrameRing(8).getCapacity());
+    TEST_ASSERT_EQUAL(static_cast<size_t>(16), TouchFrameRing(9).getCapacity());
+
+    TouchFrameRing invalid(0);
+    TouchFrame frame;
+    uint32_t cursor = 0;
+    TEST_ASSERT_EQUAL(0U, invalid.push(frame));
+    TEST_ASSERT_FALSE(invalid.read(cursor, frame));
+    TEST_ASSERT_FALSE(invalid.readLatest(frame));
+}
+
+TEST_CASE("Test frame ring read in order", "[touch][frame_ring]")
+{
+    TouchFrameRing ring(8);
+    TouchFrame frame;
+    uint32_t cursor = 0;
+    TEST_ASSERT_FALSE(ring.read(cursor, frame));
+    TEST_ASSERT_FALSE(ring.readLatest(frame));
+
+    for (uint32_t i = 1; i <= 5; i++) {
+        make_frame(i, frame);
+        TEST_ASSERT_EQUAL(i, ring.push(frame));
+        TEST_ASSERT_EQUAL(i, frame.sequence);
+    }
+    TEST_ASSERT_EQUAL(5U, ring.getLatestSequence());
+
+    // Two consumers with their own cursors
+    uint32_t cursor_a = 0;
+    uint32_t cursor_b = 3;
+    uint32_t lost = 1;
+    for (uint32_t i = 1; i <= 5; i++) {
+        TEST_ASSERT_TRUE(ring.read(cursor_a, frame, &lost));
+        TEST_ASSERT_EQUAL(i, frame.sequence);
+        TEST_ASSERT_EQUAL(i, cursor_a);
+        TEST_ASSERT_EQUAL(0U, lost);
+        TEST_ASSERT_TRUE(check_frame(frame));
+    }
+    TEST_ASSERT_FALSE(ring.read(cursor_a, frame));
+    TEST_ASSERT_TRUE(ring.read(cursor_b, frame));
+    TEST_ASSERT_EQUAL(4U, frame.sequence);
+
+    TEST_ASSERT_TRUE(ring.readLatest(frame));
+    TEST_ASSERT_EQUAL(5U, frame.sequence);
+    TEST_ASSERT_TRUE(check_frame(frame));
+}
+
+TEST_CASE("Test frame ring overrun", "[touch][frame_ring]")
+{
+    TouchFrameRing ring(4);
+    TouchFrame frame;
+    for (uint32_t i = 1; i <= 10; i++) {
+        make_frame(i, frame);
+        ring.push(frame);
+    }
+
+    // Frames 1 - 6 are overwritten
+    uint32_t cursor = 0;
+    uint32_t lost = 0;
+    TEST_ASSERT_TRUE(ring.read(cursor, frame, &lost));
+    TEST_ASSERT_EQUAL(7U, frame.sequence);
+    TEST_ASSERT_EQUAL(6U, lost);
+    TEST_ASSERT_TRUE(check_frame(frame));
+    TEST_ASSERT_TRUE(ring.read(cursor, frame, &lost));
+    TEST_ASSERT_EQUAL(8U, frame.sequence);
+    TEST_ASSERT_EQUAL(0U, lost);
+
+    // A cursor ahead of the latest frame reads nothing
+    cursor = 20;
+    TEST_ASSERT_FALSE(ring.read(cursor, frame));
+    TEST_ASSERT_EQUAL(20U, cursor);
+}
+
+TEST_CASE("Test frame ring with concurrent consumers", "[touch][frame_ring]")
+{
+    const uint32_t frame_num = 200000;
+    const int consumer_num = 3;
+    TouchFrameRing ring(16);
+    std::atomic<bool> is_done{false};
+    std::vector<uint32_t> read_nums(consumer_num);
+    std::vector<uint32_t> lost_nums(consumer_num);
+    std::vector<int> errors(consumer_num);
+
+    std::vector<std::thread> consumers;
+    for (int c = 0; c < consumer_num; c++) {
+        consumers.emplace_back([&, c]() {
+            uint32_t cursor = 0;
+            uint32_t last_sequence = 0;
+            TouchFrame frame;
+            while (true) {
+                bool is_last = is_done.load();
+                uint32_t lost = 0;
+                while (ring.read(cursor, frame, &lost)) {
+                    // In order, every frame either read or counted as lost, and never torn
+                    if ((frame.sequence != last_sequence + lost + 1) || !check_frame(frame) ||
+                            (frame.timestamp_us != static_cast<int64_t>(frame.sequence) * 1000)) {
+                        errors[c]++;
+                    }
+                    last_sequence = frame.sequence;
+                    read_nums[c]++;
+                    lost_nums[c] += lost;
+                }
+                lost_nums[c] += lost;
+                if (is_last) {
+                    break;
+                }
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    // Let the consumers run regularly, so that both the reads and the overruns are exercised
+    TouchFrame frame;
+    for (uint32_t i = 1; i <= frame_num; i++) {
+        make_frame(i, frame);
+        ring.push(frame);
+        if ((i % 32) == 0) {
+            std::this_thread::yield();
+        }
+    }
+    is_done = true;
+    for (auto &consumer : consumers) {
+        consumer.join();
+    }
+
+    for (int c = 0; c < consumer_num; c++) {
+        printf("Consumer %d: %u read, %u lost\n", c, read_nums[c], lost_nums[c]);
+        TEST_ASSERT_EQUAL(0, errors[c]);
+        TEST_ASSERT_EQUAL(frame_num, read_nums[c] + lost_nums[c]);
+        TEST_ASSERT_TRUE(read_nums[c] > 0);
+    }
+}
+
+HOST_TEST_MAIN()
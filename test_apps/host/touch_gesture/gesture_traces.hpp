@@ -0,0 +1,133 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#pragma once
+
+/**
+ * Traces of a capacitive panel read every 10 ms, with +-1 pixel of noise. A frame without point releases all the
+ * contacts
+ */
+struct TraceFrame {
+    int time_ms;
+    int points_num;
+    int x0;
+    int y0;
+    int x1;
+    int y1;
+};
+
+/* A tap at (100, 100), pressed for 60 ms */
+static const TraceFrame TRACE_TAP[] = {
+    {0, 1, 100, 101, 0, 0}, {10, 1, 100, 100, 0, 0}, {20, 1, 101, 101, 0, 0}, {30, 1, 99, 99, 0, 0},
+    {40, 1, 101, 100, 0, 0}, {50, 1, 101, 101, 0, 0}, {60, 0, 0, 0, 0, 0},
+};
+
+/* Two taps at (150, 200), 130 ms apart */
+static const TraceFrame TRACE_DOUBLE_TAP[] = {
+    {0, 1, 149, 199, 0, 0}, {10, 1, 150, 200, 0, 0}, {20, 1, 149, 199, 0, 0}, {30, 1, 151, 201, 0, 0},
+    {40, 1, 151, 199, 0, 0}, {50, 0, 0, 0, 0, 0}, {180, 1, 154, 198, 0, 0}, {190, 1, 153, 199, 0, 0},
+    {200, 1, 154, 199, 0, 0}, {210, 1, 154, 197, 0, 0}, {220, 1, 154, 197, 0, 0}, {230, 0, 0, 0, 0, 0},
+};
+
+/* A press held for 810 ms at (60, 300) */
+static const TraceFrame TRACE_LONG_PRESS[] = {
+    {0, 1, 61, 299, 0, 0}, {10, 1, 59, 299, 0, 0}, {20, 1, 59, 299, 0, 0}, {30, 1, 61, 299, 0, 0},
+    {40, 1, 60, 300, 0, 0}, {50, 1, 60, 301, 0, 0}, {60, 1, 59, 301, 0, 0}, {70, 1, 59, 301, 0, 0},
+    {80, 1, 60, 300, 0, 0}, {90, 1, 59, 301, 0, 0}, {100, 1, 59, 300, 0, 0}, {110, 1, 61, 300, 0, 0},
+    {120, 1, 60, 301, 0, 0}, {130, 1, 59, 301, 0, 0}, {140, 1, 60, 300, 0, 0}, {150, 1, 59, 301, 0, 0},
+    {160, 1, 60, 299, 0, 0}, {170, 1, 59, 301, 0, 0}, {180, 1, 59, 300, 0, 0}, {190, 1, 59, 300, 0, 0},
+    {200, 1, 60, 299, 0, 0}, {210, 1, 59, 301, 0, 0}, {220, 1, 59, 299, 0, 0}, {230, 1, 59, 299, 0, 0},
+    {240, 1, 60, 300, 0, 0}, {250, 1, 61, 300, 0, 0}, {260, 1, 60, 299, 0, 0}, {270, 1, 61, 301, 0, 0},
+    {280, 1, 59, 301, 0, 0}, {290, 1, 60, 300, 0, 0}, {300, 1, 59, 300, 0, 0}, {310, 1, 60, 299, 0, 0},
+    {320, 1, 60, 299, 0, 0}, {330, 1, 59, 299, 0, 0}, {340, 1, 61, 299, 0, 0}, {350, 1, 59, 299, 0, 0},
+    {360, 1, 60, 300, 0, 0}, {370, 1, 59, 301, 0, 0}, {380, 1, 61, 299, 0, 0}, {390, 1, 60, 301, 0, 0},
+    {400, 1, 59, 301, 0, 0}, {410, 1, 59, 300, 0, 0}, {420, 1, 61, 300, 0, 0}, {430, 1, 59, 300, 0, 0},
+    {440, 1, 60, 299, 0, 0}, {450, 1, 59, 300, 0, 0}, {460, 1, 61, 300, 0, 0}, {470, 1, 59, 299, 0, 0},
+    {480, 1, 59, 300, 0, 0}, {490, 1, 61, 301, 0, 0}, {500, 1, 61, 299, 0, 0}, {510, 1, 59, 299, 0, 0},
+    {520, 1, 59, 300, 0, 0}, {530, 1, 60, 299, 0, 0}, {540, 1, 61, 300, 0, 0}, {550, 1, 60, 300, 0, 0},
+    {560, 1, 59, 299, 0, 0}, {570, 1, 59, 299, 0, 0}, {580, 1, 61, 301, 0, 0}, {590, 1, 59, 299, 0, 0},
+    {600, 1, 61, 300, 0, 0}, {610, 1, 60, 301, 0, 0}, {620, 1, 60, 299, 0, 0}, {630, 1, 61, 300, 0, 0},
+    {640, 1, 61, 299, 0, 0}, {650, 1, 60, 299, 0, 0}, {660, 1, 61, 299, 0, 0}, {670, 1, 60, 299, 0, 0},
+    {680, 1, 61, 299, 0, 0}, {690, 1, 61, 299, 0, 0}, {700, 1, 59, 301, 0, 0}, {710, 1, 61, 301, 0, 0},
+    {720, 1, 59, 301, 0, 0}, {730, 1, 60, 300, 0, 0}, {740, 1, 61, 299, 0, 0}, {750, 1, 60, 299, 0, 0},
+    {760, 1, 59, 299, 0, 0}, {770, 1, 59, 301, 0, 0}, {780, 1, 60, 299, 0, 0}, {790, 1, 61, 301, 0, 0},
+    {800, 1, 60, 300, 0, 0}, {810, 0, 0, 0, 0, 0},
+};
+
+/* A swipe from (20, 150) to (220, 155) in 200 ms */
+static const TraceFrame TRACE_SWIPE_RIGHT[] = {
+    {0, 1, 20, 151, 0, 0}, {10, 1, 30, 150, 0, 0}, {20, 1, 41, 149, 0, 0}, {30, 1, 51, 149, 0, 0},
+    {40, 1, 59, 150, 0, 0}, {50, 1, 70, 152, 0, 0}, {60, 1, 81, 152, 0, 0}, {70, 1, 91, 150, 0, 0},
+    {80, 1, 100, 151, 0, 0}, {90, 1, 109, 153, 0, 0}, {100, 1, 119, 151, 0, 0}, {110, 1, 130, 152, 0, 0},
+    {120, 1, 140, 152, 0, 0}, {130, 1, 149, 152, 0, 0}, {140, 1, 159, 153, 0, 0}, {150, 1, 170, 154, 0, 0},
+    {160, 1, 181, 153, 0, 0}, {170, 1, 189, 154, 0, 0}, {180, 1, 199, 154, 0, 0}, {190, 1, 210, 155, 0, 0},
+    {200, 1, 221, 156, 0, 0}, {210, 0, 0, 0, 0, 0},
+};
+
+/* A swipe from (120, 280) to (120, 100) in 120 ms */
+static const TraceFrame TRACE_SWIPE_UP[] = {
+    {0, 1, 121, 281, 0, 0}, {10, 1, 119, 266, 0, 0}, {20, 1, 119, 249, 0, 0}, {30, 1, 120, 235, 0, 0},
+    {40, 1, 121, 220, 0, 0}, {50, 1, 119, 204, 0, 0}, {60, 1, 121, 191, 0, 0}, {70, 1, 119, 175, 0, 0},
+    {80, 1, 119, 161, 0, 0}, {90, 1, 120, 145, 0, 0}, {100, 1, 119, 129, 0, 0}, {110, 1, 119, 115, 0, 0},
+    {120, 1, 121, 100, 0, 0}, {130, 0, 0, 0, 0, 0},
+};
+
+/* A slow drag from (50, 50) to (150, 50) in 1 s, too slow for a swipe */
+static const TraceFrame TRACE_DRAG[] = {
+    {0, 1, 51, 49, 0, 0}, {10, 1, 52, 51, 0, 0}, {20, 1, 53, 49, 0, 0}, {30, 1, 53, 50, 0, 0},
+    {40, 1, 53, 51, 0, 0}, {50, 1, 55, 49, 0, 0}, {60, 1, 56, 49, 0, 0}, {70, 1, 57, 51, 0, 0},
+    {80, 1, 57, 51, 0, 0}, {90, 1, 60, 50, 0, 0}, {100, 1, 60, 51, 0, 0}, {110, 1, 60, 51, 0, 0},
+    {120, 1, 61, 49, 0, 0}, {130, 1, 62, 51, 0, 0}, {140, 1, 63, 50, 0, 0}, {150, 1, 65, 51, 0, 0},
+    {160, 1, 66, 50, 0, 0}, {170, 1, 68, 51, 0, 0}, {180, 1, 69, 50, 0, 0}, {190, 1, 69, 50, 0, 0},
+    {200, 1, 71, 49, 0, 0}, {210, 1, 72, 51, 0, 0}, {220, 1, 71, 50, 0, 0}, {230, 1, 74, 49, 0, 0},
+    {240, 1, 74, 49, 0, 0}, {250, 1, 74, 51, 0, 0}, {260, 1, 75, 50, 0, 0}, {270, 1, 78, 51, 0, 0},
+    {280, 1, 78, 50, 0, 0}, {290, 1, 78, 50, 0, 0}, {300, 1, 80, 49, 0, 0}, {310, 1, 82, 51, 0, 0},
+    {320, 1, 81, 51, 0, 0}, {330, 1, 82, 50, 0, 0}, {340, 1, 85, 50, 0, 0}, {350, 1, 85, 49, 0, 0},
+    {360, 1, 86, 50, 0, 0}, {370, 1, 88, 50, 0, 0}, {380, 1, 87, 51, 0, 0}, {390, 1, 89, 49, 0, 0},
+    {400, 1, 89, 50, 0, 0}, {410, 1, 90, 51, 0, 0}, {420, 1, 92, 49, 0, 0}, {430, 1, 92, 49, 0, 0},
+    {440, 1, 94, 50, 0, 0}, {450, 1, 94, 51, 0, 0}, {460, 1, 95, 50, 0, 0}, {470, 1, 96, 49, 0, 0},
+    {480, 1, 98, 50, 0, 0}, {490, 1, 99, 49, 0, 0}, {500, 1, 100, 50, 0, 0}, {510, 1, 102, 51, 0, 0},
+    {520, 1, 102, 51, 0, 0}, {530, 1, 103, 51, 0, 0}, {540, 1, 105, 50, 0, 0}, {550, 1, 105, 49, 0, 0},
+    {560, 1, 105, 50, 0, 0}, {570, 1, 108, 49, 0, 0}, {580, 1, 109, 51, 0, 0}, {590, 1, 109, 51, 0, 0},
+    {600, 1, 110, 50, 0, 0}, {610, 1, 112, 51, 0, 0}, {620, 1, 111, 51, 0, 0}, {630, 1, 112, 50, 0, 0},
+    {640, 1, 114, 49, 0, 0}, {650, 1, 114, 50, 0, 0}, {660, 1, 115, 49, 0, 0}, {670, 1, 116, 51, 0, 0},
+    {680, 1, 117, 50, 0, 0}, {690, 1, 118, 51, 0, 0}, {700, 1, 121, 51, 0, 0}, {710, 1, 122, 50, 0, 0},
+    {720, 1, 121, 51, 0, 0}, {730, 1, 122, 49, 0, 0}, {740, 1, 124, 50, 0, 0}, {750, 1, 124, 51, 0, 0},
+    {760, 1, 125, 50, 0, 0}, {770, 1, 128, 51, 0, 0}, {780, 1, 127, 49, 0, 0}, {790, 1, 128, 50, 0, 0},
+    {800, 1, 130, 51, 0, 0}, {810, 1, 132, 51, 0, 0}, {820, 1, 133, 51, 0, 0}, {830, 1, 132, 50, 0, 0},
+    {840, 1, 135, 49, 0, 0}, {850, 1, 134, 50, 0, 0}, {860, 1, 137, 50, 0, 0}, {870, 1, 136, 50, 0, 0},
+    {880, 1, 138, 49, 0, 0}, {890, 1, 140, 49, 0, 0}, {900, 1, 140, 51, 0, 0}, {910, 1, 142, 51, 0, 0},
+    {920, 1, 143, 50, 0, 0}, {930, 1, 143, 50, 0, 0}, {940, 1, 145, 49, 0, 0}, {950, 1, 144, 51, 0, 0},
+    {960, 1, 147, 51, 0, 0}, {970, 1, 146, 49, 0, 0}, {980, 1, 147, 50, 0, 0}, {990, 1, 148, 50, 0, 0},
+    {1000, 1, 151, 50, 0, 0}, {1010, 0, 0, 0, 0, 0},
+};
+
+/* Two contacts spread from 100 to 200 pixels apart around (120, 160), the second one pressed 10 ms after the first */
+static const TraceFrame TRACE_PINCH_OUT[] = {
+    {0, 1, 120, 160, 0, 0}, {10, 2, 70, 161, 169, 160}, {20, 2, 69, 159, 171, 160}, {30, 2, 67, 161, 173, 160},
+    {40, 2, 65, 159, 174, 159}, {50, 2, 63, 159, 176, 161}, {60, 2, 62, 161, 177, 160}, {70, 2, 59, 161, 181, 161},
+    {80, 2, 59, 161, 182, 160}, {90, 2, 58, 161, 182, 159}, {100, 2, 55, 161, 186, 160},
+    {110, 2, 54, 161, 188, 159}, {120, 2, 53, 161, 189, 160}, {130, 2, 50, 161, 190, 161},
+    {140, 2, 47, 160, 191, 161}, {150, 2, 48, 160, 194, 160}, {160, 2, 44, 160, 196, 159},
+    {170, 2, 44, 159, 198, 160}, {180, 2, 41, 161, 197, 161}, {190, 2, 40, 161, 201, 159},
+    {200, 2, 38, 159, 203, 159}, {210, 2, 36, 161, 203, 160}, {220, 2, 35, 160, 204, 160},
+    {230, 2, 33, 159, 207, 160}, {240, 2, 32, 161, 208, 159}, {250, 2, 29, 160, 211, 159},
+    {260, 2, 28, 159, 213, 159}, {270, 2, 26, 159, 212, 159}, {280, 2, 24, 161, 215, 160},
+    {290, 2, 24, 160, 216, 161}, {300, 2, 22, 159, 218, 161}, {310, 2, 21, 159, 221, 161}, {320, 1, 20, 160, 0, 0},
+    {330, 0, 0, 0, 0, 0},
+};
+
+/* Two contacts 160 pixels apart turned by 90 degrees clockwise around (120, 160) */
+static const TraceFrame TRACE_ROTATE[] = {
+    {0, 2, 40, 161, 199, 161}, {10, 2, 41, 156, 199, 164}, {20, 2, 41, 152, 201, 169}, {30, 2, 40, 148, 198, 174},
+    {40, 2, 43, 144, 197, 178}, {50, 2, 42, 140, 198, 182}, {60, 2, 43, 134, 197, 186}, {70, 2, 45, 130, 195, 190},
+    {80, 2, 47, 126, 192, 192}, {90, 2, 48, 123, 190, 195}, {100, 2, 52, 119, 189, 200},
+    {110, 2, 52, 116, 187, 205}, {120, 2, 56, 112, 184, 207}, {130, 2, 59, 111, 181, 209},
+    {140, 2, 60, 107, 180, 214}, {150, 2, 63, 102, 178, 218}, {160, 2, 67, 101, 175, 220},
+    {170, 2, 69, 97, 170, 221}, {180, 2, 72, 94, 168, 226}, {190, 2, 77, 94, 164, 226}, {200, 2, 79, 90, 159, 228},
+    {210, 2, 83, 88, 156, 232}, {220, 2, 86, 88, 152, 232}, {230, 2, 92, 85, 148, 234}, {240, 2, 95, 84, 145, 236},
+    {250, 2, 100, 83, 141, 236}, {260, 2, 104, 82, 136, 239}, {270, 2, 108, 80, 132, 238},
+    {280, 2, 112, 80, 128, 241}, {290, 2, 116, 80, 123, 241}, {300, 2, 119, 79, 121, 239}, {310, 0, 0, 0, 0, 0},
+};
@@ -0,0 +1,205 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cstdlib>
+#include <vector>
+#include "host_heap.hpp"
+#include "host_test.hpp"
+#include "drivers/touch/esp_panel_touch_gesture.hpp"
+#include "gesture_traces.hpp"
+
+using namespace esp_panel::drivers;
+using Type = TouchGestureEvent::Type;
+using Direction = TouchGestureEvent::Direction;
+
+#define TRACE_NUM(trace)    (sizeof(trace) / sizeof(trace[0]))
+
+static void make_frame(const TraceFrame &trace_frame, TouchFrame &frame)
+{
+    frame = TouchFrame();
+    frame.timestamp_us = static_cast<int64_t>(trace_frame.time_ms) * 1000;
+    frame.points_num = trace_frame.points_num;
+    frame.points[0] = TouchPoint(trace_frame.x0, trace_frame.y0, 0);
+    frame.points[1] = TouchPoint(trace_frame.x1, trace_frame.y1, 0);
+}
+
+static void on_event(const TouchGestureEvent &event, void *user_data)
+{
+    static_cast<std::vector<TouchGestureEvent> *>(user_data)->push_back(event);
+}
+
+static std::vector<TouchGestureEvent> run_trace(const TraceFrame trace[], size_t num)
+{
+    std::vector<TouchGestureEvent> events;
+    TouchGesture gesture;
+    gesture.attachEventCallback(on_event, &events);
+    TouchFrame frame;
+    for (size_t i = 0; i < num; i++) {
+        make_frame(trace[i], frame);
+        gesture.process(frame);
+    }
+    return events;
+}
+
+static int count_events(const std::vector<TouchGestureEvent> &events, Type type)
+{
+    int count = 0;
+    for (auto &event : events) {
+        count += (event.type == type) ? 1 : 0;
+    }
+    return count;
+}
+
+TEST_CASE("Test touch gesture tap and double tap", "[touch][gesture]")
+{
+    auto events = run_trace(TRACE_TAP, TRACE_NUM(TRACE_TAP));
+    TEST_ASSERT_EQUAL(static_cast<size_t>(1), events.size());
+    TEST_ASSERT_TRUE(events[0].type == Type::TAP);
+    TEST_ASSERT_EQUAL(1, events[0].points_num);
+    TEST_ASSERT_TRUE(std::abs(events[0].x - 100) <= 1);
+    TEST_ASSERT_TRUE(std::abs(events[0].y - 100) <= 1);
+    TEST_ASSERT_EQUAL(60000LL, static_cast<long long>(events[0].timestamp_us));
+
+    events = run_trace(TRACE_DOUBLE_TAP, TRACE_NUM(TRACE_DOUBLE_TAP));
+    TEST_ASSERT_EQUAL(static_cast<size_t>(3), events.size());
+    TEST_ASSERT_TRUE(events[0].type == Type::TAP);
+    TEST_ASSERT_TRUE(events[1].type == Type::TAP);
+    TEST_ASSERT_TRUE(events[2].type == Type::DOUBLE_TAP);
+    TEST_ASSERT_EQUAL(230000LL, static_cast<long long>(events[2].timestamp_us));
+
+    // Too slow for a double tap
+    TouchGesture::Config config;
+    config.double_tap_interval_ms = 100;
+    std::vector<TouchGestureEvent> slow_events;
+    TouchGesture gesture(config);
+    gesture.attachEventCallback(on_event, &slow_events);
+    TouchFrame frame;
+    for (auto &trace_frame : TRACE_DOUBLE_TAP) {
+        make_frame(trace_frame, frame);
+        gesture.process(frame);
+    }
+    TEST_ASSERT_EQUAL(2, count_events(slow_events, Type::TAP));
+    TEST_ASSERT_EQUAL(0, count_events(slow_events, Type::DOUBLE_TAP));
+}
+
+TEST_CASE("Test touch gesture long press", "[touch][gesture]")
+{
+    auto events = run_trace(TRACE_LONG_PRESS, TRACE_NUM(TRACE_LONG_PRESS));
+    // Emitted while pressed, the release isn't a tap
+    TEST_ASSERT_EQUAL(static_cast<size_t>(1), events.size());
+    TEST_ASSERT_TRUE(events[0].type == Type::LONG_PRESS);
+    TEST_ASSERT_EQUAL(600000LL, static_cast<long long>(events[0].timestamp_us));
+    TEST_ASSERT_TRUE(std::abs(events[0].x - 60) <= 1);
+}
+
+TEST_CASE("Test touch gesture swipe", "[touch][gesture]")
+{
+    auto events = run_trace(TRACE_SWIPE_RIGHT, TRACE_NUM(TRACE_SWIPE_RIGHT));
+    TEST_ASSERT_EQUAL(static_cast<size_t>(1), events.size());
+    TEST_ASSERT_TRUE(events[0].type == Type::SWIPE);
+    TEST_ASSERT_TRUE(events[0].direction == Direction::RIGHT);
+    TEST_ASSERT_TRUE(std::abs(events[0].dx - 200) <= 2);
+    TEST_ASSERT_TRUE(std::abs(events[0].dy - 5) <= 2);
+    printf("Swipe right: %d pixels/s\n", events[0].speed);
+    TEST_ASSERT_TRUE((events[0].speed > 900) && (events[0].speed < 1000));
+
+    events = run_trace(TRACE_SWIPE_UP, TRACE_NUM(TRACE_SWIPE_UP));
+    TEST_ASSERT_EQUAL(static_cast<size_t>(1), events.size());
+    TEST_ASSERT_TRUE(events[0].direction == Direction::UP);
+
+    // Too slow
+    events = run_trace(TRACE_DRAG, TRACE_NUM(TRACE_DRAG));
+    TEST_ASSERT_EQUAL(static_cast<size_t>(0), events.size());
+}
+
+TEST_CASE("Test touch gesture pinch", "[touch][gesture]")
+{
+    auto events = run_trace(TRACE_PINCH_OUT, TRACE_NUM(TRACE_PINCH_OUT));
+    int pinch_num = count_events(events, Type::PINCH);
+    printf("Pinch out: %d events\n", pinch_num);
+    TEST_ASSERT_TRUE(pinch_num >= 10);
+    TEST_ASSERT_EQUAL(0, count_events(events, Type::ROTATE));
+    TEST_ASSERT_EQUAL(0, count_events(events, Type::TAP));
+    TEST_ASSERT_EQUAL(0, count_events(events, Type::SWIPE));
+
+    int scale_last = 1000;
+    for (auto &event : events) {
+        TEST_ASSERT_EQUAL(2, event.points_num);
+        TEST_ASSERT_TRUE(event.scale_permille > scale_last);
+        TEST_ASSERT_TRUE(std::abs(event.x - 120) <= 2);
+        TEST_ASSERT_TRUE(std::abs(event.y - 160) <= 2);
+        scale_last = event.scale_permille;
+    }
+    // From about 100 to 200 pixels apart, the last event is within a step of it
+    TEST_ASSERT_TRUE(std::abs(scale_last - 2000) <= TouchGesture::Config().pinch_step_permille);
+}
+
+TEST_CASE("Test touch gesture rotate", "[touch][gesture]")
+{
+    auto events = run_trace(TRACE_ROTATE, TRACE_NUM(TRACE_ROTATE));
+    int rotate_num = count_events(events, Type::ROTATE);
+    printf("Rotate: %d events\n", rotate_num);
+    TEST_ASSERT_TRUE(rotate_num >= 10);
+    TEST_ASSERT_EQUAL(0, count_events(events, Type::PINCH));
+
+    int angle_last = 0;
+    for (auto &event : events) {
+        TEST_ASSERT_TRUE(event.angle_centidegrees > angle_last);
+        angle_last = event.angle_centidegrees;
+    }
+    // Turned by 90 degrees, the last event is within a step of it (plus 1 degree of noise)
+    printf("Rotate: last angle %d\n", angle_last);
+    TEST_ASSERT_TRUE(std::abs(angle_last - 9000) <= TouchGesture::Config().rotate_step_centidegrees + 100);
+}
+
+TEST_CASE("Test touch gesture from the frame ring buffer", "[touch][gesture]")
+{
+    TouchFrameRing ring(64);
+    TouchGesture gesture;
+    std::vector<TouchGestureEvent> events;
+    gesture.attachEventCallback(on_event, &events);
+
+    // The consumer polls slower than the reads, it still sees every frame
+    TouchFrame frame;
+    int events_num = 0;
+    for (size_t i = 0; i < TRACE_NUM(TRACE_DOUBLE_TAP); i++) {
+        make_frame(TRACE_DOUBLE_TAP[i], frame);
+        ring.push(frame);
+        if ((i % 5) == 4) {
+            events_num += gesture.process(ring);
+        }
+    }
+    events_num += gesture.process(ring);
+    TEST_ASSERT_EQUAL(3, events_num);
+    TEST_ASSERT_EQUAL(static_cast<size_t>(3), events.size());
+    TEST_ASSERT_TRUE(events[2].type == Type::DOUBLE_TAP);
+    TEST_ASSERT_EQUAL(0, gesture.process(ring));
+}
+
+TEST_CASE("Test touch gesture without heap activity", "[touch][gesture]")
+{
+    TouchGesture gesture;
+    int events_num = 0;
+    gesture.attachEventCallback([](const TouchGestureEvent &, void *user_data) {
+        (*static_cast<int *>(user_data))++;
+    }, &events_num);
+
+    const TraceFrame *traces[] = {TRACE_DOUBLE_TAP, TRACE_SWIPE_RIGHT, TRACE_PINCH_OUT, TRACE_ROTATE};
+    const size_t traces_num[] = {
+        TRACE_NUM(TRACE_DOUBLE_TAP), TRACE_NUM(TRACE_SWIPE_RIGHT), TRACE_NUM(TRACE_PINCH_OUT), TRACE_NUM(TRACE_ROTATE)
+    };
+    TouchFrame frame;
+    auto heap_start = host_test::getHeapActivity();
+    for (int i = 0; i < 4; i++) {
+        for (size_t j = 0; j < traces_num[i]; j++) {
+            make_frame(traces[i][j], frame);
+            gesture.process(frame);
+        }
+    }
+    TEST_ASSERT_EQUAL(heap_start.getTotal(), host_test::getHeapActivity().getTotal());
+    TEST_ASSERT_TRUE(events_num > 30);
+}
+
+HOST_TEST_MAIN()
@@ -0,0 +1,205 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cmath>
+#include "host_heap.hpp"
+#include "host_test.hpp"
+#include "drivers/touch/esp_panel_touch_filter.hpp"
+#include "drivers/touch/esp_panel_touch_predictor.hpp"
+
+using namespace esp_panel::drivers;
+
+#define TEST_SCREEN_X_MAX       (479)
+#define TEST_SCREEN_Y_MAX       (479)
+#define TEST_POLL_PERIOD_US     (10000)
+#define TEST_TRACE_TIME_US      (1000000)
+// Touch poll, LVGL render and flush, from the read of a point to its display
+#define TEST_LATENCY_MS         (50)
+
+struct Position {
+    double x;
+    double y;
+};
+
+using TraceFunction = Position (*)(double time_s);
+
+/* Ground truths of the moves of a finger, in pixels over seconds */
+static Position trace_drag(double time_s)
+{
+    return {40 + 400 * time_s, 240};
+}
+
+static Position trace_circle(double time_s)
+{
+    return {240 + 150 * std::cos(2 * M_PI * time_s), 240 + 150 * std::sin(2 * M_PI * time_s)};
+}
+
+static Position trace_fling(double time_s)
+{
+    // From 1200 pixels/s to a stop in 0.6 s, then held
+    double t = (time_s < 0.6) ? time_s : 0.6;
+    return {40 + 1200 * t - 1000 * t * t, 100 + 600 * t - 500 * t * t};
+}
+
+static Position trace_hold(double)
+{
+    return {240, 240};
+}
+
+struct BenchResult {
+    double error_mean = 0;      // Distance from the ground truth at the time of the display, in pixels
+    double error_max = 0;
+    double speed_mean = 0;      // Of the ground truth, in pixels/s
+};
+
+/**
+ * Replays a trace sampled every poll period with +-1 pixel of noise. Each point is compared with the ground truth
+ * `TEST_LATENCY_MS` later, when it is displayed
+ */
+static BenchResult run_bench(
+    TraceFunction trace, const TouchFilter::Config &filter_config, const TouchPredictor::Config &predictor_config
+)
+{
+    TouchFilter filter;
+    TouchPredictor predictor;
+    filter.configure(filter_config);
+    predictor.configure(predictor_config);
+    predictor.setBounds(TEST_SCREEN_X_MAX, TEST_SCREEN_Y_MAX);
+
+    BenchResult result;
+    uint32_t seed = 1;
+    int num = 0;
+    for (int64_t time_us = 0; time_us <= TEST_TRACE_TIME_US; time_us += TEST_POLL_PERIOD_US) {
+        Position truth = trace(time_us / 1e6);
+        seed = seed * 1103515245 + 12345;
+        int noise_x = static_cast<int>((seed >> 16) % 3) - 1;
+        int noise_y = static_cast<int>((seed >> 20) % 3) - 1;
+        TouchPoint point(static_cast<int>(std::lround(truth.x)) + noise_x,
+                         static_cast<int>(std::lround(truth.y)) + noise_y, 0);
+        filter.process(&point, 1, time_us);
+        predictor.process(&point, 1, time_us);
+
+        // Skip the start of the trace, the estimates settle in a few reads
+        if (time_us < 100000) {
+            continue;
+        }
+        double display_s = (time_us + TEST_LATENCY_MS * 1000) / 1e6;
+        Position display = trace(display_s);
+        Position next = trace(display_s + 0.001);
+        double error = std::hypot(point.x - display.x, point.y - display.y);
+        result.error_mean += error;
+        result.error_max = (error > result.error_max) ? error : result.error_max;
+        result.speed_mean += std::hypot(next.x - display.x, next.y - display.y) * 1000;
+        num++;
+    }
+    result.error_mean /= num;
+    result.speed_mean /= num;
+
+    return result;
+}
+
+static void print_result(const char *name, const BenchResult &raw, const BenchResult &predicted)
+{
+    // The error of a point over the speed is the latency left, as seen by the user
+    auto to_latency_ms = [](const BenchResult & result) {
+        return (result.speed_mean > 0) ? (result.error_mean / result.speed_mean * 1000) : 0;
+    };
+    printf(
+        "%-8s | speed %6.0f px/s | raw error %5.1f px (max %5.1f), %5.1f ms | predicted error %5.1f px (max %5.1f), "
+        "%5.1f ms\n", name, raw.speed_mean, raw.error_mean, raw.error_max, to_latency_ms(raw), predicted.error_mean,
+        predicted.error_max, to_latency_ms(predicted)
+    );
+}
+
+TEST_CASE("Test touch predictor latency benchmark", "[touch][predictor]")
+{
+    const TouchFilter::Config filter_config = {.iir_weight_percent = 70, .dead_zone = 2};
+    const TouchPredictor::Config predictor_config = {
+        .horizon_ms = TEST_LATENCY_MS, .smoothing_percent = 40, .acceleration_percent = 50, .distance_max = 60
+    };
+    printf("Latency of %d ms, read every %d ms\n", TEST_LATENCY_MS, TEST_POLL_PERIOD_US / 1000);
+
+    struct {
+        const char *name;
+        TraceFunction trace;
+    } benches[] = {
+        {"drag", trace_drag}, {"circle", trace_circle}, {"fling", trace_fling}, {"hold", trace_hold},
+    };
+    BenchResult raw[4];
+    BenchResult predicted[4];
+    for (int i = 0; i < 4; i++) {
+        raw[i] = run_bench(benches[i].trace, filter_config, {});
+        predicted[i] = run_bench(benches[i].trace, filter_config, predictor_config);
+        print_result(benches[i].name, raw[i], predicted[i]);
+    }
+
+    // Drag, circle and fling: most of the latency is hidden
+    TEST_ASSERT_TRUE(predicted[0].error_mean < raw[0].error_mean / 4);
+    TEST_ASSERT_TRUE(predicted[1].error_mean < raw[1].error_mean / 2);
+    TEST_ASSERT_TRUE(predicted[2].error_mean < raw[2].error_mean / 2);
+    // Hold: the noise is amplified a little only
+    TEST_ASSERT_TRUE(predicted[3].error_mean < 3);
+}
+
+TEST_CASE("Test touch predictor velocity only", "[touch][predictor]")
+{
+    TouchPredictor predictor;
+    TEST_ASSERT_FALSE(predictor.isEnabled());
+    TEST_ASSERT_FALSE(predictor.configure({.horizon_ms = TouchPredictor::HORIZON_MAX_MS + 1}));
+    TEST_ASSERT_FALSE(predictor.configure({.horizon_ms = 20, .smoothing_percent = 0}));
+    TEST_ASSERT_TRUE(predictor.configure({.horizon_ms = 20, .smoothing_percent = 100}));
+    TEST_ASSERT_TRUE(predictor.isEnabled());
+
+    // 10 pixels per 10 ms read, 20 pixels ahead. The first point isn't predicted
+    for (int i = 0; i < 10; i++) {
+        TouchPoint point(100 + i * 10, 50, 0);
+        predictor.process(&point, 1, i * 10000);
+        TEST_ASSERT_EQUAL((i == 0) ? 100 : (120 + i * 10), point.x);
+        TEST_ASSERT_EQUAL(50, point.y);
+    }
+
+    // Starts over after a pause
+    TouchPoint point(300, 50, 0);
+    predictor.process(&point, 1, 10 * 10000 + TouchPredictor::PERIOD_MAX_MS * 1000 + 1);
+    TEST_ASSERT_EQUAL(300, point.x);
+}
+
+TEST_CASE("Test touch predictor bounds and distance limit", "[touch][predictor]")
+{
+    TouchPredictor predictor;
+    TEST_ASSERT_TRUE(predictor.configure({.horizon_ms = 100, .smoothing_percent = 100}));
+    predictor.setBounds(TEST_SCREEN_X_MAX, TEST_SCREEN_Y_MAX);
+
+    // Toward the top-right corner at 2000 pixels/s, 200 pixels ahead. The tracked contact 1 is the only one
+    TouchPoint point;
+    for (int i = 0; i < 5; i++) {
+        point = TouchPoint(400 + i * 20, 40 - i * 20, 0);
+        point.id = 1;
+        predictor.process(&point, 1, i * 10000);
+    }
+    TEST_ASSERT_EQUAL(TEST_SCREEN_X_MAX, point.x);
+    TEST_ASSERT_EQUAL(0, point.y);
+
+    // The move is limited along its direction
+    TEST_ASSERT_TRUE(predictor.configure({.horizon_ms = 100, .smoothing_percent = 100, .distance_max = 50}));
+    for (int i = 0; i < 5; i++) {
+        point = TouchPoint(100 + i * 30, 100 + i * 40, 0);
+        predictor.process(&point, 1, i * 10000);
+    }
+    TEST_ASSERT_EQUAL(100 + 4 * 30 + 30, point.x);
+    TEST_ASSERT_EQUAL(100 + 4 * 40 + 40, point.y);
+}
+
+TEST_CASE("Test touch predictor without heap activity", "[touch][predictor]")
+{
+    TouchPredictor predictor;
+    TEST_ASSERT_TRUE(predictor.configure({.horizon_ms = 50, .acceleration_percent = 100}));
+    auto heap_start = host_test::getHeapActivity();
+    BenchResult result = run_bench(trace_circle, {}, predictor.getConfig());
+    TEST_ASSERT_EQUAL(heap_start.getTotal(), host_test::getHeapActivity().getTotal());
+    TEST_ASSERT_TRUE(result.error_mean > 0);
+}
+
+HOST_TEST_MAIN()
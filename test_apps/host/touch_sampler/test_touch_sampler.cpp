@@ -0,0 +1,138 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include "host_test.hpp"
+#include "drivers/touch/esp_panel_touch_sampler.hpp"
+
+using namespace esp_panel::drivers;
+
+#define TEST_BUS_TIME_US        (500)
+
+/**
+ * Reads at the scheduled time, returns the period from the last read in milliseconds
+ */
+static int read_next(TouchSampler &sampler, int64_t &time_us, bool is_pressed, bool is_woken = false)
+{
+    int64_t last_time_us = time_us;
+    time_us = sampler.getNextReadTimeUs();
+    sampler.onRead(time_us, TEST_BUS_TIME_US, is_pressed, is_woken);
+
+    return static_cast<int>((time_us - last_time_us) / 1000);
+}
+
+TEST_CASE("Test touch sampler burst and back-off", "[touch][sampler]")
+{
+    TouchSampler sampler;
+    TEST_ASSERT_TRUE(sampler.configure({.burst_period_ms = 10, .idle_period_ms = 200}, false));
+    sampler.reset(0);
+    TEST_ASSERT_TRUE(sampler.getMode() == TouchSampler::Mode::BACKOFF);
+    TEST_ASSERT_EQUAL(0, sampler.getNextReadTimeUs());
+
+    // Pressed on the first read
+    int64_t time_us = 0;
+    read_next(sampler, time_us, true);
+    TEST_ASSERT_TRUE(sampler.getMode() == TouchSampler::Mode::BURST);
+    for (int i = 0; i < 10; i++) {
+        TEST_ASSERT_EQUAL(10, read_next(sampler, time_us, true));
+    }
+
+    // Released, the period doubles up to the idle one
+    const int periods_ms[] = {10, 20, 40, 80, 160, 200, 200};
+    for (int period_ms : periods_ms) {
+        TEST_ASSERT_EQUAL(period_ms, read_next(sampler, time_us, false));
+        TEST_ASSERT_TRUE(sampler.getMode() == TouchSampler::Mode::BACKOFF);
+    }
+
+    // Pressed again, back to the burst rate
+    TEST_ASSERT_EQUAL(200, read_next(sampler, time_us, true));
+    TEST_ASSERT_TRUE(sampler.getMode() == TouchSampler::Mode::BURST);
+    TEST_ASSERT_EQUAL(10, read_next(sampler, time_us, true));
+}
+
+TEST_CASE("Test touch sampler interrupt", "[touch][sampler]")
+{
+    TouchSampler sampler;
+    TEST_ASSERT_TRUE(sampler.configure({.burst_period_ms = 5, .idle_period_ms = 1000}, true));
+    sampler.reset(0);
+    TEST_ASSERT_TRUE(sampler.getMode() == TouchSampler::Mode::INTERRUPT);
+
+    // Not pressed, waits for the interrupt with the idle period as the watchdog
+    int64_t time_us = 0;
+    read_next(sampler, time_us, false);
+    TEST_ASSERT_TRUE(sampler.getMode() == TouchSampler::Mode::INTERRUPT);
+    TEST_ASSERT_EQUAL(1000, read_next(sampler, time_us, false));
+
+    // Woken earlier by the interrupt
+    time_us += 300000;
+    sampler.onRead(time_us, TEST_BUS_TIME_US, true, true);
+    TEST_ASSERT_TRUE(sampler.getMode() == TouchSampler::Mode::BURST);
+    TEST_ASSERT_EQUAL(5, read_next(sampler, time_us, true));
+    TEST_ASSERT_EQUAL(5, read_next(sampler, time_us, false));
+    TEST_ASSERT_TRUE(sampler.getMode() == TouchSampler::Mode::INTERRUPT);
+    TEST_ASSERT_EQUAL(static_cast<uint32_t>(1), sampler.getStats(time_us).interrupt_count);
+
+    // The interrupt is not used if disabled
+    TEST_ASSERT_TRUE(sampler.configure({.burst_period_ms = 5, .idle_period_ms = 1000, .use_interrupt = false}, true));
+    sampler.reset(time_us);
+    TEST_ASSERT_TRUE(sampler.getMode() == TouchSampler::Mode::BACKOFF);
+    read_next(sampler, time_us, false);
+    TEST_ASSERT_EQUAL(5, read_next(sampler, time_us, false));
+    TEST_ASSERT_EQUAL(10, read_next(sampler, time_us, false));
+}
+
+TEST_CASE("Test touch sampler stats", "[touch][sampler]")
+{
+    TouchSampler sampler;
+    TEST_ASSERT_TRUE(sampler.configure({.burst_period_ms = 10, .idle_period_ms = 100}, false));
+    int64_t time_us = 1000000;
+    sampler.reset(time_us);
+    TEST_ASSERT_EQUAL(0, sampler.getStats(time_us).getSampleRateHz());
+    TEST_ASSERT_EQUAL(0, sampler.getStats(time_us).getBurstSampleRateHz());
+
+    // 100 reads in one second, all pressed
+    for (int i = 0; i < 100; i++) {
+        read_next(sampler, time_us, true);
+    }
+    TouchSampler::Stats stats = sampler.getStats(time_us + 10000);
+    TEST_ASSERT_TRUE(stats.mode == TouchSampler::Mode::BURST);
+    TEST_ASSERT_EQUAL(10, stats.period_ms);
+    TEST_ASSERT_EQUAL(static_cast<uint32_t>(100), stats.read_count);
+    TEST_ASSERT_EQUAL(static_cast<uint32_t>(0), stats.interrupt_count);
+    // The first read followed no pressed read
+    TEST_ASSERT_EQUAL(static_cast<uint32_t>(99), stats.burst_read_count);
+    TEST_ASSERT_EQUAL(100 * TEST_BUS_TIME_US, stats.bus_time_us);
+    TEST_ASSERT_EQUAL(1000000, stats.elapsed_us);
+    TEST_ASSERT_EQUAL(100, stats.getSampleRateHz());
+    TEST_ASSERT_EQUAL(100, stats.getBurstSampleRateHz());
+    TEST_ASSERT_EQUAL(50, stats.getBusLoadPermille());
+
+    // The reads without contact don't count in the burst rate
+    for (int i = 0; i < 10; i++) {
+        read_next(sampler, time_us, false);
+    }
+    stats = sampler.getStats(time_us);
+    TEST_ASSERT_EQUAL(static_cast<uint32_t>(100), stats.burst_read_count);
+    TEST_ASSERT_EQUAL(100, stats.getBurstSampleRateHz());
+    TEST_ASSERT_TRUE(stats.getSampleRateHz() < 100);
+
+    sampler.reset(time_us);
+    TEST_ASSERT_EQUAL(static_cast<uint32_t>(0), sampler.getStats(time_us).read_count);
+}
+
+TEST_CASE("Test touch sampler invalid config", "[touch][sampler]")
+{
+    TouchSampler sampler;
+    TEST_ASSERT_TRUE(sampler.configure({}, false));
+    TEST_ASSERT_FALSE(sampler.configure({.burst_period_ms = 0}, false));
+    TEST_ASSERT_FALSE(sampler.configure({.burst_period_ms = 20, .idle_period_ms = 10}, false));
+    TEST_ASSERT_FALSE(sampler.configure({.idle_period_ms = TouchSampler::PERIOD_MAX_MS + 1}, false));
+    TEST_ASSERT_FALSE(sampler.configure({.task_stack_size = 0}, false));
+
+    // The last valid configuration is kept
+    TEST_ASSERT_EQUAL(10, sampler.getConfig().burst_period_ms);
+    TEST_ASSERT_EQUAL(200, sampler.getConfig().idle_period_ms);
+}
+
+HOST_TEST_MAIN()
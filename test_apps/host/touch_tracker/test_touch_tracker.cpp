@@ -0,0 +1,192 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include "host_heap.hpp"
+#include "host_test.hpp"
+#include "drivers/touch/esp_panel_touch_filter.hpp"
+#include "drivers/touch/esp_panel_touch_gesture.hpp"
+#include "drivers/touch/esp_panel_touch_tracker.hpp"
+
+using namespace esp_panel::drivers;
+using Phase = TouchContact::Phase;
+
+#define TEST_FRAME_NUM      (200)
+
+/**
+ * Two fingers moving apart along X around (120, 160), the controller swaps their order on every other read
+ */
+static int make_swapped_frame(int index, TouchPoint points[])
+{
+    int offset = 50 + index / 4;
+    TouchPoint left(120 - offset, 160, 0);
+    TouchPoint right(120 + offset, 160, 0);
+    points[0] = (index & 1) ? right : left;
+    points[1] = (index & 1) ? left : right;
+
+    return 2;
+}
+
+TEST_CASE("Test touch tracker IDs follow the swapped points", "[touch][tracker]")
+{
+    TouchTracker tracker;
+    TouchPoint points[TouchTracker::CONTACTS_MAX_NUM];
+    for (int i = 0; i < TEST_FRAME_NUM; i++) {
+        int num = make_swapped_frame(i, points);
+        tracker.process(points, num);
+        for (int j = 0; j < num; j++) {
+            // The left finger was first in the first read
+            TEST_ASSERT_EQUAL((points[j].x < 120) ? 0 : 1, points[j].id);
+        }
+        Phase phase = (i == 0) ? Phase::DOWN : Phase::MOVE;
+        TEST_ASSERT_TRUE(tracker.getContact(0).phase == phase);
+        TEST_ASSERT_TRUE(tracker.getContact(1).phase == phase);
+        TEST_ASSERT_TRUE(tracker.getContact(2).phase == Phase::NONE);
+    }
+}
+
+TEST_CASE("Test touch tracker press and release", "[touch][tracker]")
+{
+    // Without limit, the released A would be matched with the pressed C
+    TouchTracker tracker({.distance_max = 100});
+    TouchPoint points[TouchTracker::CONTACTS_MAX_NUM];
+    TouchContact contacts[TouchTracker::CONTACTS_MAX_NUM];
+
+    // A and B pressed
+    points[0] = TouchPoint(10, 10, 0);
+    points[1] = TouchPoint(200, 200, 0);
+    tracker.process(points, 2);
+    TEST_ASSERT_EQUAL(0, points[0].id);
+    TEST_ASSERT_EQUAL(1, points[1].id);
+    TEST_ASSERT_EQUAL(2, tracker.getContacts(contacts, TouchTracker::CONTACTS_MAX_NUM));
+    TEST_ASSERT_TRUE(contacts[0].phase == Phase::DOWN);
+    TEST_ASSERT_TRUE(contacts[1].phase == Phase::DOWN);
+
+    // A released, C pressed, the controller reports C first
+    points[0] = TouchPoint(100, 300, 0);
+    points[1] = TouchPoint(202, 201, 0);
+    tracker.process(points, 2);
+    TEST_ASSERT_EQUAL(1, points[1].id);
+    TEST_ASSERT_EQUAL(2, points[0].id);
+    TEST_ASSERT_EQUAL(3, tracker.getContacts(contacts, TouchTracker::CONTACTS_MAX_NUM));
+    TEST_ASSERT_TRUE(contacts[0].phase == Phase::UP);
+    TEST_ASSERT_EQUAL(10, contacts[0].point.x);
+    TEST_ASSERT_TRUE(contacts[1].phase == Phase::MOVE);
+    TEST_ASSERT_EQUAL(202, contacts[1].point.x);
+    TEST_ASSERT_TRUE(contacts[2].phase == Phase::DOWN);
+    TEST_ASSERT_EQUAL(1, tracker.getContacts(contacts, 1));
+
+    // The released ID is free again, and taken first
+    points[0] = TouchPoint(203, 201, 0);
+    points[1] = TouchPoint(100, 301, 0);
+    points[2] = TouchPoint(50, 50, 0);
+    tracker.process(points, 3);
+    TEST_ASSERT_EQUAL(1, points[0].id);
+    TEST_ASSERT_EQUAL(2, points[1].id);
+    TEST_ASSERT_EQUAL(0, points[2].id);
+    TEST_ASSERT_TRUE(tracker.getContact(0).phase == Phase::DOWN);
+
+    // All released, then gone
+    tracker.process(points, 0);
+    TEST_ASSERT_EQUAL(3, tracker.getContacts(contacts, TouchTracker::CONTACTS_MAX_NUM));
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_TRUE(contacts[i].phase == Phase::UP);
+    }
+    tracker.process(points, 0);
+    TEST_ASSERT_EQUAL(0, tracker.getContacts(contacts, TouchTracker::CONTACTS_MAX_NUM));
+}
+
+TEST_CASE("Test touch tracker distance limit and capacity", "[touch][tracker]")
+{
+    TouchTracker tracker;
+    TEST_ASSERT_FALSE(tracker.configure({.distance_max = -1}));
+    TEST_ASSERT_TRUE(tracker.configure({.distance_max = 30}));
+
+    // A jump farther than the limit is a release and a new press
+    TouchPoint points[TouchTracker::CONTACTS_MAX_NUM];
+    points[0] = TouchPoint(10, 10, 0);
+    tracker.process(points, 1);
+    points[0] = TouchPoint(30, 30, 0);
+    tracker.process(points, 1);
+    TEST_ASSERT_EQUAL(0, points[0].id);
+    points[0] = TouchPoint(100, 30, 0);
+    tracker.process(points, 1);
+    TEST_ASSERT_EQUAL(1, points[0].id);
+    TEST_ASSERT_TRUE(tracker.getContact(0).phase == Phase::UP);
+    TEST_ASSERT_TRUE(tracker.getContact(1).phase == Phase::DOWN);
+
+    // With all the IDs taken, a new press takes the ID released in the same read
+    tracker.reset();
+    for (int i = 0; i < TouchTracker::CONTACTS_MAX_NUM; i++) {
+        points[i] = TouchPoint(i * 40, 0, 0);
+    }
+    tracker.process(points, TouchTracker::CONTACTS_MAX_NUM);
+    points[0] = TouchPoint(0, 300, 0);
+    tracker.process(points, TouchTracker::CONTACTS_MAX_NUM);
+    TEST_ASSERT_EQUAL(0, points[0].id);
+    TEST_ASSERT_TRUE(tracker.getContact(0).phase == Phase::DOWN);
+    for (int i = 1; i < TouchTracker::CONTACTS_MAX_NUM; i++) {
+        TEST_ASSERT_EQUAL(i, points[i].id);
+    }
+}
+
+TEST_CASE("Test touch filter and gesture follow the tracked IDs", "[touch][tracker]")
+{
+    // Untracked, the swapped points look like a half turn on every read
+    auto on_event = [](const TouchGestureEvent &event, void *user_data) {
+        int *nums = static_cast<int *>(user_data);
+        nums[(event.type == TouchGestureEvent::Type::ROTATE) ? 0 : 1]++;
+    };
+    int untracked_nums[2] = {};
+    TouchGesture untracked_gesture;
+    untracked_gesture.attachEventCallback(on_event, untracked_nums);
+    TouchFrame frame;
+    for (int i = 0; i < TEST_FRAME_NUM; i++) {
+        frame.timestamp_us = i * 10000;
+        frame.points_num = make_swapped_frame(i, frame.points.data());
+        untracked_gesture.process(frame);
+    }
+    printf("Untracked: %d rotate events\n", untracked_nums[0]);
+    TEST_ASSERT_TRUE(untracked_nums[0] > 0);
+
+    TouchTracker tracker;
+    TouchFilter filter;
+    TEST_ASSERT_TRUE(filter.configure({.iir_weight_percent = 50}));
+    int tracked_nums[2] = {};
+    TouchGesture gesture;
+    gesture.attachEventCallback(on_event, tracked_nums);
+    for (int i = 0; i < TEST_FRAME_NUM; i++) {
+        frame.timestamp_us = i * 10000;
+        frame.points_num = make_swapped_frame(i, frame.points.data());
+        tracker.process(frame.points.data(), frame.points_num);
+        filter.process(frame.points.data(), frame.points_num, frame.timestamp_us);
+        gesture.process(frame);
+        // Smoothed per finger, never averaged with the other one
+        for (int j = 0; j < frame.points_num; j++) {
+            TEST_ASSERT_TRUE((frame.points[j].id == 0) ? (frame.points[j].x < 120) : (frame.points[j].x > 120));
+        }
+    }
+    printf("Tracked: %d rotate events, %d pinch events\n", tracked_nums[0], tracked_nums[1]);
+    TEST_ASSERT_EQUAL(0, tracked_nums[0]);
+    TEST_ASSERT_TRUE(tracked_nums[1] > 0);
+}
+
+TEST_CASE("Test touch tracker without heap activity", "[touch][tracker]")
+{
+    TouchTracker tracker;
+    TouchPoint points[TouchTracker::CONTACTS_MAX_NUM];
+    TouchContact contacts[TouchTracker::CONTACTS_MAX_NUM];
+    int contacts_sum = 0;
+    auto heap_start = host_test::getHeapActivity();
+    for (int i = 0; i < TEST_FRAME_NUM; i++) {
+        int num = make_swapped_frame(i, points);
+        // Release all the contacts every 10 reads
+        tracker.process(points, ((i % 10) == 9) ? 0 : num);
+        contacts_sum += tracker.getContacts(contacts, TouchTracker::CONTACTS_MAX_NUM);
+    }
+    TEST_ASSERT_EQUAL(heap_start.getTotal(), host_test::getHeapActivity().getTotal());
+    TEST_ASSERT_EQUAL(TEST_FRAME_NUM * 2, contacts_sum);
+}
+
+HOST_TEST_MAIN()